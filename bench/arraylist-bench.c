@@ -0,0 +1,80 @@
+#include "bench.h"
+#include "../include/arraylist.h"
+
+// Linear search costs O(n) per query, so large lists get fewer queries.
+#define SEARCH_WORK 100000000
+
+/**
+ * @brief Times `ArrayList_insert` into lists growing from empty.
+ */
+static void bench_insert(size_t elementSize, size_t size) {
+    BenchTimer timer = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        ArrayList* list = Bench_check(ArrayList_init(0, elementSize), "ArrayList");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) ArrayList_insert(list, Bench_element(element, Bench_key(i)));
+            Bench_record(&timer, start, ops);
+        }
+        ArrayList_destroy(list);
+    }
+    Bench_report(&timer, "ArrayList", NULL, "insert", elementSize, size);
+    Bench_freeTimer(&timer);
+}
+
+/**
+ * @brief Times `ArrayList_get` at random indices and `ArrayList_search` for random present keys.
+ */
+static void bench_lookup(size_t elementSize, size_t size) {
+    BenchTimer timer = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    ArrayList* list = Bench_check(ArrayList_init(size, elementSize), "ArrayList");
+    for (size_t i = 0; i < size; i++) ArrayList_insert(list, Bench_element(element, Bench_key(i)));
+
+    uint64_t rng = 0x9E3779B97F4A7C15u;
+    size_t gets = size > BENCH_MIN_OPS ? size : BENCH_MIN_OPS;
+    for (size_t i = 0; i < gets;) {
+        size_t end = Bench_batchEnd(i, gets, BENCH_BATCH), ops = end - i;
+        uint64_t start = Bench_now();
+        for (; i < end; i++) {
+            ArrayList_get(list, Bench_random(&rng) % size, element);
+            bench_sink = element[0];
+        }
+        Bench_record(&timer, start, ops);
+    }
+    Bench_report(&timer, "ArrayList", NULL, "get", elementSize, size);
+
+    size_t searches = SEARCH_WORK / size;
+    if (searches > size) searches = size;
+    if (searches < BENCH_BATCH) searches = BENCH_BATCH;
+    size_t index = 0;
+    for (size_t i = 0; i < searches; i++) {
+        Bench_element(element, Bench_key(Bench_random(&rng) % size));
+        uint64_t start = Bench_now();
+        ArrayList_search(list, element, &index, Bench_compare);
+        bench_sink = index;
+        Bench_record(&timer, start, 1);
+    }
+    Bench_report(&timer, "ArrayList", NULL, "search", elementSize, size);
+
+    ArrayList_destroy(list);
+    Bench_freeTimer(&timer);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    Bench_parseArgs(argc, argv, &config);
+
+    for (size_t e = 0; e < BENCH_ELEMENT_SIZE_COUNT; e++) {
+        size_t elementSize = BENCH_ELEMENT_SIZES[e];
+        for (size_t size = config.minSize; size <= config.maxSize; size *= 10) {
+            // Growth by doubling briefly holds the old and the new array.
+            if (!Bench_fits(&config, "ArrayList", size, 3 * elementSize)) continue;
+            bench_insert(elementSize, size);
+            bench_lookup(elementSize, size);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "bench.h"
+#include "../include/avltree.h"
+
+// Per-node bookkeeping (children, height, subtree size) plus malloc's header.
+#define NODE_OVERHEAD 48
+
+/**
+ * @brief Times `AVLTree_insert` of scattered keys, `AVLTree_search` for random
+ * present keys, then `AVLTree_delete` of every key in a different order.
+ */
+static void bench_tree(size_t elementSize, size_t size) {
+    BenchTimer insert = { 0 }, search = { 0 }, del = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    uint64_t rng = 0x9E3779B97F4A7C15u;
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        AVLTree* tree = Bench_check(AVLTree_init(elementSize, Bench_compare), "AVLTree");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) AVLTree_insert(tree, Bench_element(element, Bench_key(i)));
+            Bench_record(&insert, start, ops);
+        }
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++)
+                bench_sink = (uintptr_t)AVLTree_search(tree, Bench_element(element, Bench_key(Bench_random(&rng) % size)));
+            Bench_record(&search, start, ops);
+        }
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) AVLTree_delete(tree, Bench_element(element, Bench_key(Bench_permute(i, size))));
+            Bench_record(&del, start, ops);
+        }
+        AVLTree_destroy(tree);
+    }
+
+    Bench_report(&insert, "AVLTree", NULL, "insert", elementSize, size);
+    Bench_report(&search, "AVLTree", NULL, "search", elementSize, size);
+    Bench_report(&del, "AVLTree", NULL, "delete", elementSize, size);
+    Bench_freeTimer(&insert);
+    Bench_freeTimer(&search);
+    Bench_freeTimer(&del);
+}
+
+/**
+ * @brief Times `AVLTree_deleteMany` removing every key, given in scattered order, in one call.
+ */
+static void bench_delete_many(size_t elementSize, size_t size) {
+    BenchTimer timer = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    unsigned char* keys = Bench_check(malloc(size * elementSize), "keys");
+    for (size_t i = 0; i < size; i++)
+        memcpy(keys + i * elementSize, Bench_element(element, Bench_key(Bench_permute(i, size))), elementSize);
+
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        AVLTree* tree = Bench_check(AVLTree_init(elementSize, Bench_compare), "AVLTree");
+        for (size_t i = 0; i < size; i++) AVLTree_insert(tree, Bench_element(element, Bench_key(i)));
+        uint64_t start = Bench_now();
+        AVLTree_deleteMany(tree, keys, size, NULL);
+        Bench_record(&timer, start, size);
+        AVLTree_destroy(tree);
+    }
+
+    Bench_report(&timer, "AVLTree", NULL, "deleteMany", elementSize, size);
+    Bench_freeTimer(&timer);
+    free(keys);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    Bench_parseArgs(argc, argv, &config);
+
+    for (size_t e = 0; e < BENCH_ELEMENT_SIZE_COUNT; e++) {
+        size_t elementSize = BENCH_ELEMENT_SIZES[e];
+        for (size_t size = config.minSize; size <= config.maxSize; size *= 10) {
+            // deleteMany also holds the keys and, when they are unsorted, a sorted copy.
+            if (!Bench_fits(&config, "AVLTree", size, 3 * elementSize + NODE_OVERHEAD)) continue;
+            bench_tree(elementSize, size);
+            bench_delete_many(elementSize, size);
+        }
+    }
+    return 0;
+}
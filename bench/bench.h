@@ -0,0 +1,254 @@
+/**
+ * @file bench.h
+ * @brief Shared harness for the benchmark programs in bench/.
+ *
+ * Each `*-bench.c` program times the operations of one container over every
+ * combination of element size and container size, and prints one JSON object
+ * per measurement on its own line (JSON Lines), for example:
+ *
+ * `{"container":"Heap","variant":"4-ary","op":"push","element_size":16,"size":100000,
+ *   "ops":1000000,"seconds":0.0213,"ops_per_sec":46948356.8,"p50_ns":19.8,"p99_ns":41.3}`
+ *
+ * Operations are timed in short batches, so the clock is read once per batch
+ * rather than once per operation. `ops_per_sec` covers every timed operation;
+ * `p50_ns` and `p99_ns` are percentiles of the average latency per operation
+ * within a batch. Small containers are rebuilt and measured repeatedly until at
+ * least `BENCH_MIN_OPS` operations have been timed.
+ *
+ * Elements are `element_size` bytes whose first four bytes hold a distinct
+ * 32-bit key; the remaining bytes are padding that is copied but never compared.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+/** The element sizes every container is measured with, in bytes. */
+static const size_t BENCH_ELEMENT_SIZES[] = { 4, 16, 64, 256 };
+#define BENCH_ELEMENT_SIZE_COUNT (sizeof(BENCH_ELEMENT_SIZES) / sizeof(BENCH_ELEMENT_SIZES[0]))
+
+/** The largest element size, for stack buffers. */
+#define BENCH_MAX_ELEMENT_SIZE 256
+
+/** Operations timed between two clock reads. */
+#define BENCH_BATCH 16
+
+/** Minimum number of operations timed per measurement. */
+#define BENCH_MIN_OPS 1000000
+
+/**
+ * @struct BenchConfig
+ * @brief Command-line options shared by every benchmark program.
+ */
+typedef struct BenchConfig
+{
+    size_t minSize;     // Smallest container size measured (`--min-size`, default 1e3).
+    size_t maxSize;     // Largest container size measured (`--max-size`, default 1e6).
+    size_t maxBytes;    // Configurations estimated to need more memory are skipped (`--max-bytes`, default 1 GiB).
+} BenchConfig;
+
+/**
+ * @struct BenchTimer
+ * @brief Accumulates the batches of one measurement.
+ */
+typedef struct BenchTimer
+{
+    double* samples;    // Average nanoseconds per operation of each batch.
+    size_t count;       // Number of batches recorded.
+    size_t capacity;    // Allocated length of `samples`.
+    uint64_t elapsed;   // Total nanoseconds over all batches.
+    size_t ops;         // Total operations over all batches.
+} BenchTimer;
+
+/** Written with every lookup result so the optimizer cannot drop unused lookups. */
+static volatile uintptr_t bench_sink;
+
+/**
+ * @brief Reads a monotonic clock.
+ * @return The current time in nanoseconds.
+ */
+static inline uint64_t Bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Parses `--min-size`, `--max-size` and `--max-bytes`, exiting with a usage message on error.
+ * @details Values are read with `strtod`, so `1e8` is accepted.
+ */
+static inline void Bench_parseArgs(int argc, char** argv, BenchConfig* config) {
+    config->minSize = 1000;
+    config->maxSize = 1000000;
+    config->maxBytes = (size_t)1 << 30;
+
+    for (int i = 1; i < argc; i++) {
+        size_t* target = NULL;
+        if (strcmp(argv[i], "--min-size") == 0) target = &config->minSize;
+        else if (strcmp(argv[i], "--max-size") == 0) target = &config->maxSize;
+        else if (strcmp(argv[i], "--max-bytes") == 0) target = &config->maxBytes;
+
+        char* end = NULL;
+        double value = (target && i + 1 < argc) ? strtod(argv[++i], &end) : 0;
+        if (!target || !end || *end != '\0' || value < 1) {
+            fprintf(stderr, "usage: %s [--min-size N] [--max-size N] [--max-bytes N]\n", argv[0]);
+            exit(2);
+        }
+        *target = (size_t)value;
+    }
+}
+
+/**
+ * @brief Checks a configuration against the memory budget, noting skipped ones on stderr.
+ * @param bytesPerElement The estimated memory per element, including container overhead.
+ */
+static inline bool Bench_fits(const BenchConfig* config, const char* container, size_t size, size_t bytesPerElement) {
+    if (size <= config->maxBytes / bytesPerElement) return true;
+    fprintf(stderr, "skipping %s with %zu elements of about %zu bytes: over --max-bytes\n",
+        container, size, bytesPerElement);
+    return false;
+}
+
+/**
+ * @brief Returns how many times a container of `size` elements is rebuilt so a measurement reaches `BENCH_MIN_OPS`.
+ */
+static inline size_t Bench_repetitions(size_t size) {
+    return size >= BENCH_MIN_OPS ? 1 : (BENCH_MIN_OPS + size - 1) / size;
+}
+
+/**
+ * @brief Returns the `i`-th distinct key; consecutive indices give scattered keys.
+ * @details Multiplying by an odd constant is a bijection on 32-bit integers.
+ */
+static inline uint32_t Bench_key(size_t i) {
+    return (uint32_t)i * 2654435761u;
+}
+
+/**
+ * @brief Maps `i` in `[0, size)` to a permutation of `[0, size)`.
+ * @details The multiplier is a prime that does not divide any power of ten.
+ */
+static inline size_t Bench_permute(size_t i, size_t size) {
+    return (size_t)(((uint64_t)i * 2654435761u) % size);
+}
+
+/**
+ * @brief Advances a xorshift64 generator, for random indices inside timed loops.
+ */
+static inline uint64_t Bench_random(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+ * @brief Stores `key` in the first bytes of `element`, leaving its padding as is.
+ * @return `element`.
+ */
+static inline void* Bench_element(unsigned char* element, uint32_t key) {
+    memcpy(element, &key, sizeof(key));
+    return element;
+}
+
+/**
+ * @brief Orders elements by their key, as the comparator of every benchmark.
+ */
+static inline int Bench_compare(const void* a, const void* b) {
+    uint32_t x, y;
+    memcpy(&x, a, sizeof(x));
+    memcpy(&y, b, sizeof(y));
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Returns the end of the batch starting at `i`.
+ */
+static inline size_t Bench_batchEnd(size_t i, size_t count, size_t batch) {
+    return count - i < batch ? count : i + batch;
+}
+
+/**
+ * @brief Records a batch of `ops` operations that started at `start` (a `Bench_now` reading).
+ */
+static inline void Bench_record(BenchTimer* timer, uint64_t start, size_t ops) {
+    uint64_t elapsed = Bench_now() - start;
+    if (timer->count == timer->capacity) {
+        size_t capacity = timer->capacity ? timer->capacity * 2 : 1024;
+        double* samples = realloc(timer->samples, capacity * sizeof(double));
+        if (!samples) {
+            fprintf(stderr, "out of memory recording samples\n");
+            exit(1);
+        }
+        timer->samples = samples;
+        timer->capacity = capacity;
+    }
+    timer->samples[timer->count++] = (double)elapsed / (double)ops;
+    timer->elapsed += elapsed;
+    timer->ops += ops;
+}
+
+/** @internal Orders doubles ascending, for `qsort`. */
+static inline int _Bench_compareDouble(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/** @internal Returns the `p`-th percentile (nearest rank) of sorted samples. */
+static inline double _Bench_percentile(const double* sorted, size_t count, double p) {
+    if (count == 0) return 0;
+    size_t rank = (size_t)(p / 100.0 * (double)count + 0.5);
+    return sorted[rank == 0 ? 0 : (rank > count ? count : rank) - 1];
+}
+
+/**
+ * @brief Prints the measurement as one JSON line and resets the timer for the next one.
+ * @param variant An extra distinguishing label such as a heap arity, or NULL for none.
+ */
+static inline void Bench_report(BenchTimer* timer, const char* container, const char* variant,
+    const char* op, size_t elementSize, size_t size)
+{
+    qsort(timer->samples, timer->count, sizeof(double), _Bench_compareDouble);
+    double seconds = (double)timer->elapsed / 1e9;
+
+    printf("{\"container\":\"%s\",", container);
+    if (variant) printf("\"variant\":\"%s\",", variant);
+    printf("\"op\":\"%s\",\"element_size\":%zu,\"size\":%zu,\"ops\":%zu,\"seconds\":%.6f,"
+        "\"ops_per_sec\":%.1f,\"p50_ns\":%.1f,\"p99_ns\":%.1f}\n",
+        op, elementSize, size, timer->ops, seconds,
+        seconds > 0 ? (double)timer->ops / seconds : 0.0,
+        _Bench_percentile(timer->samples, timer->count, 50),
+        _Bench_percentile(timer->samples, timer->count, 99));
+    fflush(stdout);
+
+    timer->count = 0;
+    timer->elapsed = 0;
+    timer->ops = 0;
+}
+
+/**
+ * @brief Frees the timer's samples.
+ */
+static inline void Bench_freeTimer(BenchTimer* timer) {
+    free(timer->samples);
+    *timer = (BenchTimer){ 0 };
+}
+
+/**
+ * @brief Exits with a message when a container cannot be built, so a broken run is never reported as a result.
+ */
+static inline void* Bench_check(void* container, const char* what) {
+    if (!container) {
+        fprintf(stderr, "failed to create %s\n", what);
+        exit(1);
+    }
+    return container;
+}
+
+#endif // BENCH_H
@@ -0,0 +1,84 @@
+#include "bench.h"
+#include "../include/heap.h"
+
+// The bound of the top-K benchmark, a typical leaderboard size.
+#define TOP_K 100
+
+/**
+ * @brief Times `Heap_push` of scattered keys into an empty heap, then `Heap_pop` until it is empty.
+ */
+static void bench_push_pop(size_t elementSize, size_t size, size_t arity) {
+    BenchTimer push = { 0 }, pop = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        Heap* heap = Bench_check(Heap_initWithArity(0, elementSize, Bench_compare, arity), "Heap");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Heap_push(heap, Bench_element(element, Bench_key(i)));
+            Bench_record(&push, start, ops);
+        }
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Heap_pop(heap, element);
+            Bench_record(&pop, start, ops);
+        }
+        Heap_destroy(heap);
+    }
+
+    char variant[16];
+    snprintf(variant, sizeof(variant), "%zu-ary", arity);
+    Bench_report(&push, "Heap", variant, "push", elementSize, size);
+    Bench_report(&pop, "Heap", variant, "pop", elementSize, size);
+    Bench_freeTimer(&push);
+    Bench_freeTimer(&pop);
+}
+
+/**
+ * @brief Times `Heap_offer` of a stream of scattered keys to a heap bounded at `k`, then `Heap_drainSorted`.
+ */
+static void bench_top_k(size_t elementSize, size_t size, size_t k) {
+    BenchTimer offer = { 0 }, drain = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    unsigned char* out = Bench_check(malloc(k * elementSize), "top-k output");
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        Heap* heap = Bench_check(Heap_initBounded(k, elementSize, Bench_compare), "Heap");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Heap_offer(heap, Bench_element(element, Bench_key(i)));
+            Bench_record(&offer, start, ops);
+        }
+        size_t kept = Heap_size(heap);
+        uint64_t start = Bench_now();
+        Heap_drainSorted(heap, out);
+        Bench_record(&drain, start, kept);
+        Heap_destroy(heap);
+    }
+
+    char variant[32];
+    snprintf(variant, sizeof(variant), "top-%zu", k);
+    Bench_report(&offer, "Heap", variant, "offer", elementSize, size);
+    Bench_report(&drain, "Heap", variant, "drainSorted", elementSize, size);
+    Bench_freeTimer(&offer);
+    Bench_freeTimer(&drain);
+    free(out);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    Bench_parseArgs(argc, argv, &config);
+
+    static const size_t arities[] = { 2, 4, 8 };
+    for (size_t e = 0; e < BENCH_ELEMENT_SIZE_COUNT; e++) {
+        size_t elementSize = BENCH_ELEMENT_SIZES[e];
+        for (size_t size = config.minSize; size <= config.maxSize; size *= 10) {
+            if (!Bench_fits(&config, "Heap", size, 3 * elementSize)) continue;
+            for (size_t a = 0; a < sizeof(arities) / sizeof(arities[0]); a++)
+                bench_push_pop(elementSize, size, arities[a]);
+            bench_top_k(elementSize, size, TOP_K);
+        }
+    }
+    return 0;
+}
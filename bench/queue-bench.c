@@ -0,0 +1,46 @@
+#include "bench.h"
+#include "../include/queue.h"
+
+/**
+ * @brief Times `Queue_enqueue` into a queue growing from empty, then `Queue_dequeueInto` until it is empty.
+ */
+static void bench_fifo(size_t elementSize, size_t size) {
+    BenchTimer enqueue = { 0 }, dequeue = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        Queue* queue = Bench_check(Queue_init(elementSize), "Queue");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Queue_enqueue(queue, Bench_element(element, Bench_key(i)));
+            Bench_record(&enqueue, start, ops);
+        }
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Queue_dequeueInto(queue, element);
+            Bench_record(&dequeue, start, ops);
+        }
+        Queue_destroy(queue);
+    }
+
+    Bench_report(&enqueue, "Queue", NULL, "enqueue", elementSize, size);
+    Bench_report(&dequeue, "Queue", NULL, "dequeue", elementSize, size);
+    Bench_freeTimer(&enqueue);
+    Bench_freeTimer(&dequeue);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    Bench_parseArgs(argc, argv, &config);
+
+    for (size_t e = 0; e < BENCH_ELEMENT_SIZE_COUNT; e++) {
+        size_t elementSize = BENCH_ELEMENT_SIZES[e];
+        for (size_t size = config.minSize; size <= config.maxSize; size *= 10) {
+            // The ring buffer rounds up to a power of two and doubles when full.
+            if (!Bench_fits(&config, "Queue", size, 4 * elementSize)) continue;
+            bench_fifo(elementSize, size);
+        }
+    }
+    return 0;
+}
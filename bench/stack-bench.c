@@ -0,0 +1,45 @@
+#include "bench.h"
+#include "../include/stack.h"
+
+/**
+ * @brief Times `Stack_push` onto a stack sized for `size` elements, then `Stack_popInto` until it is empty.
+ */
+static void bench_lifo(size_t elementSize, size_t size) {
+    BenchTimer push = { 0 }, pop = { 0 };
+    unsigned char element[BENCH_MAX_ELEMENT_SIZE] = { 0 };
+    for (size_t rep = Bench_repetitions(size); rep > 0; rep--) {
+        Stack* stack = Bench_check(Stack_init(elementSize, size), "Stack");
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Stack_push(stack, Bench_element(element, Bench_key(i)));
+            Bench_record(&push, start, ops);
+        }
+        for (size_t i = 0; i < size;) {
+            size_t end = Bench_batchEnd(i, size, BENCH_BATCH), ops = end - i;
+            uint64_t start = Bench_now();
+            for (; i < end; i++) Stack_popInto(stack, element);
+            Bench_record(&pop, start, ops);
+        }
+        Stack_destroy(stack);
+    }
+
+    Bench_report(&push, "Stack", NULL, "push", elementSize, size);
+    Bench_report(&pop, "Stack", NULL, "pop", elementSize, size);
+    Bench_freeTimer(&push);
+    Bench_freeTimer(&pop);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    Bench_parseArgs(argc, argv, &config);
+
+    for (size_t e = 0; e < BENCH_ELEMENT_SIZE_COUNT; e++) {
+        size_t elementSize = BENCH_ELEMENT_SIZES[e];
+        for (size_t size = config.minSize; size <= config.maxSize; size *= 10) {
+            if (!Bench_fits(&config, "Stack", size, elementSize)) continue;
+            bench_lifo(elementSize, size);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file allocator.h
+ * @brief A pluggable memory allocator interface for the library's containers.
+ *
+ * Every container allocates through `malloc` by default. Containers created
+ * with an `*_initWithAllocator` function instead route all of their memory,
+ * including the container struct itself, through the `DsaAllocator` given.
+ * The allocator is copied into the container, so only the memory `ctx` points
+ * to has to outlive it.
+ *
+ * An allocator whose `free` is NULL reclaims memory in bulk (see `Arena`).
+ * Containers using one skip the per-node walk in their destroy function, which
+ * then runs in O(1).
+ */
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include "common.h"
+
+/**
+ * @struct DsaAllocator
+ * @brief A set of allocation callbacks sharing a context pointer.
+ *
+ * Returned memory must be aligned for any object type. Sizes are passed back
+ * to `realloc` and `free` so that allocators need not record them.
+ */
+typedef struct DsaAllocator
+{
+    void* (*alloc)(void* ctx, size_t size);                                // Required. Returns NULL on failure.
+    void* (*realloc)(void* ctx, void* ptr, size_t oldSize, size_t newSize); // Optional; if NULL, alloc + copy + free is used.
+    void (*free)(void* ctx, void* ptr, size_t size);                       // Optional; if NULL, memory is never freed individually.
+    void* ctx;                                                             // Passed through to every callback.
+} DsaAllocator;
+
+#endif // ALLOCATOR_H
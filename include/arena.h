@@ -0,0 +1,78 @@
+/**
+ * @file arena.h
+ * @brief Public API for a bump-pointer arena allocator.
+ *
+ * An arena hands out memory by advancing a pointer through large chunks and
+ * never frees individual blocks. Everything allocated from it is released at
+ * once, either by `Arena_reset`, which keeps the chunks for reuse and runs in
+ * O(1), or by `Arena_destroy`.
+ *
+ * `Arena_allocator` adapts an arena to the `DsaAllocator` interface, so that
+ * containers can be built on it: their destroy functions then run in O(1),
+ * and a whole request's worth of containers is torn down with one reset.
+ * An arena is not thread-safe; give each worker thread its own.
+ */
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "common.h"
+#include "allocator.h"
+
+/**
+ * @struct Arena
+ * @brief An opaque struct representing the arena allocator.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the Arena only through the public API functions.
+ */
+typedef struct Arena Arena;
+
+/**
+ * @brief Initializes a new, empty arena.
+ * @details No chunk is allocated until the first `Arena_alloc`.
+ * @param chunkSize The size in bytes of each chunk obtained with `malloc`.
+ * Pass 0 for 64 KiB. Larger requests get a chunk of their own.
+ * @return A pointer to the newly created Arena, or `NULL` on allocation failure.
+ */
+DSA_API Arena* Arena_init(size_t chunkSize);
+
+/**
+ * @brief Releases every chunk, and the arena itself.
+ * @param arena A pointer to the arena to be destroyed. If NULL, the function does nothing.
+ */
+DSA_API void Arena_destroy(Arena* arena);
+
+/**
+ * @brief Allocates a block from the arena, aligned for any object type.
+ * @param arena A pointer to the arena.
+ * @param size The number of bytes to allocate.
+ * @return A pointer to an uninitialized block, or `NULL` if the arena is NULL
+ * or a new chunk cannot be allocated.
+ */
+DSA_API void* Arena_alloc(Arena* arena, size_t size);
+
+/**
+ * @brief Releases everything allocated from the arena in O(1).
+ * @details The chunks are kept and reused by later allocations. Every block
+ * handed out so far, and every container built on the arena, becomes invalid.
+ * @param arena A pointer to the arena.
+ */
+DSA_API void Arena_reset(Arena* arena);
+
+/**
+ * @brief Returns the number of bytes handed out since the last reset, including alignment padding.
+ * @param arena A constant pointer to the arena.
+ * @return The number of bytes, or 0 if the arena is NULL.
+ */
+DSA_API size_t Arena_bytesUsed(const Arena* arena);
+
+/**
+ * @brief Returns an allocator that draws from the arena.
+ * @details Its `free` is NULL, so containers never free individual blocks;
+ * its `realloc` grows the most recent block in place when there is room.
+ * @param arena A pointer to the arena, which must outlive every container using the allocator.
+ * @return The allocator.
+ */
+DSA_API DsaAllocator Arena_allocator(Arena* arena);
+
+#endif // ARENA_H
@@ -12,6 +12,9 @@
 #define ARRAYLIST_H
 
 #include "common.h"
+#include "allocator.h"
+#include "threadpool.h"
+#include "stats.h"
 
 /**
  * @struct ArrayList
@@ -23,16 +26,42 @@
  */
 typedef struct ArrayList ArrayList;
 
+/**
+ * @struct ArrayListPolicy
+ * @brief Controls how an array list resizes its storage.
+ *
+ * New lists start with `{ 2.0, true, 8 }`. Each list has its own policy, which
+ * can be changed at any time with `ArrayList_setPolicy`.
+ */
+typedef struct ArrayListPolicy
+{
+    double growthFactor;  // Capacity multiplier applied when the list is full. Must be > 1 (e.g. 1.5 or 2).
+    bool shrinkOnDelete;  // Whether `ArrayList_delete` halves the capacity once the list is a quarter full.
+    size_t minCapacity;   // The first allocation of an empty list, and the floor for automatic shrinking.
+} ArrayListPolicy;
+
 /**
  * @brief Initializes a new array list.
  * @details Creates and allocates memory for a new array list instance. It can be
  * initialized with a capacity of 0, in which case memory for elements
- * will be allocated upon the first insertion.
+ * will be allocated upon the first insertion. Capacities of up to 64 bytes
+ * of elements (16 ints, for example) are stored inside the list struct, so a
+ * small list never allocates a separate buffer.
  * @param capacity The initial storage capacity of the array list (number of elements).
  * @param dataSize The size in bytes of each element to be stored (e.g., sizeof(int)).
  * @return A pointer to the newly created array list, or NULL on allocation failure or invalid arguments.
  */
-ArrayList* ArrayList_init(size_t capacity, size_t dataSize);
+DSA_API ArrayList* ArrayList_init(size_t capacity, size_t dataSize);
+
+/**
+ * @brief Initializes a new array list whose struct and buffer come from `allocator`.
+ * @details Same as `ArrayList_init` otherwise. The allocator is copied.
+ * @param capacity The initial storage capacity of the array list (number of elements).
+ * @param dataSize The size in bytes of each element to be stored.
+ * @param allocator The allocator to use, or NULL for `malloc`.
+ * @return A pointer to the newly created array list, or NULL on allocation failure or invalid arguments.
+ */
+DSA_API ArrayList* ArrayList_initWithAllocator(size_t capacity, size_t dataSize, const DsaAllocator* allocator);
 
 /**
  * @brief Frees all memory associated with the array list.
@@ -40,7 +69,7 @@ ArrayList* ArrayList_init(size_t capacity, size_t dataSize);
  * The pointer to the array list becomes invalid after this call.
  * @param arrayList A pointer to the array list to be destroyed.
  */
-void ArrayList_destroy(ArrayList* arrayList);
+DSA_API void ArrayList_destroy(ArrayList* arrayList);
 
 /**
  * @brief Appends an element to the end of the array list.
@@ -51,21 +80,22 @@ void ArrayList_destroy(ArrayList* arrayList);
  * @return `STATUS_OK` on success.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if array list or element is NULL.
  * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ * @return `STATUS_ERR_OVERFLOW` if the list cannot grow further.
  */
-STATUS ArrayList_insert(ArrayList* arrayList, void* element);
+DSA_API STATUS ArrayList_insert(ArrayList* arrayList, void* element);
 
 /**
  * @brief Deletes an element at a specific index.
  * @details Removes the element at the given index and shifts all subsequent elements
  * to the left. The list may shrink its capacity if the size becomes
- * sufficiently small.
+ * sufficiently small, unless shrinking is disabled by its policy.
  * @param arrayList A pointer to the array list.
  * @param index The zero-based index of the element to delete.
  * @return `STATUS_OK` on success.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if the index is out of bounds.
  * @return `STATUS_ERR_UNDERFLOW` if the array list is empty.
  */
-STATUS ArrayList_delete(ArrayList* arrayList, size_t index);
+DSA_API STATUS ArrayList_delete(ArrayList* arrayList, size_t index);
 
 /**
  * @brief Searches for an element using a custom comparison function.
@@ -78,7 +108,7 @@ STATUS ArrayList_delete(ArrayList* arrayList, size_t index);
  * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not found.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if any pointer arguments are NULL.
  */
-STATUS ArrayList_search(ArrayList* arr, void* key, size_t* index, int (*cmp)(const void*, const void*));
+DSA_API STATUS ArrayList_search(ArrayList* arr, void* key, size_t* index, int (*cmp)(const void*, const void*));
 
 /**
  * @brief Retrieves a copy of an element from a specific index.
@@ -87,7 +117,7 @@ STATUS ArrayList_search(ArrayList* arr, void* key, size_t* index, int (*cmp)(con
  * @param dataOut A pointer to a memory location where the element's data will be copied.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` on failure or if the index is out of bounds.
  */
-STATUS ArrayList_get(ArrayList* arrayList, size_t index, void* dataOut);
+DSA_API STATUS ArrayList_get(ArrayList* arrayList, size_t index, void* dataOut);
 
 /**
  * @brief Updates the element at a specific index with new data.
@@ -96,7 +126,7 @@ STATUS ArrayList_get(ArrayList* arrayList, size_t index, void* dataOut);
  * @param element A pointer to the new element data that will overwrite the existing data at the index.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` on failure or if the index is out of bounds.
  */
-STATUS ArrayList_set(ArrayList* arrayList, size_t index, void* element);
+DSA_API STATUS ArrayList_set(ArrayList* arrayList, size_t index, void* element);
 
 /**
  * @brief Iterates over each element and applies a callback function.
@@ -105,20 +135,334 @@ STATUS ArrayList_set(ArrayList* arrayList, size_t index, void* element);
  * receives a pointer to the element's data within the array list.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if array list or callback is NULL.
  */
-STATUS ArrayList_forEach(ArrayList* arrayList, void (*callBack)(void*));
+DSA_API STATUS ArrayList_forEach(ArrayList* arrayList, void (*callBack)(void*));
+
+/**
+ * @brief Iterates over the elements in order with a context pointer, stopping early on request.
+ * @param arrayList A pointer to the array list.
+ * @param callBack Called with a pointer to each element and `ctx`. Returning `false` stops the iteration.
+ * @param ctx An opaque pointer passed through to `callBack`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if array list or callback is NULL.
+ */
+DSA_API STATUS ArrayList_forEachCtx(ArrayList* arrayList, bool (*callBack)(void* element, void* ctx), void* ctx);
 
 /**
  * @brief Returns the number of elements currently in the array list.
  * @param arrayList A pointer to the array list.
  * @return The number of elements as a `size_t`. Returns 0 if the array list is NULL.
  */
-size_t ArrayList_size(const ArrayList* arrayList);
+DSA_API size_t ArrayList_size(const ArrayList* arrayList);
 
 /**
  * @brief Returns the total number of elements the array list can hold before resizing.
  * @param arrayList A pointer to the array list.
  * @return The current capacity of the array list as a `size_t`. Returns 0 if the array list is NULL.
  */
-size_t ArrayList_capacity(const ArrayList* arrayList);
+DSA_API size_t ArrayList_capacity(const ArrayList* arrayList);
+
+/**
+ * @brief Ensures the array list can hold at least `capacity` elements without reallocating.
+ * @details Allocates exactly `capacity` elements when growing; never shrinks.
+ * @param arrayList A pointer to the array list.
+ * @param capacity The number of elements the list must be able to hold.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if the array list is NULL.
+ * @return `STATUS_ERR_OVERFLOW` if the requested size in bytes overflows.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails. The list is unchanged.
+ */
+DSA_API STATUS ArrayList_reserve(ArrayList* arrayList, size_t capacity);
+
+/**
+ * @brief Reduces the capacity to the current size, releasing unused memory.
+ * @details An empty list releases its buffer entirely.
+ * @param arrayList A pointer to the array list.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if the array list is NULL.
+ * @return `STATUS_ERR_ALLOC` if reallocation fails. The list is unchanged.
+ */
+DSA_API STATUS ArrayList_shrinkToFit(ArrayList* arrayList);
+
+/**
+ * @brief Removes all elements while keeping the allocated capacity.
+ * @param arrayList A pointer to the array list.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if the array list is NULL.
+ */
+DSA_API STATUS ArrayList_clear(ArrayList* arrayList);
+
+/**
+ * @brief Replaces the resizing policy of the array list.
+ * @details Takes effect from the next resize; the current capacity is left alone.
+ * @param arrayList A pointer to the array list.
+ * @param policy A pointer to the new policy, which is copied.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL or `growthFactor` is not greater than 1.
+ */
+DSA_API STATUS ArrayList_setPolicy(ArrayList* arrayList, const ArrayListPolicy* policy);
+
+/**
+ * @brief Retrieves a copy of the resizing policy of the array list.
+ * @param arrayList A constant pointer to the array list.
+ * @param policyOut A pointer that receives the current policy.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL.
+ */
+DSA_API STATUS ArrayList_getPolicy(const ArrayList* arrayList, ArrayListPolicy* policyOut);
+
+/**
+ * @brief Appends `count` elements from a contiguous array in one step.
+ * @details Grows the storage at most once and copies the array with a single `memcpy`.
+ * @param arrayList A pointer to the array list.
+ * @param elements A pointer to `count` contiguous elements.
+ * @param count The number of elements to append.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if array list is NULL, or elements is NULL with a non-zero count.
+ * @return `STATUS_ERR_OVERFLOW` if the list cannot grow that far.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails. The list is unchanged.
+ */
+DSA_API STATUS ArrayList_insertMany(ArrayList* arrayList, const void* elements, size_t count);
+
+/**
+ * @brief Inserts an element at `index`, shifting later elements to the right.
+ * @param arrayList A pointer to the array list.
+ * @param index The zero-based position of the new element; `ArrayList_size` appends.
+ * @param element A pointer to the element data to be copied into the list.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL or the index is greater than the size.
+ * @return `STATUS_ERR_OVERFLOW` if the list cannot grow further.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ */
+DSA_API STATUS ArrayList_insertAt(ArrayList* arrayList, size_t index, const void* element);
+
+/**
+ * @brief Removes the elements in the half-open range `[begin, end)`.
+ * @details Later elements are shifted down with a single `memmove`. The list
+ * may then shrink as described for `ArrayList_delete`.
+ * @param arrayList A pointer to the array list.
+ * @param begin The zero-based index of the first element to remove.
+ * @param end One past the index of the last element to remove.
+ * @return `STATUS_OK` on success (an empty range is a no-op).
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if array list is NULL, `begin > end`, or `end` exceeds the size.
+ */
+DSA_API STATUS ArrayList_removeRange(ArrayList* arrayList, size_t begin, size_t end);
+
+/**
+ * @brief Removes every element for which `pred` returns true, in a single pass.
+ * @details The relative order of the remaining elements is preserved. Each run
+ * of kept elements is moved with one `memmove`. The list may then shrink as
+ * described for `ArrayList_delete`.
+ * @param arrayList A pointer to the array list.
+ * @param pred A function called once per element; returns true to remove it.
+ * @param removedOut Receives the number of removed elements. May be NULL.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if array list or pred is NULL.
+ */
+DSA_API STATUS ArrayList_removeIf(ArrayList* arrayList, bool (*pred)(const void*), size_t* removedOut);
+
+/* ------------------------------- Sorting & Searching ------------------------------- */
+
+/**
+ * @brief Sorts the list in place in O(n log n) worst-case time (introsort).
+ * @details Quicksort with median-of-three pivots, falling back to heapsort if
+ * the recursion gets too deep and to insertion sort for short ranges. Elements
+ * of 4 or 8 bytes are moved as single words rather than byte by byte. The sort
+ * is not stable.
+ * @param arrayList A pointer to the array list.
+ * @param cmp The comparison function, returning a negative value, zero or a
+ * positive value when the first element is less than, equal to or greater than the second.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if array list or cmp is NULL.
+ */
+DSA_API STATUS ArrayList_sort(ArrayList* arrayList, int (*cmp)(const void*, const void*));
+
+/**
+ * @brief Returns the index of the first element not ordered before `key`, in O(log n).
+ * @details The list must be sorted by `cmp`.
+ * @param arrayList A constant pointer to the array list.
+ * @param key A pointer to the key to compare elements against.
+ * @param cmp The comparison function the list is sorted by.
+ * @return An index in `[0, ArrayList_size(list)]`, or 0 if arguments are invalid.
+ */
+DSA_API size_t ArrayList_lowerBound(const ArrayList* arrayList, const void* key, int (*cmp)(const void*, const void*));
+
+/**
+ * @brief Finds an element equal to `key` by binary search, in O(log n).
+ * @details The list must be sorted by `cmp`. When several elements are equal
+ * to the key, the index of the first one is returned.
+ * @param arrayList A constant pointer to the array list.
+ * @param key A pointer to the key to search for.
+ * @param index Receives the index of the element found.
+ * @param cmp The comparison function the list is sorted by.
+ * @return `STATUS_OK` if the key is found.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not found.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if any pointer arguments are NULL.
+ */
+DSA_API STATUS ArrayList_binarySearch(const ArrayList* arrayList, const void* key, size_t* index, int (*cmp)(const void*, const void*));
+
+/**
+ * @brief Inserts an element at its sorted position, keeping the list ordered.
+ * @details The list must be sorted by `cmp`. The element goes after any equal
+ * elements. Finding the position costs O(log n) comparisons; making room
+ * shifts the later elements with one `memmove`.
+ * @param arrayList A pointer to the array list.
+ * @param element A pointer to the element data to be copied into the list.
+ * @param cmp The comparison function the list is sorted by.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if any pointer arguments are NULL.
+ * @return `STATUS_ERR_OVERFLOW` if the list cannot grow further.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ */
+DSA_API STATUS ArrayList_insertSorted(ArrayList* arrayList, const void* element, int (*cmp)(const void*, const void*));
+
+/**
+ * @brief Finds the first element equal to a 32-bit integer key, without a comparison callback.
+ * @details Scans the list with SIMD compares (AVX2, SSE2 or NEON, whichever
+ * the library was compiled for, otherwise a plain loop). For lists of
+ * `int32_t` or `uint32_t` elements.
+ * @param arrayList A constant pointer to an array list whose `dataSize` is 4.
+ * @param key The value to search for.
+ * @param index Receives the index of the first matching element.
+ * @return `STATUS_OK` if the key is found.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not found.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL or the elements are not 4 bytes.
+ */
+DSA_API STATUS ArrayList_findInt32(const ArrayList* arrayList, int32_t key, size_t* index);
+
+/**
+ * @brief Finds the first element equal to a 64-bit integer key, without a comparison callback.
+ * @details Same as `ArrayList_findInt32`, for lists whose `dataSize` is 8.
+ */
+DSA_API STATUS ArrayList_findInt64(const ArrayList* arrayList, int64_t key, size_t* index);
+
+/* --------------------------------- Parallel Algorithms --------------------------------- */
+
+/**
+ * @brief Calls `callBack` on every element, spread over the threads of a pool.
+ * @details Elements are visited in unspecified order and concurrently, so
+ * `callBack` must not touch other elements or unsynchronized shared state.
+ * The list must not change size during the call.
+ * @param arrayList A pointer to the array list.
+ * @param pool The pool to run on, or NULL for `ThreadPool_default()`.
+ * @param callBack Called with a pointer to each element and `ctx`.
+ * @param ctx An opaque pointer passed through to `callBack`.
+ * @param grain The number of consecutive elements handed to a thread at once, or 0 to pick one.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if array list or callBack is NULL.
+ * @return `STATUS_ERR_ALLOC` if the default pool cannot be created.
+ */
+DSA_API STATUS ArrayList_parallelForEach(ArrayList* arrayList, ThreadPool* pool,
+    void (*callBack)(void* element, void* ctx), void* ctx, size_t grain);
+
+/**
+ * @brief Folds every element into a single value, spread over the threads of a pool.
+ * @details The list is cut into blocks of `grain` elements. Each block is
+ * folded into its own copy of the initial `result` with `accumulate`, then the
+ * blocks' partial results are folded into `result` in list order with
+ * `combine`. `combine` must therefore be associative, and the initial value an
+ * identity for it; the order of operations depends only on `grain`, so a sum of
+ * doubles is reproducible from run to run.
+ * @param arrayList A constant pointer to the array list.
+ * @param pool The pool to run on, or NULL for `ThreadPool_default()`.
+ * @param result On entry, the identity (e.g. 0 for a sum); on success, the result.
+ * @param resultSize The size in bytes of `result`.
+ * @param accumulate Folds one element into a partial result.
+ * @param combine Folds a block's partial result into `result`.
+ * @param ctx An opaque pointer passed through to `accumulate` and `combine`.
+ * @param grain The number of elements per block, or 0 to pick one.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL or resultSize is 0.
+ * @return `STATUS_ERR_ALLOC` if the partial results or the default pool cannot be allocated.
+ * @return `STATUS_ERR_OVERFLOW` if the partial results would not fit in memory.
+ */
+DSA_API STATUS ArrayList_parallelReduce(const ArrayList* arrayList, ThreadPool* pool, void* result, size_t resultSize,
+    void (*accumulate)(void* partial, const void* element, void* ctx),
+    void (*combine)(void* result, const void* partial, void* ctx), void* ctx, size_t grain);
+
+/**
+ * @brief Sorts the list in place with a parallel merge sort.
+ * @details One run per thread is sorted with `ArrayList_sort`'s introsort,
+ * then runs are merged pairwise through a scratch buffer. Each merge round is
+ * itself cut into equal slices of output, located by binary search, so every
+ * thread stays busy until the last round. Short lists are sorted serially.
+ * The sort is not stable. `cmp` is called concurrently.
+ * @param arrayList A pointer to the array list.
+ * @param pool The pool to run on, or NULL for `ThreadPool_default()`.
+ * @param cmp The comparison function, as for `ArrayList_sort`.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if array list or cmp is NULL.
+ * @return `STATUS_ERR_ALLOC` if the scratch buffer or the default pool cannot be allocated. The list is unchanged.
+ */
+DSA_API STATUS ArrayList_parallelSort(ArrayList* arrayList, ThreadPool* pool, int (*cmp)(const void*, const void*));
+
+/* --------------------------------- Snapshots --------------------------------- */
+
+/**
+ * @brief Writes the list to a file descriptor as a binary snapshot.
+ * @details The snapshot is a 64-byte header followed by the elements exactly
+ * as they are laid out in memory, so it can only be read back on a machine
+ * with the same byte order and element layout. Writing starts at the current
+ * file position, so several snapshots can follow each other in one file.
+ * @param arrayList A constant pointer to the array list.
+ * @param fd A file descriptor open for writing.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if array list is NULL or fd is negative.
+ * @return `STATUS_ERR_IO` if a write fails.
+ */
+DSA_API STATUS ArrayList_save(const ArrayList* arrayList, int fd);
+
+/**
+ * @brief Reads a list back from a snapshot at the current position of a file descriptor.
+ * @details The element size is taken from the snapshot. Snapshots saved by
+ * `Heap_save` and `AVLTree_save` load too, as their array of elements.
+ * @param fd A file descriptor open for reading.
+ * @return A new list, or `NULL` if the snapshot cannot be read, is invalid or memory runs out.
+ */
+DSA_API ArrayList* ArrayList_load(int fd);
+
+/**
+ * @brief Creates a list whose storage is a zero-copy mapping of a snapshot file.
+ * @details The file is mapped privately with `mmap`, so startup costs no more than
+ * the page faults of the elements actually touched. Elements may be read and
+ * modified in place (for example by `ArrayList_set` or `ArrayList_sort`); the
+ * changes are private and never written back to the file. The first call that
+ * needs more capacity copies the elements to memory from the list's allocator
+ * and drops the mapping. The snapshot must start at offset 0 of the file.
+ * @param path The path of a file written by one of the `*_save` functions.
+ * @param dataSize The expected element size; the snapshot's must match.
+ * @return A new list, or `NULL` if the file cannot be mapped, is invalid or has a different element size.
+ */
+DSA_API ArrayList* ArrayList_mapFile(const char* path, size_t dataSize);
+
+/* --------------------------------- Instrumentation --------------------------------- */
+
+/**
+ * @brief Copies the list's work counters (see stats.h).
+ * @details Counts reallocations, the bytes they and element shifts move, and
+ * the comparisons made by `ArrayList_search`, `ArrayList_lowerBound`,
+ * `ArrayList_binarySearch` and `ArrayList_insertSorted`. Sorting is not counted.
+ * All counters read 0 unless the library was built with `DSA_STATS`.
+ * @param arrayList A constant pointer to the array list.
+ * @param statsOut Receives the counters.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if an argument is NULL.
+ */
+DSA_API STATUS ArrayList_getStats(const ArrayList* arrayList, DsaStats* statsOut);
+
+/* --------------------------------- Borrowed Access --------------------------------- */
+
+/**
+ * @brief Returns a pointer to the element at `index`, without copying it.
+ * @details The element may be read or modified in place. The pointer stays
+ * valid until the next call that changes the list's size or capacity (any
+ * insert, delete, remove, reserve, shrinkToFit or clear) or destroys it.
+ * @param arrayList A constant pointer to the array list.
+ * @param index The zero-based index of the element.
+ * @return A pointer into the list's storage, or NULL if the list is NULL or the index is out of bounds.
+ */
+DSA_API void* ArrayList_at(const ArrayList* arrayList, size_t index);
+
+/**
+ * @brief Returns a pointer to the list's contiguous storage.
+ * @details Elements `0 .. ArrayList_size(list) - 1` are laid out back to back,
+ * `dataSize` bytes apart. Invalidated under the same rules as `ArrayList_at`.
+ * @param arrayList A constant pointer to the array list.
+ * @return A pointer to the first element, or NULL if the list is NULL or its capacity is 0.
+ */
+DSA_API void* ArrayList_data(const ArrayList* arrayList);
 
 #endif // ARRAYLIST_H
\ No newline at end of file
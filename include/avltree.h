@@ -12,6 +12,8 @@
 #define AVLTREE_H
 
 #include "common.h"
+#include "allocator.h"
+#include "stats.h"
 
 /**
  * @struct AVLTree
@@ -22,6 +24,31 @@
  */
 typedef struct AVLTree AVLTree;
 
+/**
+ * @brief An upper bound on the number of nodes on any root-to-leaf path.
+ * An AVL tree of height h holds at least F(h+3)-1 nodes (F = Fibonacci), so a
+ * tree whose nodes fill a 64-bit address space is less than 92 levels deep.
+ * This bounds the explicit stacks used instead of recursion.
+ */
+#define AVLTREE_MAX_DEPTH 96
+
+/**
+ * @struct AVLTreeIterator
+ * @brief A bidirectional in-order cursor over an AVL tree.
+ *
+ * The iterator is a plain value that the caller allocates (typically on the
+ * stack); it owns no memory and needs no cleanup. It records the path from the
+ * root to the current element, so stepping is amortized O(1) and never
+ * allocates. Any insertion into or deletion from the tree invalidates it.
+ * The fields are private.
+ */
+typedef struct AVLTreeIterator
+{
+    const AVLTree* tree;                        // The tree being iterated.
+    struct AVLNode* path[AVLTREE_MAX_DEPTH];    // Nodes from the root down to the current element.
+    size_t depth;                               // Length of `path`; 0 once the iterator is exhausted.
+} AVLTreeIterator;
+
 /**
  * @brief Initializes a new, empty AVL tree.
  * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
@@ -32,15 +59,40 @@ typedef struct AVLTree AVLTree;
  * - A positive value if the first element is greater than the second.
  * @return A pointer to the newly created AVLTree, or `NULL` on allocation failure or invalid arguments.
  */
-AVLTree* AVLTree_init(size_t dataSize, int (*cmp)(const void *, const void *));
+DSA_API AVLTree* AVLTree_init(size_t dataSize, int (*cmp)(const void *, const void *));
+
+/**
+ * @brief Initializes a new, empty AVL tree whose struct and nodes come from `allocator`.
+ * @details With a bulk allocator such as an `Arena`, destroying the tree does
+ * not visit its nodes. The allocator is copied. Set operations only combine
+ * trees that use the same allocator.
+ * @param dataSize The size in bytes of each element to be stored.
+ * @param cmp The comparison function, as for `AVLTree_init`.
+ * @param allocator The allocator to use, or NULL for `malloc`.
+ * @return A pointer to the newly created AVLTree, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API AVLTree* AVLTree_initWithAllocator(size_t dataSize, int (*cmp)(const void *, const void *), const DsaAllocator* allocator);
+
+/**
+ * @brief Initializes a new, empty AVL tree whose nodes come from a private pool.
+ * @details Nodes are carved from large chunks (see pool.h) instead of being
+ * allocated one by one, which keeps them close together in memory. Destroying
+ * the tree releases whole chunks without visiting each node.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, as for `AVLTree_init`.
+ * @param nodesPerChunk The number of nodes per chunk, or 0 for a default of about 64 KiB per chunk.
+ * @return A pointer to the newly created AVLTree, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API AVLTree* AVLTree_initPooled(size_t dataSize, int (*cmp)(const void *, const void *), size_t nodesPerChunk);
 
 /**
  * @brief Frees all memory associated with the AVL tree.
- * @details Recursively deallocates each node, the data within each node, and the
- * tree structure itself. The tree pointer becomes invalid after this call.
+ * @details Recursively deallocates each node (node and element share one
+ * allocation) and the tree structure itself. For a pooled tree, the pool's
+ * chunks are released directly. The tree pointer becomes invalid after this call.
  * @param tree A pointer to the AVL tree to be destroyed.
  */
-void AVLTree_destroy(AVLTree* bst);
+DSA_API void AVLTree_destroy(AVLTree* bst);
 
 /**
  * @brief Inserts an element into the AVL tree, maintaining the balance property.
@@ -53,7 +105,7 @@ void AVLTree_destroy(AVLTree* bst);
  * @return `STATUS_ERR_DUPLICATE_KEY` if an element with the same key already exists.
  * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
  */
-STATUS AVLTree_insert(AVLTree* avl, void* element);
+DSA_API STATUS AVLTree_insert(AVLTree* avl, void* element);
 
 /**
  * @brief Deletes an element with a specific key from the AVL tree.
@@ -65,7 +117,48 @@ STATUS AVLTree_insert(AVLTree* avl, void* element);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if tree or key is NULL.
  * @return `STATUS_ERR_KEY_NOT_FOUND` if no element with the given key is found.
  */
-STATUS AVLTree_delete(AVLTree* bst, void* key);
+DSA_API STATUS AVLTree_delete(AVLTree* bst, void* key);
+
+/**
+ * @brief Deletes every element whose key is among `count` keys, in one pass.
+ * @details Costs O(k log(n/k + 1)) for k keys instead of the O(k log n) of k
+ * separate deletes, and at most one rebalancing per joined subtree. Batches
+ * of at least an eighth of the tree instead rebuild it in one O(n + k) pass. Keys
+ * given in non-decreasing order are used in place; otherwise they are
+ * sorted into a temporary copy. Keys not in the tree and repeated keys are
+ * ignored. Elements are always removed outright, even in lazy-delete mode.
+ * @param tree A pointer to the AVL tree.
+ * @param keys An array of `count` keys, each of the tree's `dataSize` bytes.
+ * @param count The number of keys.
+ * @param deletedOut If not NULL, receives the number of elements deleted.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if tree is NULL, or keys is NULL while count is not 0.
+ * @return `STATUS_ERR_OVERFLOW` if `count` keys would not fit in memory. The tree is unchanged.
+ * @return `STATUS_ERR_ALLOC` if unsorted keys cannot be copied. The tree is unchanged.
+ */
+DSA_API STATUS AVLTree_deleteMany(AVLTree* tree, const void* keys, size_t count, size_t* deletedOut);
+
+/**
+ * @brief Enables or disables lazy deletion.
+ * @details In lazy mode `AVLTree_delete` only marks the element's node as a
+ * tombstone, in O(log n) with no rotations, and inserting the same key again
+ * revives the node. Tombstones are invisible to every other function. Once
+ * they make up more than `maxTombstoneRatio` of the tree's nodes, the tree is
+ * compacted: tombstones are freed and the tree is rebuilt balanced in O(n),
+ * without allocating. Split, join and the set operations compact first.
+ * @param tree A pointer to the AVL tree.
+ * @param maxTombstoneRatio The share of dead nodes, in (0, 1), that triggers compaction; 0 disables
+ * lazy deletion and compacts the tree now.
+ * @return `STATUS_OK`, or `STATUS_ERR_INVALID_ARGUMENT` if tree is NULL or the ratio is outside [0, 1).
+ */
+DSA_API STATUS AVLTree_setLazyDelete(AVLTree* tree, double maxTombstoneRatio);
+
+/**
+ * @brief Frees every tombstone now and rebuilds the tree perfectly balanced, in O(n).
+ * @param tree A pointer to the AVL tree.
+ * @return `STATUS_OK`, or `STATUS_ERR_INVALID_ARGUMENT` if tree is NULL.
+ */
+DSA_API STATUS AVLTree_compact(AVLTree* tree);
 
 /**
  * @brief Searches for an element with a specific key in the AVL tree.
@@ -75,7 +168,7 @@ STATUS AVLTree_delete(AVLTree* bst, void* key);
  * @return A pointer to the data of the found element within the tree.
  * @return `NULL` if the key is not found or if arguments are invalid.
  */
-void* AVLTree_search(AVLTree* bst, void* key);
+DSA_API void* AVLTree_search(AVLTree* bst, void* key);
 
 /**
  * @brief Traverses the tree in-order (Left, Root, Right) and applies a callback.
@@ -84,7 +177,7 @@ void* AVLTree_search(AVLTree* bst, void* key);
  * @param callback A function to be called for each node's data.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT`.
  */
-STATUS AVLTree_traverseInorder(AVLTree* bst, void (*callback)(void *));
+DSA_API STATUS AVLTree_traverseInorder(AVLTree* bst, void (*callback)(void *));
 
 /**
  * @brief Traverses the tree in pre-order (Root, Left, Right) and applies a callback.
@@ -92,7 +185,7 @@ STATUS AVLTree_traverseInorder(AVLTree* bst, void (*callback)(void *));
  * @param callback A function to be called for each node's data.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT`.
  */
-STATUS AVLTree_traversePreorder(AVLTree* bst, void (*callback)(void *));
+DSA_API STATUS AVLTree_traversePreorder(AVLTree* bst, void (*callback)(void *));
 
 /**
  * @brief Traverses the tree in post-order (Left, Right, Root) and applies a callback.
@@ -100,6 +193,245 @@ STATUS AVLTree_traversePreorder(AVLTree* bst, void (*callback)(void *));
  * @param callback A function to be called for each node's data.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT`.
  */
-STATUS AVLTree_traversePostorder(AVLTree* bst, void (*callback)(void *));
+DSA_API STATUS AVLTree_traversePostorder(AVLTree* bst, void (*callback)(void *));
+
+/**
+ * @brief Traverses the tree in-order with a context pointer, stopping early on request.
+ * @param tree A pointer to the AVL tree.
+ * @param callback Called with each element's data and `ctx`. Returning `false` stops the traversal.
+ * @param ctx An opaque pointer passed through to `callback`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT`.
+ */
+DSA_API STATUS AVLTree_traverseInorderCtx(AVLTree* tree, bool (*callback)(void* element, void* ctx), void* ctx);
+
+/**
+ * @brief Traverses the tree in pre-order with a context pointer, stopping early on request.
+ * @details Same arguments and return values as `AVLTree_traverseInorderCtx`.
+ */
+DSA_API STATUS AVLTree_traversePreorderCtx(AVLTree* tree, bool (*callback)(void* element, void* ctx), void* ctx);
+
+/**
+ * @brief Traverses the tree in post-order with a context pointer, stopping early on request.
+ * @details Same arguments and return values as `AVLTree_traverseInorderCtx`.
+ */
+DSA_API STATUS AVLTree_traversePostorderCtx(AVLTree* tree, bool (*callback)(void* element, void* ctx), void* ctx);
+
+/* ----------------------------------------Order Statistics & Ranges---------------------------------------- */
+
+/**
+ * @brief Returns the number of elements in the tree in O(1).
+ * @param tree A constant pointer to the AVL tree.
+ * @return The number of elements, or 0 if the tree is NULL.
+ */
+DSA_API size_t AVLTree_size(const AVLTree* tree);
+
+/**
+ * @brief Finds the smallest element that is not ordered before `key`.
+ * @param tree A constant pointer to the AVL tree.
+ * @param key A pointer to the key, compared with the tree's comparator.
+ * @return A pointer to the element's data within the tree, or `NULL` if every element is smaller or arguments are invalid.
+ */
+DSA_API void* AVLTree_lowerBound(const AVLTree* tree, const void* key);
+
+/**
+ * @brief Finds the smallest element that is ordered strictly after `key`.
+ * @param tree A constant pointer to the AVL tree.
+ * @param key A pointer to the key, compared with the tree's comparator.
+ * @return A pointer to the element's data within the tree, or `NULL` if no element is larger or arguments are invalid.
+ */
+DSA_API void* AVLTree_upperBound(const AVLTree* tree, const void* key);
+
+/**
+ * @brief Counts the elements ordered strictly before `key` in O(log n).
+ * @details For a key present in the tree, this is its zero-based position in sorted order.
+ * @param tree A constant pointer to the AVL tree.
+ * @param key A pointer to the key, which need not be present.
+ * @return The number of smaller elements, or 0 if arguments are invalid.
+ */
+DSA_API size_t AVLTree_rank(const AVLTree* tree, const void* key);
+
+/**
+ * @brief Returns the k-th smallest element in O(log n).
+ * @param tree A constant pointer to the AVL tree.
+ * @param k The zero-based position in sorted order.
+ * @return A pointer to the element's data within the tree, or `NULL` if `k >= AVLTree_size(tree)` or the tree is NULL.
+ */
+DSA_API void* AVLTree_select(const AVLTree* tree, size_t k);
+
+/**
+ * @brief Counts the elements in the closed range `[lo, hi]` in O(log n).
+ * @param tree A constant pointer to the AVL tree.
+ * @param lo A pointer to the lower bound key.
+ * @param hi A pointer to the upper bound key.
+ * @return The number of elements in range, or 0 if `lo` is ordered after `hi` or arguments are invalid.
+ */
+DSA_API size_t AVLTree_countRange(const AVLTree* tree, const void* lo, const void* hi);
+
+/**
+ * @brief Visits the elements in the closed range `[lo, hi]` in ascending order.
+ * @details Costs O(log n) to find the first element plus amortized O(1) per
+ * element visited. The tree must not be modified during the visit.
+ * @param tree A constant pointer to the AVL tree.
+ * @param lo A pointer to the lower bound key, or NULL to start from the smallest element.
+ * @param hi A pointer to the upper bound key, or NULL to continue to the largest element.
+ * @param visit Called with each element's data and `ctx`. Returning `false` stops the visit.
+ * @param ctx An opaque pointer passed through to `visit`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if tree or visit is NULL.
+ */
+DSA_API STATUS AVLTree_visitRange(const AVLTree* tree, const void* lo, const void* hi,
+    bool (*visit)(void* element, void* ctx), void* ctx);
+
+/* -------------------------------------Bulk Build & Set Operations------------------------------------- */
+
+/**
+ * @brief Builds a perfectly balanced tree from strictly increasing elements in O(n).
+ * @details No comparisons are made beyond the n-1 needed to validate the order,
+ * and no rotations are performed.
+ * @param data A pointer to `count` contiguous elements, sorted by `cmp` with no duplicates.
+ * @param count The number of elements.
+ * @param dataSize The size in bytes of each element.
+ * @param cmp The comparison function, as for `AVLTree_init`.
+ * @return A pointer to the new tree, or `NULL` if the input is not strictly
+ * increasing, an argument is invalid, or memory allocation fails.
+ */
+DSA_API AVLTree* AVLTree_buildFromSorted(const void* data, size_t count, size_t dataSize, int (*cmp)(const void *, const void *));
+
+/**
+ * @brief Splits the tree around `key` in O(log n).
+ * @details Afterwards `tree` holds the elements ordered before `key`, and a new
+ * tree returned through `rightOut` holds the rest (including an element equal
+ * to `key`). Nodes are moved, not copied.
+ * @param tree A pointer to a non-pooled AVL tree.
+ * @param key A pointer to the key to split at, which need not be present.
+ * @param rightOut Receives the new tree, which the caller must destroy.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL or the tree is pooled.
+ * @return `STATUS_ERR_ALLOC` if the new tree cannot be allocated. Nothing is changed.
+ */
+DSA_API STATUS AVLTree_split(AVLTree* tree, const void* key, AVLTree** rightOut);
+
+/**
+ * @brief Moves every element of `right` into `left` in O(log n).
+ * @details Every element of `left` must be ordered before every element of
+ * `right`. `right` is left empty but valid.
+ * @param left A pointer to the destination tree.
+ * @param right A pointer to the source tree.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL, the trees are the same tree,
+ * they differ in data size, comparator or allocator, either is pooled, or the ranges overlap.
+ */
+DSA_API STATUS AVLTree_join(AVLTree* left, AVLTree* right);
+
+/**
+ * @brief Replaces `dst` with the union of `dst` and `src`, consuming `src`.
+ * @details Runs in O(m log(n/m + 1)) for trees of sizes m <= n. Nodes are
+ * relinked, not copied; where both trees hold an equal element, the one from
+ * `dst` is kept. `src` is left empty but valid.
+ * @param dst A pointer to the destination tree.
+ * @param src A pointer to the source tree.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL, the trees are the same tree,
+ * they differ in data size, comparator or allocator, or either is pooled.
+ */
+DSA_API STATUS AVLTree_union(AVLTree* dst, AVLTree* src);
+
+/**
+ * @brief Replaces `dst` with the intersection of `dst` and `src`, consuming `src`.
+ * @details Same complexity, rules and return values as `AVLTree_union`. The
+ * elements kept are those of `dst`.
+ */
+DSA_API STATUS AVLTree_intersection(AVLTree* dst, AVLTree* src);
+
+/**
+ * @brief Removes from `dst` every element that is also in `src`, consuming `src`.
+ * @details Same complexity, rules and return values as `AVLTree_union`.
+ */
+DSA_API STATUS AVLTree_difference(AVLTree* dst, AVLTree* src);
+
+/* ------------------------------------------------Iterators------------------------------------------------ */
+
+/**
+ * @brief Positions the iterator on the smallest element of the tree.
+ * @details Typical use:
+ * `for (void* e = AVLTreeIterator_begin(&it, tree); e; e = AVLTreeIterator_next(&it)) { ... }`
+ * @param it A pointer to the iterator to initialize.
+ * @param tree A constant pointer to the AVL tree.
+ * @return A pointer to the element's data within the tree, or `NULL` if the tree is empty or NULL.
+ */
+DSA_API void* AVLTreeIterator_begin(AVLTreeIterator* it, const AVLTree* tree);
+
+/**
+ * @brief Positions the iterator on the largest element of the tree, for reverse iteration with `prev`.
+ * @return A pointer to the element's data within the tree, or `NULL` if the tree is empty or NULL.
+ */
+DSA_API void* AVLTreeIterator_last(AVLTreeIterator* it, const AVLTree* tree);
+
+/**
+ * @brief Positions the iterator on the smallest element not ordered before `key` (its lower bound).
+ * @param it A pointer to the iterator to initialize.
+ * @param tree A constant pointer to the AVL tree.
+ * @param key A pointer to the key, which need not be present.
+ * @return A pointer to the element's data within the tree, or `NULL` if no element qualifies.
+ */
+DSA_API void* AVLTreeIterator_seek(AVLTreeIterator* it, const AVLTree* tree, const void* key);
+
+/**
+ * @brief Returns the element the iterator is positioned on.
+ * @return A pointer to the element's data within the tree, or `NULL` if the iterator is exhausted.
+ */
+DSA_API void* AVLTreeIterator_get(const AVLTreeIterator* it);
+
+/**
+ * @brief Advances the iterator to the next larger element.
+ * @return A pointer to the new element's data, or `NULL` if there is none; the iterator is then exhausted.
+ */
+DSA_API void* AVLTreeIterator_next(AVLTreeIterator* it);
+
+/**
+ * @brief Moves the iterator to the next smaller element.
+ * @return A pointer to the new element's data, or `NULL` if there is none; the iterator is then exhausted.
+ */
+DSA_API void* AVLTreeIterator_prev(AVLTreeIterator* it);
+
+/* ---------------------------------------------Instrumentation--------------------------------------------- */
+
+/**
+ * @brief Copies the tree's work counters (see stats.h).
+ * @details Counts comparisons made by insertion, deletion, searches, bounds,
+ * rank and range queries; rotations and the greatest height (in levels) reached
+ * by insertions and deletions; and node allocations and frees. The bulk and set
+ * operations count their nodes but not their comparisons or rebalancing. All
+ * counters read 0 unless the library was built with `DSA_STATS`.
+ * @param tree A constant pointer to the AVL tree.
+ * @param statsOut Receives the counters.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if an argument is NULL.
+ */
+DSA_API STATUS AVLTree_getStats(const AVLTree* tree, DsaStats* statsOut);
+
+/* ------------------------------------------------Snapshots------------------------------------------------ */
+
+/**
+ * @brief Writes the tree's elements in ascending order to a file descriptor as a binary snapshot.
+ * @details Uses the same format as `ArrayList_save`, so the snapshot can also be
+ * loaded or mapped as a sorted `ArrayList`. Elements are written as stored in
+ * memory; the byte order and element layout must match when loading.
+ * @param tree A constant pointer to the AVL tree.
+ * @param fd A file descriptor open for writing.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if tree is NULL or fd is negative.
+ * @return `STATUS_ERR_ALLOC` if the write buffer cannot be allocated.
+ * @return `STATUS_ERR_IO` if a write fails.
+ */
+DSA_API STATUS AVLTree_save(const AVLTree* tree, int fd);
+
+/**
+ * @brief Reads a tree back from a snapshot written by `AVLTree_save`.
+ * @details The tree is rebuilt perfectly balanced in O(n), as by `AVLTree_buildFromSorted`.
+ * @param fd A file descriptor open for reading, positioned at the snapshot.
+ * @param cmp The comparison function; it must order the elements as the saved tree's did.
+ * @return A new tree, or `NULL` if the snapshot cannot be read, is not an AVL tree
+ * snapshot, is not in order under `cmp`, or memory runs out.
+ */
+DSA_API AVLTree* AVLTree_load(int fd, int (*cmp)(const void *, const void *));
 
 #endif // AVLTREE_H
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**
+ * @file btree.h
+ * @brief Public API for a generic, cache-friendly B+ tree.
+ *
+ * This file defines the interface for a generic ordered container with the
+ * same contract as `AVLTree`. Elements are stored inline in nodes of a few
+ * cache lines each, so a lookup touches O(log_B n) nodes instead of O(log n)
+ * separately allocated ones. All elements live in the leaves, which are linked
+ * in key order for fast range scans; internal nodes only hold copies of
+ * elements used as separators.
+ */
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "common.h"
+#include "allocator.h"
+
+/**
+ * @struct BTree
+ * @brief An opaque struct representing the B+ tree data structure.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the BTree only through the public API functions.
+ */
+typedef struct BTree BTree;
+
+/**
+ * @struct BTreeIterator
+ * @brief A forward in-order cursor over a B+ tree.
+ *
+ * The iterator is a plain value that the caller allocates (typically on the
+ * stack); it owns no memory and needs no cleanup. Stepping is O(1) and follows
+ * the leaf links. Any insertion into or deletion from the tree invalidates it.
+ * The fields are private.
+ */
+typedef struct BTreeIterator
+{
+    struct BTreeNode* leaf;     // The leaf holding the current element; NULL once exhausted.
+    size_t index;               // Position of the current element within `leaf`.
+    size_t dataSize;            // The size in bytes of each element.
+} BTreeIterator;
+
+/**
+ * @brief Initializes a new, empty B+ tree.
+ * @details Node capacity is derived from `dataSize` so that each node spans a
+ * few cache lines; every node holds at least four elements.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, with the same
+ * contract as for `AVLTree_init`.
+ * @return A pointer to the newly created BTree, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API BTree* BTree_init(size_t dataSize, int (*cmp)(const void *, const void *));
+
+/**
+ * @brief Initializes a new, empty B+ tree whose struct and nodes come from `allocator`.
+ * @details With a bulk allocator such as an `Arena`, destroying the tree does
+ * not visit its nodes. The allocator is copied.
+ * @param dataSize The size in bytes of each element to be stored.
+ * @param cmp The comparison function, as for `BTree_init`.
+ * @param allocator The allocator to use, or NULL for `malloc`.
+ * @return A pointer to the newly created BTree, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API BTree* BTree_initWithAllocator(size_t dataSize, int (*cmp)(const void *, const void *), const DsaAllocator* allocator);
+
+/**
+ * @brief Frees all memory associated with the tree.
+ * @param tree A pointer to the tree to be destroyed. If NULL, the function does nothing.
+ */
+DSA_API void BTree_destroy(BTree* tree);
+
+/**
+ * @brief Inserts an element into the tree, splitting full nodes on the way back up.
+ * @details Either the element is inserted or the tree is left unchanged.
+ * @param tree A pointer to the tree.
+ * @param element A pointer to the element data to be copied into the tree.
+ * @return `STATUS_OK` on successful insertion.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if tree or element is NULL.
+ * @return `STATUS_ERR_DUPLICATE_KEY` if an element with the same key already exists.
+ * @return `STATUS_ERR_ALLOC` if memory allocation for a new node fails.
+ */
+DSA_API STATUS BTree_insert(BTree* tree, const void* element);
+
+/**
+ * @brief Deletes an element with a specific key from the tree.
+ * @details Nodes that fall below half full borrow from or merge with a sibling.
+ * @param tree A pointer to the tree.
+ * @param key A pointer to the key of the element to delete.
+ * @return `STATUS_OK` on successful deletion.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if tree or key is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if no element with the given key is found.
+ */
+DSA_API STATUS BTree_delete(BTree* tree, const void* key);
+
+/**
+ * @brief Searches for an element with a specific key in O(log n).
+ * @param tree A constant pointer to the tree.
+ * @param key A pointer to the key of the element to search for.
+ * @return A pointer to the data of the found element within the tree, valid
+ * until the next insertion or deletion.
+ * @return `NULL` if the key is not found or if arguments are invalid.
+ */
+DSA_API void* BTree_search(const BTree* tree, const void* key);
+
+/**
+ * @brief Returns the number of elements in the tree in O(1).
+ * @param tree A constant pointer to the tree.
+ * @return The number of elements, or 0 if the tree is NULL.
+ */
+DSA_API size_t BTree_size(const BTree* tree);
+
+/**
+ * @brief Finds the smallest element that is not ordered before `key`.
+ * @param tree A constant pointer to the tree.
+ * @param key A pointer to the key, compared with the tree's comparator.
+ * @return A pointer to the element's data within the tree, or `NULL` if every element is smaller or arguments are invalid.
+ */
+DSA_API void* BTree_lowerBound(const BTree* tree, const void* key);
+
+/**
+ * @brief Visits the elements in the closed range `[lo, hi]` in ascending order.
+ * @details Costs O(log n) to find the first element, then walks the linked
+ * leaves. The tree must not be modified during the visit.
+ * @param tree A constant pointer to the tree.
+ * @param lo A pointer to the lower bound key, or NULL to start from the smallest element.
+ * @param hi A pointer to the upper bound key, or NULL to continue to the largest element.
+ * @param visit Called with each element's data and `ctx`. Returning `false` stops the visit.
+ * @param ctx An opaque pointer passed through to `visit`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if tree or visit is NULL.
+ */
+DSA_API STATUS BTree_visitRange(const BTree* tree, const void* lo, const void* hi,
+    bool (*visit)(void* element, void* ctx), void* ctx);
+
+/* ------------------------------------------------Iterators------------------------------------------------ */
+
+/**
+ * @brief Positions the iterator at the smallest element.
+ * @param it A pointer to the iterator to initialize.
+ * @param tree A constant pointer to the tree to iterate.
+ * @return A pointer to the smallest element, or `NULL` if the tree is empty or arguments are invalid.
+ */
+DSA_API void* BTreeIterator_begin(BTreeIterator* it, const BTree* tree);
+
+/**
+ * @brief Positions the iterator at the smallest element not ordered before `key`.
+ * @param it A pointer to the iterator to initialize.
+ * @param tree A constant pointer to the tree to iterate.
+ * @param key A pointer to the key, which need not be present.
+ * @return A pointer to the element found, or `NULL` if there is none or arguments are invalid.
+ */
+DSA_API void* BTreeIterator_seek(BTreeIterator* it, const BTree* tree, const void* key);
+
+/**
+ * @brief Returns the element the iterator is positioned at.
+ * @return A pointer to the element, or `NULL` if the iterator is exhausted.
+ */
+DSA_API void* BTreeIterator_get(const BTreeIterator* it);
+
+/**
+ * @brief Advances the iterator to the next larger element.
+ * @return A pointer to the new current element, or `NULL` once the iterator is exhausted.
+ */
+DSA_API void* BTreeIterator_next(BTreeIterator* it);
+
+#endif // BTREE_H
@@ -7,6 +7,18 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/**
+ * Marks a function as part of the library's public interface. The shared
+ * library is compiled with `-fvisibility=hidden` and `DSA_BUILD_SHARED`, so
+ * only functions declared with `DSA_API` are exported from it; everything
+ * else, including the helpers shared between modules, stays internal.
+ */
+#if defined(DSA_BUILD_SHARED) && (defined(__GNUC__) || defined(__clang__))
+#define DSA_API __attribute__((visibility("default")))
+#else
+#define DSA_API
+#endif
+
 /**
  * Generic status codes for data structure operations
  */
@@ -20,6 +32,7 @@ typedef enum {
     STATUS_ERR_OVERFLOW = 6,
     STATUS_ERR_EMPTY = 7,
     STATUS_ERR_FULL = 8,
+    STATUS_ERR_IO = 9,
     STATUS_ERR_UNKNOWN = 100
 } STATUS;
 
@@ -0,0 +1,146 @@
+/**
+ * @file concurrentqueue.h
+ * @brief Public API for bounded, lock-free concurrent queues.
+ *
+ * This file defines two generic FIFO queues that can be shared between threads
+ * without any external locking. Both are fixed-capacity ring buffers built on
+ * C11 `<stdatomic.h>` and store elements inline at `dataSize` stride.
+ *
+ * - `SPSCQueue`: exactly one producer thread and one consumer thread. Uses only
+ *   acquire/release loads and stores, no read-modify-write operations.
+ * - `MPMCQueue`: any number of producer and consumer threads. Each slot carries
+ *   a sequence number (Dmitry Vyukov's bounded MPMC design), so producers and
+ *   consumers only contend on a single compare-and-swap each.
+ *
+ * Neither queue blocks: a full queue reports `STATUS_ERR_FULL` and an empty one
+ * reports `STATUS_ERR_EMPTY`, leaving the retry policy to the caller.
+ */
+#ifndef CONCURRENTQUEUE_H
+#define CONCURRENTQUEUE_H
+
+#include "common.h"
+
+/**
+ * @struct SPSCQueue
+ * @brief An opaque struct representing a single-producer/single-consumer queue.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the SPSCQueue only through the public API functions defined in this file.
+ */
+typedef struct SPSCQueue SPSCQueue;
+
+/**
+ * @struct MPMCQueue
+ * @brief An opaque struct representing a multi-producer/multi-consumer queue.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the MPMCQueue only through the public API functions defined in this file.
+ */
+typedef struct MPMCQueue MPMCQueue;
+
+/* ----------------------------------- SPSCQueue ----------------------------------- */
+
+/**
+ * @brief Initializes a new, empty single-producer/single-consumer queue.
+ * @param capacity The maximum number of elements. Rounded up to the next power of two.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @return A pointer to the newly created queue, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API SPSCQueue* SPSCQueue_init(size_t capacity, size_t dataSize);
+
+/**
+ * @brief Frees all memory associated with the queue.
+ * @details Must not be called while any other thread is still using the queue.
+ * @param queue A pointer to the queue to be destroyed.
+ */
+DSA_API void SPSCQueue_destroy(SPSCQueue* queue);
+
+/**
+ * @brief Adds an element to the back of the queue. Producer thread only.
+ * @param queue A pointer to the queue.
+ * @param element A pointer to the element data to be copied into the queue.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or element is NULL.
+ * @return `STATUS_ERR_FULL` if the queue is full.
+ */
+DSA_API STATUS SPSCQueue_enqueue(SPSCQueue* queue, const void* element);
+
+/**
+ * @brief Removes the front element and copies it out. Consumer thread only.
+ * @param queue A pointer to the queue.
+ * @param elementOut A pointer to a memory location where the element's data will be copied.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or elementOut is NULL.
+ * @return `STATUS_ERR_EMPTY` if the queue is empty.
+ */
+DSA_API STATUS SPSCQueue_dequeue(SPSCQueue* queue, void* elementOut);
+
+/**
+ * @brief Returns the number of elements in the queue.
+ * @details The value is a snapshot and may be stale by the time it is used
+ * if the other side is running concurrently.
+ * @param queue A pointer to the queue.
+ * @return The number of elements, or 0 if the queue is NULL.
+ */
+DSA_API size_t SPSCQueue_size(SPSCQueue* queue);
+
+/**
+ * @brief Returns the maximum number of elements the queue can hold.
+ * @param queue A constant pointer to the queue.
+ * @return The capacity (a power of two), or 0 if the queue is NULL.
+ */
+DSA_API size_t SPSCQueue_capacity(const SPSCQueue* queue);
+
+/* ----------------------------------- MPMCQueue ----------------------------------- */
+
+/**
+ * @brief Initializes a new, empty multi-producer/multi-consumer queue.
+ * @param capacity The maximum number of elements. Rounded up to the next power of two (minimum 2).
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @return A pointer to the newly created queue, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API MPMCQueue* MPMCQueue_init(size_t capacity, size_t dataSize);
+
+/**
+ * @brief Frees all memory associated with the queue.
+ * @details Must not be called while any other thread is still using the queue.
+ * @param queue A pointer to the queue to be destroyed.
+ */
+DSA_API void MPMCQueue_destroy(MPMCQueue* queue);
+
+/**
+ * @brief Adds an element to the back of the queue. Safe to call from any thread.
+ * @param queue A pointer to the queue.
+ * @param element A pointer to the element data to be copied into the queue.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or element is NULL.
+ * @return `STATUS_ERR_FULL` if the queue is full.
+ */
+DSA_API STATUS MPMCQueue_enqueue(MPMCQueue* queue, const void* element);
+
+/**
+ * @brief Removes the front element and copies it out. Safe to call from any thread.
+ * @param queue A pointer to the queue.
+ * @param elementOut A pointer to a memory location where the element's data will be copied.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or elementOut is NULL.
+ * @return `STATUS_ERR_EMPTY` if the queue is empty.
+ */
+DSA_API STATUS MPMCQueue_dequeue(MPMCQueue* queue, void* elementOut);
+
+/**
+ * @brief Returns an approximate number of elements in the queue.
+ * @details The value is a snapshot; concurrent operations may change it at any time.
+ * @param queue A pointer to the queue.
+ * @return The number of elements, or 0 if the queue is NULL.
+ */
+DSA_API size_t MPMCQueue_size(MPMCQueue* queue);
+
+/**
+ * @brief Returns the maximum number of elements the queue can hold.
+ * @param queue A constant pointer to the queue.
+ * @return The capacity (a power of two), or 0 if the queue is NULL.
+ */
+DSA_API size_t MPMCQueue_capacity(const MPMCQueue* queue);
+
+#endif /* CONCURRENTQUEUE_H */
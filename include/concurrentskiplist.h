@@ -0,0 +1,117 @@
+/**
+ * @file concurrentskiplist.h
+ * @brief Public API for a lock-free concurrent ordered set (skip list).
+ *
+ * This file defines a generic ordered container with the same `dataSize`/`cmp`
+ * contract as `AVLTree`, which any number of threads may use at once without
+ * external locking. Storing a key followed by its value in each element, and
+ * comparing only the key, makes it an ordered map.
+ *
+ * - Writers link and unlink nodes with compare-and-swap, marking a node's
+ *   links before unlinking it (Harris/Fraser), so a stalled thread never
+ *   blocks the others.
+ * - Readers (`search`, `lowerBound`, `forEach`) never write to shared nodes
+ *   and never wait for writers.
+ * - Unlinked nodes are freed by epoch-based reclamation: a node is released
+ *   only once every operation that might still be reading it has finished.
+ *   Lookups therefore copy elements out rather than return pointers into the
+ *   list.
+ *
+ * Elements cannot be modified in place once inserted. `size` is exact when the
+ * list is quiescent and approximate while writers are running.
+ */
+#ifndef CONCURRENTSKIPLIST_H
+#define CONCURRENTSKIPLIST_H
+
+#include "common.h"
+
+/**
+ * @struct ConcurrentSkipList
+ * @brief An opaque struct representing the concurrent skip list.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the ConcurrentSkipList only through the public API functions.
+ */
+typedef struct ConcurrentSkipList ConcurrentSkipList;
+
+/**
+ * @brief Initializes a new, empty concurrent skip list.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, with the same contract
+ * as for `AVLTree_init`. It is called concurrently from every thread using the list.
+ * @return A pointer to the newly created list, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API ConcurrentSkipList* ConcurrentSkipList_init(size_t dataSize, int (*cmp)(const void *, const void *));
+
+/**
+ * @brief Frees all memory associated with the list, including nodes awaiting reclamation.
+ * @details Must not be called while any other thread is still using the list.
+ * @param list A pointer to the list to be destroyed. If NULL, the function does nothing.
+ */
+DSA_API void ConcurrentSkipList_destroy(ConcurrentSkipList* list);
+
+/**
+ * @brief Inserts an element. Safe to call from any thread.
+ * @param list A pointer to the list.
+ * @param element A pointer to the element data to be copied into the list.
+ * @return `STATUS_OK` on successful insertion.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if list or element is NULL.
+ * @return `STATUS_ERR_DUPLICATE_KEY` if an element with the same key is present.
+ * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
+ */
+DSA_API STATUS ConcurrentSkipList_insert(ConcurrentSkipList* list, const void* element);
+
+/**
+ * @brief Deletes the element with a specific key. Safe to call from any thread.
+ * @param list A pointer to the list.
+ * @param key A pointer to the key of the element to delete.
+ * @return `STATUS_OK` on successful deletion.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if list or key is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if no element with the key is present.
+ */
+DSA_API STATUS ConcurrentSkipList_delete(ConcurrentSkipList* list, const void* key);
+
+/**
+ * @brief Looks up an element by key in expected O(log n). Safe to call from any thread.
+ * @param list A pointer to the list.
+ * @param key A pointer to the key of the element to search for.
+ * @param elementOut If not NULL, receives a copy of the element found.
+ * @return `STATUS_OK` if the key is present.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if list or key is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not present.
+ */
+DSA_API STATUS ConcurrentSkipList_search(ConcurrentSkipList* list, const void* key, void* elementOut);
+
+/**
+ * @brief Finds the smallest element not ordered before `key`. Safe to call from any thread.
+ * @param list A pointer to the list.
+ * @param key A pointer to the key, which need not be present.
+ * @param elementOut Receives a copy of the element found.
+ * @return `STATUS_OK` if such an element exists.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if a pointer is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if every element is ordered before `key`.
+ */
+DSA_API STATUS ConcurrentSkipList_lowerBound(ConcurrentSkipList* list, const void* key, void* elementOut);
+
+/**
+ * @brief Visits the elements in ascending order. Safe to call from any thread.
+ * @details The visit is weakly consistent: every element present throughout
+ * is visited once, elements inserted or deleted meanwhile may or may not be.
+ * Reclamation of deleted nodes is held back until the visit ends, so keep
+ * callbacks short. `callback` must not modify the list.
+ * @param list A pointer to the list.
+ * @param callback Called with each element and `ctx`. Returning `false` stops the visit.
+ * @param ctx An opaque pointer passed through to `callback`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if list or callback is NULL.
+ */
+DSA_API STATUS ConcurrentSkipList_forEach(ConcurrentSkipList* list, bool (*callback)(const void* element, void* ctx), void* ctx);
+
+/**
+ * @brief Returns the number of elements in the list.
+ * @details The value is a snapshot; concurrent operations may change it at any time.
+ * @param list A pointer to the list.
+ * @return The number of elements, or 0 if the list is NULL.
+ */
+DSA_API size_t ConcurrentSkipList_size(ConcurrentSkipList* list);
+
+#endif /* CONCURRENTSKIPLIST_H */
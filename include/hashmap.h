@@ -0,0 +1,173 @@
+/**
+ * @file hashmap.h
+ * @brief Public API for a generic, open-addressing hash map and hash set.
+ *
+ * This file defines the interface for a hash table that stores fixed-size keys
+ * and values inline in a single flat array. Collisions are resolved with Robin
+ * Hood linear probing, which keeps probe sequences short and lets deletion
+ * shift entries back instead of leaving tombstones. A byte of hash bits per
+ * slot is kept in a separate control array, so a lookup usually examines 16
+ * slots at once with SIMD (SSE2 where available, a portable loop otherwise)
+ * and compares at most one or two keys.
+ *
+ * A map created with a `valueSize` of 0 stores keys only and acts as a hash set.
+ */
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include "common.h"
+#include "allocator.h"
+#include "stats.h"
+
+/**
+ * @struct HashMap
+ * @brief An opaque struct representing the hash map data structure.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the HashMap only through the public API functions.
+ */
+typedef struct HashMap HashMap;
+
+/**
+ * @brief Initializes a new, empty hash map.
+ * @details No table is allocated until the first insertion or `HashMap_reserve`.
+ * @param keySize The size in bytes of each key (e.g., `sizeof(int)`).
+ * @param valueSize The size in bytes of each value, or 0 for a hash set.
+ * @param hash A function returning a hash of the key it is given. Equal keys
+ * must hash equally; the map mixes the result further, so an identity hash is
+ * fine for integers. If NULL, the key bytes are hashed with `HashMap_hashBytes`.
+ * @param equals A function returning whether two keys are equal. If NULL, keys
+ * are compared byte for byte.
+ * @return A pointer to the newly created HashMap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API HashMap* HashMap_init(size_t keySize, size_t valueSize,
+    size_t (*hash)(const void* key), bool (*equals)(const void* a, const void* b));
+
+/**
+ * @brief Initializes a new, empty hash map whose struct and table come from `allocator`.
+ * @details Same as `HashMap_init` otherwise. The allocator is copied.
+ * @param allocator The allocator to use, or NULL for `malloc`.
+ * @return A pointer to the newly created HashMap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API HashMap* HashMap_initWithAllocator(size_t keySize, size_t valueSize,
+    size_t (*hash)(const void* key), bool (*equals)(const void* a, const void* b), const DsaAllocator* allocator);
+
+/**
+ * @brief Frees all memory associated with the map.
+ * @param map A pointer to the map to be destroyed. If NULL, the function does nothing.
+ */
+DSA_API void HashMap_destroy(HashMap* map);
+
+/**
+ * @brief Ensures the map can hold `count` entries without rehashing.
+ * @param map A pointer to the map.
+ * @param count The number of entries to make room for.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if map is NULL.
+ * @return `STATUS_ERR_OVERFLOW` if the table size would overflow.
+ * @return `STATUS_ERR_ALLOC` if the table cannot be allocated. The map is unchanged.
+ */
+DSA_API STATUS HashMap_reserve(HashMap* map, size_t count);
+
+/**
+ * @brief Inserts a key and its value, failing if the key is already present.
+ * @param map A pointer to the map.
+ * @param key A pointer to the key to copy into the map.
+ * @param value A pointer to the value to copy into the map; ignored (and may be NULL) for a hash set.
+ * @return `STATUS_OK` on successful insertion.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if map, key or a required value is NULL.
+ * @return `STATUS_ERR_DUPLICATE_KEY` if the key is already present. The map is unchanged.
+ * @return `STATUS_ERR_ALLOC` if growing the table fails.
+ * @return `STATUS_ERR_OVERFLOW` if the table cannot grow further, or a
+ * degenerate hash function has produced a probe sequence of over 65535 slots.
+ */
+DSA_API STATUS HashMap_insert(HashMap* map, const void* key, const void* value);
+
+/**
+ * @brief Inserts a key and its value, replacing the value if the key is already present.
+ * @details Same arguments and return values as `HashMap_insert`, except that
+ * an existing key is not an error.
+ */
+DSA_API STATUS HashMap_put(HashMap* map, const void* key, const void* value);
+
+/**
+ * @brief Looks up a key in expected O(1).
+ * @param map A constant pointer to the map.
+ * @param key A pointer to the key to look for.
+ * @return A pointer to the key's value within the map (to the stored key for a
+ * hash set), valid until the next insertion, removal or rehash.
+ * @return `NULL` if the key is not present or arguments are invalid.
+ */
+DSA_API void* HashMap_get(const HashMap* map, const void* key);
+
+/**
+ * @brief Checks whether a key is present.
+ * @return `true` if the key is present, `false` otherwise or if arguments are invalid.
+ */
+DSA_API bool HashMap_contains(const HashMap* map, const void* key);
+
+/**
+ * @brief Removes a key and its value.
+ * @details Later entries of the probe sequence shift back one slot, so removal
+ * leaves no tombstones behind and never slows down later lookups.
+ * @param map A pointer to the map.
+ * @param key A pointer to the key to remove.
+ * @param valueOut If not NULL, receives a copy of the removed value (unused for a hash set).
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if map or key is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not present.
+ */
+DSA_API STATUS HashMap_remove(HashMap* map, const void* key, void* valueOut);
+
+/**
+ * @brief Removes every entry, keeping the table allocated.
+ * @param map A pointer to the map.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if map is NULL.
+ */
+DSA_API STATUS HashMap_clear(HashMap* map);
+
+/**
+ * @brief Returns the number of entries in the map.
+ * @return The number of entries, or 0 if the map is NULL.
+ */
+DSA_API size_t HashMap_size(const HashMap* map);
+
+/**
+ * @brief Returns the number of slots in the table.
+ * @details At most seven eighths of the slots are ever in use.
+ * @return The number of slots, or 0 if the map is NULL or has no table yet.
+ */
+DSA_API size_t HashMap_capacity(const HashMap* map);
+
+/**
+ * @brief Visits every entry in unspecified order.
+ * @details The map must not be modified during the visit.
+ * @param map A constant pointer to the map.
+ * @param callback Called with each key, its value (NULL for a hash set) and `ctx`.
+ * Returning `false` stops the visit.
+ * @param ctx An opaque pointer passed through to `callback`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if map or callback is NULL.
+ */
+DSA_API STATUS HashMap_forEach(const HashMap* map, bool (*callback)(const void* key, void* value, void* ctx), void* ctx);
+
+/**
+ * @brief Copies the map's work counters (see stats.h).
+ * @details Counts key equality checks; probe sequence lengths (in slots) of
+ * lookups, including those made by insertion and removal; rehashes; and the bytes
+ * moved by rehashing and by shifting entries within a cluster. All counters
+ * read 0 unless the library was built with `DSA_STATS`.
+ * @param map A constant pointer to the map.
+ * @param statsOut Receives the counters.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if an argument is NULL.
+ */
+DSA_API STATUS HashMap_getStats(const HashMap* map, DsaStats* statsOut);
+
+/**
+ * @brief Hashes a byte sequence (FNV-1a), for building hash functions over composite keys.
+ * @param data A pointer to the bytes to hash.
+ * @param length The number of bytes.
+ * @return The hash value.
+ */
+DSA_API size_t HashMap_hashBytes(const void* data, size_t length);
+
+#endif // HASHMAP_H
@@ -1,11 +1,19 @@
 /**
  * @file heap.h
- * @brief Public API for a generic binary heap data structure.
+ * @brief Public API for a generic binary (or d-ary) heap data structure.
  *
  * This file defines the interface for a generic heap. The implementation is
  * built upon a dynamic ArrayList, allowing it to grow as needed. The heap's
  * behavior (min-heap or max-heap) is determined by the comparison function
  * provided during initialization.
+ *
+ * Heaps are binary by default. A 4-ary or 8-ary heap is shallower and keeps a
+ * node's children next to each other in memory, which trades a few extra
+ * comparisons per level for fewer cache misses on large heaps of small elements.
+ *
+ * A bounded heap, made with `Heap_initBounded`, never holds more than a fixed
+ * number of elements. Feeding a stream to `Heap_offer` keeps the top K of it
+ * with at most one comparison per rejected element, and no allocation.
  */
 #ifndef HEAP_H
 #define HEAP_H
@@ -37,7 +45,54 @@ typedef struct Heap Heap;
  * Example (min-heap for ints): `return *(int*)a - *(int*)b;`
  * @return A pointer to the newly created Heap, or `NULL` on allocation failure or invalid arguments.
  */
-Heap* Heap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b));
+DSA_API Heap* Heap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Initializes a new d-ary heap instance.
+ * @details Identical to `Heap_init`, except each node has `arity` children.
+ * @param capacity The initial storage capacity of the heap (number of elements).
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, as for `Heap_init`.
+ * @param arity The number of children per node. Must be 2, 4 or 8.
+ * @return A pointer to the newly created Heap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Heap* Heap_initWithArity(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b), size_t arity);
+
+/**
+ * @brief Initializes a binary heap that holds at most `k` elements, for top-K selection.
+ * @details Storage for `k` elements is allocated up front and never shrinks.
+ * The root is the element a full heap gives up first, so to keep the K largest
+ * elements of a stream, use a min-heap comparator and feed it with `Heap_offer`.
+ * `Heap_push` and `Heap_pushMany` fail with `STATUS_ERR_FULL` rather than go past `k`.
+ * @param k The most elements the heap may hold. Must not be 0.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, as for `Heap_init`.
+ * @return A pointer to the newly created Heap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Heap* Heap_initBounded(size_t k, size_t dataSize, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Builds a heap from an existing array of elements in O(n).
+ * @details The elements are copied into the heap's storage in a single block and
+ * the heap property is then established bottom-up (Floyd's heapify), which is
+ * asymptotically faster than `count` successive calls to `Heap_push`.
+ *
+ * @param data A pointer to `count` contiguous elements of `dataSize` bytes each.
+ * May be NULL only if `count` is 0.
+ * @param count The number of elements in `data`.
+ * @param dataSize The size in bytes of each element (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, as for `Heap_init`.
+ * @return A pointer to the newly created Heap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Heap* Heap_initFromArray(const void* data, size_t count, size_t dataSize, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Builds a d-ary heap from an existing array of elements in O(n).
+ * @details Identical to `Heap_initFromArray`, except each node has `arity` children.
+ * @param arity The number of children per node. Must be 2, 4 or 8.
+ * @return A pointer to the newly created Heap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Heap* Heap_initFromArrayWithArity(const void* data, size_t count, size_t dataSize, int (*cmp)(const void* a, const void* b), size_t arity);
 
 /**
  * @brief Frees all memory associated with the heap.
@@ -45,7 +100,7 @@ Heap* Heap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, cons
  * The heap pointer becomes invalid after this call.
  * @param heap A pointer to the heap to be destroyed.
  */
-void Heap_destroy(Heap* heap);
+DSA_API void Heap_destroy(Heap* heap);
 
 /**
  * @brief Adds a new element to the heap, maintaining the heap property.
@@ -58,7 +113,7 @@ void Heap_destroy(Heap* heap);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL.
  * @return `STATUS_ERR_ALLOC` if memory allocation fails.
  */
-STATUS Heap_push(Heap* heap, void* element);
+DSA_API STATUS Heap_push(Heap* heap, void* element);
 
 /**
  * @brief Removes the root element from the heap.
@@ -71,7 +126,66 @@ STATUS Heap_push(Heap* heap, void* element);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or elementOut is NULL.
  * @return `STATUS_ERR_UNDERFLOW` if the heap is empty.
  */
-STATUS Heap_pop(Heap* heap, void* elementOut);
+DSA_API STATUS Heap_pop(Heap* heap, void* elementOut);
+
+/**
+ * @brief Adds a batch of elements to the heap.
+ * @details Storage is grown at most once for the whole batch. Small batches are
+ * sifted up one by one; a batch at least as large as the current heap triggers
+ * a single O(n) rebuild instead.
+ *
+ * @param heap A pointer to the heap.
+ * @param elements A pointer to `count` contiguous elements to be copied into the heap.
+ * @param count The number of elements to add.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap is NULL, or elements is NULL with a non-zero count.
+ * @return `STATUS_ERR_OVERFLOW` if the heap cannot grow to the requested size.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ */
+DSA_API STATUS Heap_pushMany(Heap* heap, const void* elements, size_t count);
+
+/**
+ * @brief Offers an element to the heap, keeping it only if a bounded heap has room for it.
+ * @details While the heap is below its bound the element is pushed. Once it is
+ * full, the element is compared once with the root: if it orders after the
+ * root it replaces it and is sifted down, otherwise it is rejected. An
+ * unbounded heap accepts every element, as `Heap_push` does.
+ *
+ * @param heap A pointer to the heap.
+ * @param element A pointer to the element data to be copied into the heap.
+ * @return `STATUS_OK` if the element was added.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL.
+ * @return `STATUS_ERR_FULL` if the heap is full and the element does not order after its root. The heap is unchanged.
+ * @return `STATUS_ERR_ALLOC` if an unbounded heap cannot grow.
+ */
+DSA_API STATUS Heap_offer(Heap* heap, const void* element);
+
+/**
+ * @brief Removes every element from the heap, in pop order.
+ * @details Equivalent to `Heap_popMany(heap, out, Heap_size(heap))`, but the
+ * elements are popped in place, without shrinking the storage, so a bounded
+ * heap can collect the next batch straight away.
+ *
+ * @param heap A pointer to the heap.
+ * @param out A pointer to room for `Heap_size(heap)` elements. May be NULL if the heap is empty.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap is NULL, or out is NULL and the heap is not empty.
+ */
+DSA_API STATUS Heap_drainSorted(Heap* heap, void* out);
+
+/**
+ * @brief Removes the `count` top elements from the heap in order.
+ * @details Equivalent to `count` calls to `Heap_pop`, writing the elements
+ * contiguously into `elementsOut`, which makes it suitable for top-k extraction.
+ *
+ * @param heap A pointer to the heap.
+ * @param elementsOut A pointer to room for `count` elements.
+ * @param count The number of elements to remove.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap is NULL, or elementsOut is NULL with a non-zero count.
+ * @return `STATUS_ERR_UNDERFLOW` if the heap holds fewer than `count` elements. Nothing is removed.
+ */
+DSA_API STATUS Heap_popMany(Heap* heap, void* elementsOut, size_t count);
 
 /**
  * @brief Retrieves a copy of the root element without removing it.
@@ -81,13 +195,82 @@ STATUS Heap_pop(Heap* heap, void* elementOut);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or elementOut is NULL.
  * @return `STATUS_ERR_EMPTY` if the heap is empty.
  */
-STATUS Heap_peek(const Heap* heap, void* elementOut);
+DSA_API STATUS Heap_peek(const Heap* heap, void* elementOut);
+
+/**
+ * @brief Returns a read-only pointer to the root element, without copying it.
+ * @details The pointer stays valid until the next push or pop on the heap, or
+ * until it is destroyed. The element must not be modified through it, since
+ * that could break the heap order.
+ * @param heap A constant pointer to the heap.
+ * @return A pointer to the root element, or NULL if the heap is NULL or empty.
+ */
+DSA_API const void* Heap_top(const Heap* heap);
 
 /**
  * @brief Returns the current number of elements in the heap.
  * @param heap A constant pointer to the heap.
  * @return The number of elements as a `size_t`. Returns 0 if the heap is NULL.
  */
-size_t Heap_size(const Heap* heap);
+DSA_API size_t Heap_size(const Heap* heap);
+
+/**
+ * @brief Returns the most elements the heap may hold.
+ * @param heap A constant pointer to the heap.
+ * @return The bound given to `Heap_initBounded`, or 0 if the heap is unbounded or NULL.
+ */
+DSA_API size_t Heap_bound(const Heap* heap);
+
+/**
+ * @brief Returns the number of children per node.
+ * @param heap A constant pointer to the heap.
+ * @return 2, 4 or 8. Returns 0 if the heap is NULL.
+ */
+DSA_API size_t Heap_arity(const Heap* heap);
+
+/**
+ * @brief Copies the heap's work counters (see stats.h).
+ * @details Counts comparisons, reallocations of the storage, and the bytes
+ * moved by them and by sifting. All counters read 0 unless the library was
+ * built with `DSA_STATS`.
+ * @param heap A constant pointer to the heap.
+ * @param statsOut Receives the counters.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if an argument is NULL.
+ */
+DSA_API STATUS Heap_getStats(const Heap* heap, DsaStats* statsOut);
+
+/**
+ * @brief Writes the heap to a file descriptor as a binary snapshot.
+ * @details The elements are written in heap order along with the arity, in
+ * the format of `ArrayList_save`, so loading needs no heapify.
+ * @param heap A constant pointer to the heap.
+ * @param fd A file descriptor open for writing.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap is NULL or fd is negative.
+ * @return `STATUS_ERR_IO` if a write fails.
+ */
+DSA_API STATUS Heap_save(const Heap* heap, int fd);
+
+/**
+ * @brief Reads a heap back from a snapshot written by `Heap_save`.
+ * @details Reads from the current file position. `cmp` must order elements as
+ * the saved heap's comparator did; the heap order is trusted, not checked.
+ * @param fd A file descriptor open for reading.
+ * @param cmp The comparison function.
+ * @return A new heap, or `NULL` if the snapshot cannot be read, is not a heap snapshot or memory runs out.
+ */
+DSA_API Heap* Heap_load(int fd, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Creates a heap whose storage is a zero-copy mapping of a file written by `Heap_save`.
+ * @details The mapping behaves as for `ArrayList_mapFile`: pops and pushes
+ * work in place on private pages, and the first push that needs more capacity
+ * copies the elements out.
+ * @param path The path of the snapshot file.
+ * @param dataSize The expected element size; the snapshot's must match.
+ * @param cmp The comparison function, ordering elements as the saved heap's did.
+ * @return A new heap, or `NULL` if the file cannot be mapped or is not a matching heap snapshot.
+ */
+DSA_API Heap* Heap_mapFile(const char* path, size_t dataSize, int (*cmp)(const void* a, const void* b));
 
 #endif
\ No newline at end of file
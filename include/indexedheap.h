@@ -0,0 +1,152 @@
+/**
+ * @file indexedheap.h
+ * @brief Public API for a generic, indexed (addressable) binary heap.
+ *
+ * This file defines the interface for a priority queue whose elements can be
+ * updated or removed after they are pushed. Every push returns a stable handle
+ * that identifies the element until it is popped or removed. A position map
+ * stored alongside the heap array translates a handle to its current heap
+ * slot, so key updates and removals run in O(log n) without searching.
+ *
+ * Ordering follows the same `cmp` contract as heap.h: the element for which
+ * `cmp` reports the smallest value is at the root. "Decrease" therefore means
+ * "move towards the root" and "increase" means "move away from it", for both
+ * min-heaps and max-heaps.
+ */
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include "common.h"
+
+/**
+ * @struct IndexedHeap
+ * @brief An opaque struct representing the IndexedHeap data structure.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the IndexedHeap only through the public API
+ * functions defined in this file.
+ */
+typedef struct IndexedHeap IndexedHeap;
+
+/**
+ * @brief Initializes a new indexed heap instance.
+ * @param capacity The initial storage capacity (number of elements). Can be 0.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param cmp A function pointer for comparing two elements, as for `Heap_init`.
+ * @return A pointer to the newly created IndexedHeap, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API IndexedHeap* IndexedHeap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Frees all memory associated with the indexed heap.
+ * @details All outstanding handles become invalid.
+ * @param heap A pointer to the indexed heap to be destroyed.
+ */
+DSA_API void IndexedHeap_destroy(IndexedHeap* heap);
+
+/**
+ * @brief Adds a new element to the heap and returns a handle to it.
+ * @details Handles of popped or removed elements are recycled by later pushes.
+ * @param heap A pointer to the indexed heap.
+ * @param element A pointer to the element data to be copied into the heap.
+ * @param handleOut Optional. Receives the handle of the new element.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL.
+ * @return `STATUS_ERR_OVERFLOW` if the heap cannot grow any further.
+ * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ */
+DSA_API STATUS IndexedHeap_push(IndexedHeap* heap, const void* element, size_t* handleOut);
+
+/**
+ * @brief Removes the root element from the heap.
+ * @param heap A pointer to the indexed heap.
+ * @param elementOut A pointer to a memory location where the popped element's data will be copied.
+ * @param handleOut Optional. Receives the handle the popped element had. The handle is released.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or elementOut is NULL.
+ * @return `STATUS_ERR_UNDERFLOW` if the heap is empty.
+ */
+DSA_API STATUS IndexedHeap_pop(IndexedHeap* heap, void* elementOut, size_t* handleOut);
+
+/**
+ * @brief Retrieves a copy of the root element without removing it.
+ * @param heap A constant pointer to the indexed heap.
+ * @param elementOut A pointer to a memory location where the root element's data will be copied.
+ * @param handleOut Optional. Receives the handle of the root element.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or elementOut is NULL.
+ * @return `STATUS_ERR_EMPTY` if the heap is empty.
+ */
+DSA_API STATUS IndexedHeap_peek(const IndexedHeap* heap, void* elementOut, size_t* handleOut);
+
+/**
+ * @brief Retrieves a copy of the element identified by a handle.
+ * @param heap A constant pointer to the indexed heap.
+ * @param handle A handle returned by `IndexedHeap_push`.
+ * @param elementOut A pointer to a memory location where the element's data will be copied.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or elementOut is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the handle does not refer to an element in the heap.
+ */
+DSA_API STATUS IndexedHeap_get(const IndexedHeap* heap, size_t handle, void* elementOut);
+
+/**
+ * @brief Replaces an element with one that orders at or before it, moving it towards the root.
+ * @param heap A pointer to the indexed heap.
+ * @param handle A handle returned by `IndexedHeap_push`.
+ * @param element The new element data. `cmp(element, current)` must not be positive.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL, or the new element orders after the current one.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the handle does not refer to an element in the heap.
+ */
+DSA_API STATUS IndexedHeap_decreaseKey(IndexedHeap* heap, size_t handle, const void* element);
+
+/**
+ * @brief Replaces an element with one that orders at or after it, moving it away from the root.
+ * @param heap A pointer to the indexed heap.
+ * @param handle A handle returned by `IndexedHeap_push`.
+ * @param element The new element data. `cmp(element, current)` must not be negative.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL, or the new element orders before the current one.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the handle does not refer to an element in the heap.
+ */
+DSA_API STATUS IndexedHeap_increaseKey(IndexedHeap* heap, size_t handle, const void* element);
+
+/**
+ * @brief Replaces an element with arbitrary new data and restores the heap order.
+ * @param heap A pointer to the indexed heap.
+ * @param handle A handle returned by `IndexedHeap_push`.
+ * @param element The new element data.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap or element is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the handle does not refer to an element in the heap.
+ */
+DSA_API STATUS IndexedHeap_update(IndexedHeap* heap, size_t handle, const void* element);
+
+/**
+ * @brief Removes the element identified by a handle, wherever it is in the heap.
+ * @param heap A pointer to the indexed heap.
+ * @param handle A handle returned by `IndexedHeap_push`. The handle is released.
+ * @param elementOut Optional. Receives a copy of the removed element.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if heap is NULL.
+ * @return `STATUS_ERR_KEY_NOT_FOUND` if the handle does not refer to an element in the heap.
+ */
+DSA_API STATUS IndexedHeap_remove(IndexedHeap* heap, size_t handle, void* elementOut);
+
+/**
+ * @brief Checks whether a handle currently refers to an element in the heap.
+ * @param heap A constant pointer to the indexed heap.
+ * @param handle The handle to check.
+ * @return `true` if the handle is live, `false` otherwise or if heap is NULL.
+ */
+DSA_API bool IndexedHeap_contains(const IndexedHeap* heap, size_t handle);
+
+/**
+ * @brief Returns the current number of elements in the indexed heap.
+ * @param heap A constant pointer to the indexed heap.
+ * @return The number of elements as a `size_t`. Returns 0 if the heap is NULL.
+ */
+DSA_API size_t IndexedHeap_size(const IndexedHeap* heap);
+
+#endif // INDEXEDHEAP_H
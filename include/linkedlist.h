@@ -1,15 +1,21 @@
 /**
  * @file linkedlist.h
- * @brief Public API for a generic, singly-linked list data structure.
+ * @brief Public API for a generic, doubly-linked list data structure.
  *
  * This file defines the interface for a generic linked list. It supports
  * storing elements of any data type by copying them into new nodes.
  * Note that this implementation uses 1-based indexing for all operations.
+ *
+ * The list keeps both a head and a tail, so operations at either end are O(1).
+ * Positional access walks from whichever end is closer to the index; code that
+ * visits many positions should use the node cursors instead, which stay valid
+ * until the node they refer to is removed.
  */
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
 #include "common.h"
+#include "allocator.h"
 
 /**
  * @struct LinkedList
@@ -21,20 +27,52 @@
  */
 typedef struct LinkedList LinkedList;
 
+/**
+ * @struct LinkedListNode
+ * @brief An opaque cursor referring to one node of a LinkedList.
+ *
+ * A cursor stays valid while its node is in the list, regardless of insertions
+ * or removals elsewhere. It becomes invalid once its node is removed or the
+ * list is destroyed.
+ */
+typedef struct ListNode LinkedListNode;
+
 /**
  * @brief Initializes a new, empty linked list.
  * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
  * @return A pointer to the newly created linked list, or `NULL` on allocation failure.
  */
-LinkedList* LinkedList_init(size_t dataSize);
+DSA_API LinkedList* LinkedList_init(size_t dataSize);
+
+/**
+ * @brief Initializes a new, empty linked list whose struct and nodes come from `allocator`.
+ * @details With a bulk allocator such as an `Arena`, destroying the list does
+ * not visit its nodes. The allocator is copied.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param allocator The allocator to use, or NULL for `malloc`.
+ * @return A pointer to the newly created linked list, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API LinkedList* LinkedList_initWithAllocator(size_t dataSize, const DsaAllocator* allocator);
+
+/**
+ * @brief Initializes a new, empty linked list whose nodes come from a private pool.
+ * @details Nodes are carved from large chunks (see pool.h) instead of being
+ * allocated one by one, which keeps them close together in memory. Destroying
+ * the list releases whole chunks without visiting each node.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @param nodesPerChunk The number of nodes per chunk, or 0 for a default of about 64 KiB per chunk.
+ * @return A pointer to the newly created linked list, or `NULL` on allocation failure.
+ */
+DSA_API LinkedList* LinkedList_initPooled(size_t dataSize, size_t nodesPerChunk);
 
 /**
  * @brief Frees all memory associated with the linked list.
- * @details Deallocates each node, the data within each node, and the linked list
- * structure itself. The linked list pointer becomes invalid after this call.
+ * @details Deallocates each node (node and element share one allocation) and
+ * the linked list structure itself. For a pooled list, the pool's chunks are
+ * released directly. The linked list pointer becomes invalid after this call.
  * @param linkedlist A pointer to the linked list to be destroyed.
  */
-void LinkedList_destroy(LinkedList* linkedlist);
+DSA_API void LinkedList_destroy(LinkedList* linkedlist);
 
 /**
  * @brief Inserts an element at the beginning of the linked list.
@@ -45,7 +83,50 @@ void LinkedList_destroy(LinkedList* linkedlist);
  * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
  * @return `STATUS_ERR_OVERFLOW` if the linked list is grows upto large extent.
  */
-STATUS LinkedList_insert(LinkedList* linkedlist, void* element);
+DSA_API STATUS LinkedList_insert(LinkedList* linkedlist, void* element);
+
+/**
+ * @brief Inserts an element at the beginning of the linked list in O(1).
+ * @details Equivalent to `LinkedList_insert`.
+ * @param linkedlist A pointer to the linked list.
+ * @param element A pointer to the element data to be copied into the new node.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if linked list or element is NULL.
+ * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
+ * @return `STATUS_ERR_OVERFLOW` if the linked list cannot grow further.
+ */
+DSA_API STATUS LinkedList_pushFront(LinkedList* linkedlist, const void* element);
+
+/**
+ * @brief Inserts an element at the end of the linked list in O(1).
+ * @param linkedlist A pointer to the linked list.
+ * @param element A pointer to the element data to be copied into the new node.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if linked list or element is NULL.
+ * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
+ * @return `STATUS_ERR_OVERFLOW` if the linked list cannot grow further.
+ */
+DSA_API STATUS LinkedList_pushBack(LinkedList* linkedlist, const void* element);
+
+/**
+ * @brief Removes the first element of the linked list in O(1).
+ * @param linkedlist A pointer to the linked list.
+ * @param elementOut A memory location that receives a copy of the removed element, or NULL to discard it.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if linked list is NULL.
+ * @return `STATUS_ERR_UNDERFLOW` if the linked list is empty.
+ */
+DSA_API STATUS LinkedList_popFront(LinkedList* linkedlist, void* elementOut);
+
+/**
+ * @brief Removes the last element of the linked list in O(1).
+ * @param linkedlist A pointer to the linked list.
+ * @param elementOut A memory location that receives a copy of the removed element, or NULL to discard it.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if linked list is NULL.
+ * @return `STATUS_ERR_UNDERFLOW` if the linked list is empty.
+ */
+DSA_API STATUS LinkedList_popBack(LinkedList* linkedlist, void* elementOut);
 
 /**
  * @brief Deletes an element at a specific 1-based index.
@@ -55,7 +136,7 @@ STATUS LinkedList_insert(LinkedList* linkedlist, void* element);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if the index is out of bounds.
  * @return `STATUS_ERR_UNDERFLOW` if the linked list is empty.
  */
-STATUS LinkedList_delete(LinkedList* linkedlist, size_t index);
+DSA_API STATUS LinkedList_delete(LinkedList* linkedlist, size_t index);
 
 /**
  * @brief Searches for an element using a custom comparison function.
@@ -68,7 +149,7 @@ STATUS LinkedList_delete(LinkedList* linkedlist, size_t index);
  * @return `STATUS_ERR_KEY_NOT_FOUND` if the key is not found.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if any pointer arguments are NULL.
  */
-STATUS LinkedList_search(LinkedList* linkedlist, void* key, size_t* index, int (*cmp)(void*, void*));
+DSA_API STATUS LinkedList_search(LinkedList* linkedlist, void* key, size_t* index, int (*cmp)(void*, void*));
 
 /**
  * @brief Retrieves a copy of an element from a specific 1-based index.
@@ -77,7 +158,7 @@ STATUS LinkedList_search(LinkedList* linkedlist, void* key, size_t* index, int (
  * @param elementOut A pointer to a memory location where the element's data will be copied.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` on failure or if the index is out of bounds.
  */
-STATUS LinkedList_get(LinkedList* linkedlist, size_t index, void* elementOut);
+DSA_API STATUS LinkedList_get(LinkedList* linkedlist, size_t index, void* elementOut);
 
 /**
  * @brief Updates the element at a specific 1-based index with new data.
@@ -86,7 +167,7 @@ STATUS LinkedList_get(LinkedList* linkedlist, size_t index, void* elementOut);
  * @param element A pointer to the new element data that will overwrite the existing data at the index.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` on failure or if the index is out of bounds.
  */
-STATUS LinkedList_set(LinkedList* linkedlist, size_t index, void* element);
+DSA_API STATUS LinkedList_set(LinkedList* linkedlist, size_t index, void* element);
 
 /**
  * @brief Iterates over each element and applies a callback function.
@@ -95,13 +176,110 @@ STATUS LinkedList_set(LinkedList* linkedlist, size_t index, void* element);
  * callback receives a pointer to the element's data within the linked list.
  * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if linked list or callback is NULL.
  */
-STATUS LinkedList_forEach(LinkedList* linkedlist, void (*callback)(void*));
+DSA_API STATUS LinkedList_forEach(LinkedList* linkedlist, void (*callback)(void*));
+
+/**
+ * @brief Iterates over the elements from head to tail with a context pointer, stopping early on request.
+ * @param linkedlist A pointer to the linked list.
+ * @param callback Called with a pointer to each element and `ctx`. Returning `false` stops the iteration.
+ * @param ctx An opaque pointer passed through to `callback`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if linked list or callback is NULL.
+ */
+DSA_API STATUS LinkedList_forEachCtx(LinkedList* linkedlist, bool (*callback)(void* element, void* ctx), void* ctx);
 
 /**
  * @brief Returns the number of elements currently in the linked list.
  * @param linkedlist A constant pointer to the linked list.
  * @return The number of elements as a `size_t`. Returns 0 if the linked list is NULL.
  */
-size_t LinkedList_size(const LinkedList* linkedlist);
+DSA_API size_t LinkedList_size(const LinkedList* linkedlist);
+
+/* --------------------------------- Splicing --------------------------------- */
+
+/**
+ * @brief Moves every node of `src` to the end of `dst` in O(1).
+ * @details No element is copied and no memory is allocated; `src` is left empty
+ * but still valid. Cursors into `src` now refer to nodes of `dst`.
+ * @param dst A pointer to the destination linked list.
+ * @param src A pointer to the source linked list. Must be a different list.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if either list is NULL, they are the same
+ * list, their data sizes differ, either list is pooled, or they use different
+ * allocators (such nodes cannot change owners).
+ * @return `STATUS_ERR_OVERFLOW` if the combined list would be too large.
+ */
+DSA_API STATUS LinkedList_concat(LinkedList* dst, LinkedList* src);
+
+/**
+ * @brief Moves every node of `src` into `dst`, in front of `position`, in O(1).
+ * @details Same rules as `LinkedList_concat`.
+ * @param dst A pointer to the destination linked list.
+ * @param position A cursor into `dst` before which the nodes are inserted, or NULL to append.
+ * @param src A pointer to the source linked list. Must be a different list.
+ * @return `STATUS_OK` on success, or the same errors as `LinkedList_concat`.
+ */
+DSA_API STATUS LinkedList_splice(LinkedList* dst, LinkedListNode* position, LinkedList* src);
+
+/* --------------------------------- Cursors --------------------------------- */
+
+/**
+ * @brief Returns a cursor to the first node, or NULL if the list is empty or NULL.
+ */
+DSA_API LinkedListNode* LinkedList_first(const LinkedList* linkedlist);
+
+/**
+ * @brief Returns a cursor to the last node, or NULL if the list is empty or NULL.
+ */
+DSA_API LinkedListNode* LinkedList_last(const LinkedList* linkedlist);
+
+/**
+ * @brief Returns a cursor to the node at a 1-based index.
+ * @details Walks from the nearer end, so the cost is at most size/2 steps.
+ * @return The cursor, or NULL if the list is NULL or the index is out of bounds.
+ */
+DSA_API LinkedListNode* LinkedList_nodeAt(const LinkedList* linkedlist, size_t index);
+
+/**
+ * @brief Returns the node following `node`, or NULL at the end of the list.
+ */
+DSA_API LinkedListNode* LinkedList_next(const LinkedListNode* node);
+
+/**
+ * @brief Returns the node preceding `node`, or NULL at the start of the list.
+ */
+DSA_API LinkedListNode* LinkedList_prev(const LinkedListNode* node);
+
+/**
+ * @brief Returns a pointer to the element stored in `node`, or NULL if `node` is NULL.
+ * @details The pointer may be used to read or modify the element in place while the node is in the list.
+ */
+DSA_API void* LinkedList_nodeData(LinkedListNode* node);
+
+/**
+ * @brief Inserts an element immediately before `node` in O(1).
+ * @param linkedlist A pointer to the linked list owning `node`.
+ * @param node A cursor into the list.
+ * @param element A pointer to the element data to be copied into the new node.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if any argument is NULL.
+ * @return `STATUS_ERR_ALLOC` if memory allocation for the new node fails.
+ * @return `STATUS_ERR_OVERFLOW` if the linked list cannot grow further.
+ */
+DSA_API STATUS LinkedList_insertBefore(LinkedList* linkedlist, LinkedListNode* node, const void* element);
+
+/**
+ * @brief Inserts an element immediately after `node` in O(1).
+ * @details Same arguments and return values as `LinkedList_insertBefore`.
+ */
+DSA_API STATUS LinkedList_insertAfter(LinkedList* linkedlist, LinkedListNode* node, const void* element);
+
+/**
+ * @brief Removes `node` from the list in O(1). The cursor becomes invalid.
+ * @param linkedlist A pointer to the linked list owning `node`.
+ * @param node A cursor into the list.
+ * @param elementOut A memory location that receives a copy of the removed element, or NULL to discard it.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if list or node is NULL.
+ */
+DSA_API STATUS LinkedList_removeNode(LinkedList* linkedlist, LinkedListNode* node, void* elementOut);
 
 #endif // LINKEDLIST_H
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * @file pool.h
+ * @brief Public API for a fixed-size block (slab) allocator.
+ *
+ * This file defines the interface for a memory pool that hands out blocks of
+ * one fixed size. Blocks are carved from large chunks obtained with `malloc`,
+ * and freed blocks are kept on an intrusive free list for reuse, so allocation
+ * and release are O(1) and neighbouring blocks share cache lines and pages.
+ *
+ * Node-based containers (LinkedList, AVLTree) can opt into a pool at
+ * initialization. Destroying such a container releases the pool's chunks in
+ * one pass instead of freeing every node individually.
+ */
+#ifndef POOL_H
+#define POOL_H
+
+#include "common.h"
+
+/**
+ * @struct Pool
+ * @brief An opaque struct representing the Pool allocator.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the Pool only through the public API functions
+ * defined in this file.
+ */
+typedef struct Pool Pool;
+
+/**
+ * @brief Initializes a new, empty pool.
+ * @details No memory for blocks is allocated until the first `Pool_alloc`.
+ * @param blockSize The size in bytes of every block handed out. Rounded up so
+ * that every block is suitably aligned for any object type.
+ * @param blocksPerChunk The number of blocks carved from each chunk. Pass 0 to
+ * let the pool choose a chunk of roughly 64 KiB.
+ * @return A pointer to the newly created Pool, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Pool* Pool_init(size_t blockSize, size_t blocksPerChunk);
+
+/**
+ * @brief Releases every chunk owned by the pool, and the pool itself.
+ * @details All blocks obtained from the pool become invalid, whether or not
+ * they were returned with `Pool_free`.
+ * @param pool A pointer to the pool to be destroyed.
+ */
+DSA_API void Pool_destroy(Pool* pool);
+
+/**
+ * @brief Allocates one block from the pool.
+ * @param pool A pointer to the pool.
+ * @return A pointer to an uninitialized block of `Pool_blockSize(pool)` bytes,
+ * or `NULL` if the pool is NULL or a new chunk cannot be allocated.
+ */
+DSA_API void* Pool_alloc(Pool* pool);
+
+/**
+ * @brief Returns a block to the pool for reuse.
+ * @param pool A pointer to the pool the block was allocated from.
+ * @param block A pointer previously returned by `Pool_alloc` on the same pool. May be NULL.
+ */
+DSA_API void Pool_free(Pool* pool, void* block);
+
+/**
+ * @brief Returns the size of the blocks handed out by the pool.
+ * @param pool A constant pointer to the pool.
+ * @return The (aligned) block size in bytes, or 0 if the pool is NULL.
+ */
+DSA_API size_t Pool_blockSize(const Pool* pool);
+
+#endif // POOL_H
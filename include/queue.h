@@ -3,14 +3,14 @@
  * @brief Public API for a generic queue data structure.
  *
  * This file defines the interface for a generic queue data structure.
- * It is implemented as an adapter over the existing LinkedList module,
- * providing classic FIFO (First-In, First-Out) operations.
+ * Elements are stored inline in a contiguous, power-of-two circular buffer
+ * that doubles when full, so enqueue, dequeue and peek are all O(1)
+ * (enqueue amortized), providing classic FIFO (First-In, First-Out) operations.
  */
 #ifndef QUEUE_H
 #define QUEUE_H
 
 #include "common.h"
-#include "linkedlist.h"
 
 /**
  * @struct Queue
@@ -26,15 +26,26 @@ typedef struct Queue Queue;
  * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
  * @return A pointer to the newly created Queue, or `NULL` on allocation failure.
  */
-Queue* Queue_init(size_t dataSize);
+DSA_API Queue* Queue_init(size_t dataSize);
+
+/**
+ * @brief Initializes a new, empty queue with preallocated storage.
+ * @details The capacity is rounded up to the next power of two. The queue still
+ * grows by doubling once this capacity is exhausted.
+ * @param capacity The number of elements to reserve room for. Can be 0, in which
+ * case storage is allocated on the first enqueue.
+ * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
+ * @return A pointer to the newly created Queue, or `NULL` on allocation failure or invalid arguments.
+ */
+DSA_API Queue* Queue_initWithCapacity(size_t capacity, size_t dataSize);
 
 /**
  * @brief Frees all memory associated with the queue.
- * @details Deallocates the underlying LinkedList and the Queue struct itself.
+ * @details Deallocates the ring buffer and the Queue struct itself.
  * The queue pointer becomes invalid after this call.
  * @param queue A pointer to the queue to be destroyed.
  */
-void Queue_destroy(Queue* queue);
+DSA_API void Queue_destroy(Queue* queue);
 
 /**
  * @brief Adds an element to the back of the queue.
@@ -43,8 +54,9 @@ void Queue_destroy(Queue* queue);
  * @return `STATUS_OK` on success.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or data is NULL.
  * @return `STATUS_ERR_ALLOC` if memory allocation fails.
+ * @return `STATUS_ERR_OVERFLOW` if the queue cannot grow any further.
  */
-STATUS Queue_enqueue(Queue* queue, void* data);
+DSA_API STATUS Queue_enqueue(Queue* queue, void* data);
 
 /**
  * @brief Removes the element from the front of the queue.
@@ -53,7 +65,18 @@ STATUS Queue_enqueue(Queue* queue, void* data);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if the queue is NULL.
  * @return `STATUS_ERR_UNDERFLOW` if the queue is empty.
  */
-STATUS Queue_dequeue(Queue* queue);
+DSA_API STATUS Queue_dequeue(Queue* queue);
+
+/**
+ * @brief Removes the element from the front of the queue and copies it out.
+ * @details Equivalent to `Queue_peek` followed by `Queue_dequeue`, in a single call.
+ * @param queue A pointer to the queue.
+ * @param elementOut A pointer to a memory location where the front element's data will be copied.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or elementOut is NULL.
+ * @return `STATUS_ERR_UNDERFLOW` if the queue is empty.
+ */
+DSA_API STATUS Queue_dequeueInto(Queue* queue, void* elementOut);
 
 /**
  * @brief Retrieves a copy of the front element without removing it.
@@ -63,13 +86,37 @@ STATUS Queue_dequeue(Queue* queue);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if queue or dataOut is NULL.
  * @return `STATUS_ERR_EMPTY` if the queue is empty.
  */
-STATUS Queue_peek(Queue* queue, void* dataOut);
+DSA_API STATUS Queue_peek(Queue* queue, void* dataOut);
+
+/**
+ * @brief Returns a pointer to the front element, without copying it.
+ * @details The element may be read or modified in place. The pointer stays
+ * valid until the next dequeue or enqueue (an enqueue may grow and move the
+ * buffer), or until the queue is destroyed.
+ * @param queue A constant pointer to the queue.
+ * @return A pointer to the front element, or NULL if the queue is NULL or empty.
+ */
+DSA_API void* Queue_front(const Queue* queue);
 
 /**
  * @brief Checks if the queue is empty.
  * @param queue A pointer to the queue.
  * @return `true` if the queue has no elements, `false` otherwise. Returns `true` if queue is NULL.
  */
-bool Queue_isEmpty(Queue* queue);
+DSA_API bool Queue_isEmpty(Queue* queue);
+
+/**
+ * @brief Returns the number of elements currently in the queue.
+ * @param queue A constant pointer to the queue.
+ * @return The number of elements as a `size_t`. Returns 0 if the queue is NULL.
+ */
+DSA_API size_t Queue_size(const Queue* queue);
+
+/**
+ * @brief Returns the number of elements the queue can hold before growing.
+ * @param queue A constant pointer to the queue.
+ * @return The current capacity (always 0 or a power of two). Returns 0 if the queue is NULL.
+ */
+DSA_API size_t Queue_capacity(const Queue* queue);
 
 #endif /* QUEUE_H */
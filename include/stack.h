@@ -3,14 +3,15 @@
  * @brief Public API for a generic, bounded stack data structure.
  *
  * This file defines the interface for a generic stack with a fixed capacity.
- * It is implemented as an adapter over the existing LinkedList data structure,
- * providing classic LIFO (Last-In, First-Out) operations.
+ * It is implemented as an adapter over the existing ArrayList data structure,
+ * providing classic LIFO (Last-In, First-Out) operations. The whole capacity
+ * is allocated up front as one contiguous buffer, so pushes and pops never
+ * allocate or free memory.
  */
 #ifndef STACK_H
 #define STACK_H
 
 #include "common.h"
-#include "linkedlist.h"
 
 /**
  * @struct Stack
@@ -24,18 +25,20 @@ typedef struct Stack Stack;
 /**
  * @brief Initializes a new, empty stack with a specified maximum size.
  * @param dataSize The size in bytes of each element to be stored (e.g., `sizeof(int)`).
- * @param stackSize The maximum number of elements the stack can hold.
- * @return A pointer to the newly created Stack, or `NULL` on allocation failure.
+ * @param stackSize The maximum number of elements the stack can hold. Storage
+ * for all of them is allocated immediately.
+ * @return A pointer to the newly created Stack, or `NULL` on allocation failure
+ * or if `dataSize` is 0 or `dataSize * stackSize` overflows.
  */
-Stack* Stack_init(size_t dataSize, size_t stackSize);
+DSA_API Stack* Stack_init(size_t dataSize, size_t stackSize);
 
 /**
  * @brief Frees all memory associated with the stack.
- * @details Deallocates the underlying LinkedList and the Stack struct itself.
+ * @details Deallocates the underlying ArrayList and the Stack struct itself.
  * The stack pointer becomes invalid after this call.
  * @param stack A pointer to the stack to be destroyed.
  */
-void Stack_destroy(Stack* stack);
+DSA_API void Stack_destroy(Stack* stack);
 
 /**
  * @brief Adds an element to the top of the stack.
@@ -43,10 +46,9 @@ void Stack_destroy(Stack* stack);
  * @param element A pointer to the element data to be copied onto the stack.
  * @return `STATUS_OK` on success.
  * @return `STATUS_ERR_INVALID_ARGUMENT` if stack or data is NULL.
- * @return `STATUS_ERR_ALLOC` if memory allocation for the LinkedList fails.
  * @return `STATUS_ERR_OVERFLOW` if the stack is full.
  */
-STATUS Stack_push(Stack* stack, void* element);
+DSA_API STATUS Stack_push(Stack* stack, void* element);
 
 /**
  * @brief Removes the top element from the stack.
@@ -55,7 +57,41 @@ STATUS Stack_push(Stack* stack, void* element);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if the stack is NULL.
  * @return `STATUS_ERR_UNDERFLOW` if the stack is empty.
  */
-STATUS Stack_pop(Stack* stack);
+DSA_API STATUS Stack_pop(Stack* stack);
+
+/**
+ * @brief Removes the top element from the stack and copies it out.
+ * @param stack A pointer to the stack.
+ * @param elementOut A memory location that receives the removed element, or NULL to discard it.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if the stack is NULL.
+ * @return `STATUS_ERR_UNDERFLOW` if the stack is empty.
+ */
+DSA_API STATUS Stack_popInto(Stack* stack, void* elementOut);
+
+/**
+ * @brief Pushes `count` elements in array order, so the last one ends up on top.
+ * @details Either all elements are pushed or, on error, none are.
+ * @param stack A pointer to the stack.
+ * @param elements A pointer to a contiguous array of `count` elements.
+ * @param count The number of elements to push.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if stack is NULL, or elements is NULL with a non-zero count.
+ * @return `STATUS_ERR_OVERFLOW` if the elements do not all fit below `stackSize`.
+ */
+DSA_API STATUS Stack_pushMany(Stack* stack, const void* elements, size_t count);
+
+/**
+ * @brief Pops `count` elements into `out` in pop order, so `out[0]` is the former top.
+ * @details Either all elements are popped or, on error, none are.
+ * @param stack A pointer to the stack.
+ * @param out A pointer to an array with room for `count` elements.
+ * @param count The number of elements to pop.
+ * @return `STATUS_OK` on success.
+ * @return `STATUS_ERR_INVALID_ARGUMENT` if stack is NULL, or out is NULL with a non-zero count.
+ * @return `STATUS_ERR_UNDERFLOW` if the stack holds fewer than `count` elements.
+ */
+DSA_API STATUS Stack_popMany(Stack* stack, void* out, size_t count);
 
 /**
  * @brief Retrieves a copy of the top element without removing it.
@@ -65,20 +101,37 @@ STATUS Stack_pop(Stack* stack);
  * @return `STATUS_ERR_INVALID_ARGUMENT` if stack or dataOut is NULL.
  * @return `STATUS_ERR_EMPTY` if the stack is empty.
  */
-STATUS Stack_peek(Stack* stack, void* dataOut);
+DSA_API STATUS Stack_peek(Stack* stack, void* dataOut);
+
+/**
+ * @brief Returns a pointer to the top element, without copying it.
+ * @details The element may be read or modified in place. Since the stack's
+ * storage never moves, the pointer refers to the same element until that
+ * element is popped, or the stack is destroyed.
+ * @param stack A constant pointer to the stack.
+ * @return A pointer to the top element, or NULL if the stack is NULL or empty.
+ */
+DSA_API void* Stack_top(const Stack* stack);
 
 /**
  * @brief Checks if the stack is empty.
  * @param stack A pointer to the stack.
  * @return `true` if the stack has no elements, `false` otherwise. Returns `true` if stack is NULL.
  */
-bool Stack_isEmpty(Stack* stack);
+DSA_API bool Stack_isEmpty(Stack* stack);
 
 /**
  * @brief Checks if the stack has reached its maximum capacity.
  * @param stack A pointer to the stack.
  * @return `true` if the number of elements equals the stack's maximum size, `false` otherwise.
  */
-bool Stack_isFull(Stack* stack);
+DSA_API bool Stack_isFull(Stack* stack);
+
+/**
+ * @brief Returns the number of elements currently on the stack.
+ * @param stack A constant pointer to the stack.
+ * @return The number of elements, or 0 if the stack is NULL.
+ */
+DSA_API size_t Stack_size(const Stack* stack);
 
 #endif /* STACK_H */
@@ -0,0 +1,85 @@
+/**
+ * @file stats.h
+ * @brief Opt-in instrumentation counters and trace hooks for the library's containers.
+ *
+ * When the library is compiled with `DSA_STATS` defined (`make DSA_STATS=1`),
+ * every `ArrayList`, `Heap`, `AVLTree` and `HashMap` keeps a `DsaStats` record
+ * of the work it has done, readable with its `*_getStats` function, and the
+ * hot operations of those containers call the trace hook installed with
+ * `Dsa_setTraceHook` on entry and exit.
+ *
+ * Without `DSA_STATS` none of this code is compiled in: the counters do not
+ * exist in the container structs, `*_getStats` reports all zeros and the hook
+ * is never called. The declarations below are the same in both builds.
+ *
+ * In a stats build even read-only operations such as searches update their
+ * container's counters, so a container must not then be read from several
+ * threads at once.
+ */
+#ifndef STATS_H
+#define STATS_H
+
+#include "common.h"
+
+/**
+ * @struct DsaStats
+ * @brief Work counters of one container instance. Counters that do not apply to a container stay 0.
+ */
+typedef struct DsaStats
+{
+    uint64_t reallocs;      // Storage growths and shrinks that move the buffer (ArrayList, Heap) and table rehashes (HashMap).
+    uint64_t bytesMoved;    // Bytes copied by reallocation, by shifting elements and by sifting heap elements.
+    uint64_t comparisons;   // Calls to the comparator, or to the key equality function of a HashMap.
+    uint64_t rotations;     // AVL rotations; a double rotation counts as two.
+    uint64_t maxHeight;     // The greatest height the AVL tree has had.
+    uint64_t probes;        // HashMap slots examined by lookups, insertions and removals.
+    uint64_t maxProbe;      // The longest single HashMap probe sequence.
+    uint64_t nodeAllocs;    // Nodes allocated (AVLTree).
+    uint64_t nodeFrees;     // Nodes freed (AVLTree).
+} DsaStats;
+
+/**
+ * @enum DsaTracePhase
+ * @brief Whether a trace event marks the start or the end of an operation.
+ */
+typedef enum DsaTracePhase
+{
+    DSA_TRACE_ENTER,
+    DSA_TRACE_EXIT
+} DsaTracePhase;
+
+/**
+ * @struct DsaTraceEvent
+ * @brief Describes one side of a traced operation.
+ */
+typedef struct DsaTraceEvent
+{
+    const char* container;  // The container type, e.g. "AVLTree".
+    const char* operation;  // The operation, e.g. "insert".
+    const void* instance;   // The container the operation runs on.
+    DsaTracePhase phase;    // Entry or exit.
+} DsaTraceEvent;
+
+/**
+ * @brief A trace hook, called with each event and the context given to `Dsa_setTraceHook`.
+ * @details The hook must not call back into the container being traced.
+ */
+typedef void (*DsaTraceHook)(const DsaTraceEvent* event, void* ctx);
+
+/**
+ * @brief Reports whether the library was compiled with `DSA_STATS`.
+ * @return `true` if counters and trace hooks are compiled in, `false` otherwise.
+ */
+DSA_API bool Dsa_statsEnabled(void);
+
+/**
+ * @brief Installs the process-wide trace hook, replacing any previous one.
+ * @details Install or remove the hook while no container operations are running
+ * on other threads. The hook itself may be called from any thread that uses a
+ * container. Has no effect unless `Dsa_statsEnabled()`.
+ * @param hook The hook to call around hot operations, or NULL to remove it.
+ * @param ctx An opaque pointer passed through to `hook`.
+ */
+DSA_API void Dsa_setTraceHook(DsaTraceHook hook, void* ctx);
+
+#endif // STATS_H
@@ -0,0 +1,73 @@
+/**
+ * @file threadpool.h
+ * @brief Public API for a fork-join thread pool with work stealing.
+ *
+ * A pool keeps a fixed set of worker threads parked until there is work.
+ * `ThreadPool_parallelFor` splits an index range between the workers and the
+ * calling thread, which takes part too. Each thread consumes its share a grain
+ * at a time from the front; a thread that runs out steals the back half of
+ * another thread's remaining range, so uneven work still balances out.
+ *
+ * Calls on one pool from several threads are serialized. A body that itself
+ * calls `ThreadPool_parallelFor` on the same pool runs the nested range on
+ * its own thread.
+ */
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include "common.h"
+
+/**
+ * @struct ThreadPool
+ * @brief An opaque struct representing the thread pool.
+ *
+ * The internal details are hidden to encapsulate the implementation.
+ * Users should interact with the ThreadPool only through the public API functions.
+ */
+typedef struct ThreadPool ThreadPool;
+
+/**
+ * @brief Starts a new thread pool.
+ * @param threads The number of threads that run a parallel loop, including the
+ * calling thread, so `threads - 1` workers are started. Pass 0 for one per online CPU.
+ * @return A pointer to the newly created ThreadPool, or `NULL` if memory or a thread cannot be obtained.
+ */
+DSA_API ThreadPool* ThreadPool_init(size_t threads);
+
+/**
+ * @brief Stops the workers and frees the pool.
+ * @details Must not be called while a parallel loop is running on the pool.
+ * @param pool A pointer to the pool to be destroyed. If NULL, the function does nothing.
+ */
+DSA_API void ThreadPool_destroy(ThreadPool* pool);
+
+/**
+ * @brief Returns a process-wide pool with one thread per online CPU.
+ * @details Created on first use and never destroyed.
+ * @return The shared pool, or `NULL` if it cannot be created.
+ */
+DSA_API ThreadPool* ThreadPool_default(void);
+
+/**
+ * @brief Returns the number of threads that run a parallel loop, the caller included.
+ * @param pool A constant pointer to the pool.
+ * @return The thread count, or 0 if the pool is NULL.
+ */
+DSA_API size_t ThreadPool_threadCount(const ThreadPool* pool);
+
+/**
+ * @brief Runs `body` over `[0, count)` split into subranges, in parallel, and waits for it to finish.
+ * @details Subranges are disjoint, cover the whole range and hold at most
+ * `grain` indices each; the order in which they run is unspecified.
+ * @param pool A pointer to the pool.
+ * @param count The number of indices.
+ * @param grain The largest subrange handed to `body` at once. Pass 0 to pick
+ * one that gives each thread several subranges.
+ * @param body Called with a subrange `[begin, end)` and `ctx`, from any of the pool's threads.
+ * @param ctx An opaque pointer passed through to `body`.
+ * @return `STATUS_OK` on success, or `STATUS_ERR_INVALID_ARGUMENT` if pool or body is NULL.
+ */
+DSA_API STATUS ThreadPool_parallelFor(ThreadPool* pool, size_t count, size_t grain,
+    void (*body)(size_t begin, size_t end, void* ctx), void* ctx);
+
+#endif // THREADPOOL_H
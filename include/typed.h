@@ -0,0 +1,535 @@
+/**
+ * @file typed.h
+ * @brief Macro-generated, type-specialized containers.
+ *
+ * The containers in the rest of this library are type-erased: elements are
+ * copied with a `dataSize`-long `memcpy` and compared through a `cmp` function
+ * pointer, neither of which the compiler can specialize. The macros in this
+ * header instead generate a complete container for one element type, as
+ * `static inline` functions, so element copies are plain assignments and the
+ * comparator is inlined at every call site.
+ *
+ * Each macro is expanded once, at file scope, in every translation unit that
+ * uses the generated type:
+ *
+ *     static inline bool event_less(const Event* a, const Event* b) { return a->time < b->time; }
+ *     HEAP_DEFINE(Event, event_less)     // Heap_Event, Heap_Event_push, ...
+ *     ARRAYLIST_DEFINE(int)              // ArrayList_int, ArrayList_int_insert, ...
+ *     AVLTREE_DEFINE(Key, Val, key_cmp)  // AVLTree_Key_Val, AVLTree_Key_Val_insert, ...
+ *
+ * The type names are pasted into the generated identifiers, so they must be
+ * single identifiers. For types such as `unsigned long` or `char*`, use a
+ * `typedef` or the `*_DEFINE_NAMED` variants, which take the name separately.
+ *
+ * The generated containers are plain structs owned by the caller. They are
+ * not opaque, but their fields should be treated as read-only.
+ */
+#ifndef TYPED_H
+#define TYPED_H
+
+#include "common.h"
+
+/**
+ * @brief The capacity of the first allocation of a generated container.
+ */
+#define TYPED_DEFAULT_CAPACITY 8
+
+/**
+ * @internal
+ * @brief Computes the doubled capacity a generated container grows to in order to hold `needed` elements.
+ * @return The new capacity, or 0 if `needed` elements of `elementSize` bytes would overflow.
+ */
+static inline size_t _Typed_grownCapacity(size_t capacity, size_t elementSize, size_t needed)
+{
+    if (needed > SIZE_MAX / elementSize) return 0;
+
+    size_t newCapacity = capacity == 0 ? TYPED_DEFAULT_CAPACITY : capacity;
+    while (newCapacity < needed)
+        newCapacity = newCapacity > SIZE_MAX / 2 ? needed : newCapacity * 2;
+    return newCapacity <= SIZE_MAX / elementSize ? newCapacity : needed;
+}
+
+/* ============================================================================
+ * ArrayList
+ * ========================================================================== */
+
+/**
+ * @brief Generates `ArrayList_T`, a dynamic array of `T`.
+ * @details Expands to `ARRAYLIST_DEFINE_NAMED(T, T)`.
+ */
+#define ARRAYLIST_DEFINE(T) ARRAYLIST_DEFINE_NAMED(T, T)
+
+/**
+ * @brief Generates `ArrayList_Name`, a dynamic array of `T`.
+ *
+ * Generated API (all `static inline`):
+ * - `void ArrayList_Name_init(ArrayList_Name* list)` — initializes an empty list; never allocates.
+ * - `void ArrayList_Name_destroy(ArrayList_Name* list)` — frees the storage and leaves the list empty.
+ * - `STATUS ArrayList_Name_reserve(ArrayList_Name* list, size_t capacity)` — grows to exactly `capacity`.
+ * - `STATUS ArrayList_Name_insert(ArrayList_Name* list, T element)` — appends, doubling the capacity when full.
+ * - `STATUS ArrayList_Name_delete(ArrayList_Name* list, size_t index)` — removes and shifts later elements left.
+ * - `T* ArrayList_Name_at(const ArrayList_Name* list, size_t index)` — borrowed pointer, or NULL out of bounds.
+ * - `STATUS ArrayList_Name_get(const ArrayList_Name* list, size_t index, T* elementOut)`
+ * - `STATUS ArrayList_Name_set(ArrayList_Name* list, size_t index, T element)`
+ * - `void ArrayList_Name_clear(ArrayList_Name* list)` — empties the list, keeping the capacity.
+ * - `size_t ArrayList_Name_size(const ArrayList_Name* list)`
+ *
+ * Errors are reported with the same `STATUS` codes as `ArrayList`. Pointers
+ * from `_at` and the `data` field are invalidated by insert, delete and reserve.
+ */
+#define ARRAYLIST_DEFINE_NAMED(Name, T)                                                         \
+    typedef struct ArrayList_##Name                                                             \
+    {                                                                                           \
+        T* data;         /* Contiguous storage for `capacity` elements. */                      \
+        size_t size;     /* The current number of elements. */                                  \
+        size_t capacity; /* The number of elements the storage can hold. */                     \
+    } ArrayList_##Name;                                                                         \
+                                                                                                \
+    static inline void ArrayList_##Name##_init(ArrayList_##Name* list)                          \
+    {                                                                                           \
+        list->data = NULL;                                                                      \
+        list->size = 0;                                                                         \
+        list->capacity = 0;                                                                     \
+    }                                                                                           \
+                                                                                                \
+    static inline void ArrayList_##Name##_destroy(ArrayList_##Name* list)                       \
+    {                                                                                           \
+        if (!list) return;                                                                      \
+        free(list->data);                                                                       \
+        ArrayList_##Name##_init(list);                                                          \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS ArrayList_##Name##_reserve(ArrayList_##Name* list, size_t capacity)    \
+    {                                                                                           \
+        if (capacity <= list->capacity) return STATUS_OK;                                       \
+        if (capacity > SIZE_MAX / sizeof(T)) return STATUS_ERR_OVERFLOW;                        \
+        T* data = (T*)realloc(list->data, capacity * sizeof(T));                                \
+        if (!data) return STATUS_ERR_ALLOC;                                                     \
+        list->data = data;                                                                      \
+        list->capacity = capacity;                                                              \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS ArrayList_##Name##_insert(ArrayList_##Name* list, T element)           \
+    {                                                                                           \
+        if (list->size == list->capacity) {                                                     \
+            size_t capacity = list->size == SIZE_MAX ? 0                                        \
+                : _Typed_grownCapacity(list->capacity, sizeof(T), list->size + 1);              \
+            if (capacity == 0) return STATUS_ERR_OVERFLOW;                                      \
+            STATUS status = ArrayList_##Name##_reserve(list, capacity);                         \
+            if (status != STATUS_OK) return status;                                             \
+        }                                                                                       \
+        list->data[list->size++] = element;                                                     \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS ArrayList_##Name##_delete(ArrayList_##Name* list, size_t index)        \
+    {                                                                                           \
+        if (list->size == 0) return STATUS_ERR_UNDERFLOW;                                       \
+        if (index >= list->size) return STATUS_ERR_INVALID_ARGUMENT;                            \
+        memmove(list->data + index, list->data + index + 1,                                     \
+            (list->size - index - 1) * sizeof(T));                                              \
+        list->size--;                                                                           \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline T* ArrayList_##Name##_at(const ArrayList_##Name* list, size_t index)          \
+    {                                                                                           \
+        return index < list->size ? list->data + index : NULL;                                  \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS ArrayList_##Name##_get(const ArrayList_##Name* list, size_t index,     \
+        T* elementOut)                                                                          \
+    {                                                                                           \
+        if (!elementOut || index >= list->size) return STATUS_ERR_INVALID_ARGUMENT;             \
+        *elementOut = list->data[index];                                                        \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS ArrayList_##Name##_set(ArrayList_##Name* list, size_t index, T element) \
+    {                                                                                           \
+        if (index >= list->size) return STATUS_ERR_INVALID_ARGUMENT;                            \
+        list->data[index] = element;                                                            \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline void ArrayList_##Name##_clear(ArrayList_##Name* list)                         \
+    {                                                                                           \
+        list->size = 0;                                                                         \
+    }                                                                                           \
+                                                                                                \
+    static inline size_t ArrayList_##Name##_size(const ArrayList_##Name* list)                  \
+    {                                                                                           \
+        return list->size;                                                                      \
+    }
+
+/* ============================================================================
+ * Heap
+ * ========================================================================== */
+
+/**
+ * @brief Generates `Heap_T`, a binary heap of `T` ordered by `less`.
+ * @details Expands to `HEAP_DEFINE_NAMED(T, T, less)`.
+ */
+#define HEAP_DEFINE(T, less) HEAP_DEFINE_NAMED(T, T, less)
+
+/**
+ * @brief Generates `Heap_Name`, a binary heap of `T` ordered by `less`.
+ *
+ * `less` is a function or function-like macro taking `(const T* a, const T* b)`
+ * and returning non-zero when `a` must be closer to the root than `b`. A `<`
+ * comparison gives a min-heap, `>` a max-heap.
+ *
+ * Generated API (all `static inline`):
+ * - `void Heap_Name_init(Heap_Name* heap)` — initializes an empty heap; never allocates.
+ * - `void Heap_Name_destroy(Heap_Name* heap)` — frees the storage and leaves the heap empty.
+ * - `STATUS Heap_Name_reserve(Heap_Name* heap, size_t capacity)`
+ * - `STATUS Heap_Name_push(Heap_Name* heap, T element)`
+ * - `STATUS Heap_Name_pop(Heap_Name* heap, T* elementOut)` — `elementOut` may be NULL; `STATUS_ERR_UNDERFLOW` when empty.
+ * - `const T* Heap_Name_top(const Heap_Name* heap)` — borrowed root, or NULL when empty; invalidated by push and pop.
+ * - `size_t Heap_Name_size(const Heap_Name* heap)`
+ */
+#define HEAP_DEFINE_NAMED(Name, T, less)                                                        \
+    typedef struct Heap_##Name                                                                  \
+    {                                                                                           \
+        T* data;         /* The heap array; the root is data[0]. */                             \
+        size_t size;     /* The current number of elements. */                                  \
+        size_t capacity; /* The number of elements the storage can hold. */                     \
+    } Heap_##Name;                                                                              \
+                                                                                                \
+    static inline void Heap_##Name##_init(Heap_##Name* heap)                                    \
+    {                                                                                           \
+        heap->data = NULL;                                                                      \
+        heap->size = 0;                                                                         \
+        heap->capacity = 0;                                                                     \
+    }                                                                                           \
+                                                                                                \
+    static inline void Heap_##Name##_destroy(Heap_##Name* heap)                                 \
+    {                                                                                           \
+        if (!heap) return;                                                                      \
+        free(heap->data);                                                                       \
+        Heap_##Name##_init(heap);                                                               \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS Heap_##Name##_reserve(Heap_##Name* heap, size_t capacity)             \
+    {                                                                                           \
+        if (capacity <= heap->capacity) return STATUS_OK;                                       \
+        if (capacity > SIZE_MAX / sizeof(T)) return STATUS_ERR_OVERFLOW;                        \
+        T* data = (T*)realloc(heap->data, capacity * sizeof(T));                                \
+        if (!data) return STATUS_ERR_ALLOC;                                                     \
+        heap->data = data;                                                                      \
+        heap->capacity = capacity;                                                              \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    /* Moves the hole at `index` towards the root until `item` fits, then fills it. */          \
+    static inline void _Heap_##Name##_siftUp(Heap_##Name* heap, size_t index, T item)           \
+    {                                                                                           \
+        while (index > 0) {                                                                     \
+            size_t parent = (index - 1) / 2;                                                    \
+            if (!less(&item, &heap->data[parent])) break;                                       \
+            heap->data[index] = heap->data[parent];                                             \
+            index = parent;                                                                     \
+        }                                                                                       \
+        heap->data[index] = item;                                                               \
+    }                                                                                           \
+                                                                                                \
+    /* Moves the hole at `index` towards the leaves until `item` fits, then fills it. */        \
+    static inline void _Heap_##Name##_siftDown(Heap_##Name* heap, size_t index, T item)         \
+    {                                                                                           \
+        size_t size = heap->size;                                                               \
+        for (;;) {                                                                              \
+            size_t child = 2 * index + 1;                                                       \
+            if (child >= size) break;                                                           \
+            if (child + 1 < size && less(&heap->data[child + 1], &heap->data[child]))           \
+                child++;                                                                        \
+            if (!less(&heap->data[child], &item)) break;                                        \
+            heap->data[index] = heap->data[child];                                              \
+            index = child;                                                                      \
+        }                                                                                       \
+        heap->data[index] = item;                                                               \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS Heap_##Name##_push(Heap_##Name* heap, T element)                       \
+    {                                                                                           \
+        if (heap->size == heap->capacity) {                                                     \
+            size_t capacity = heap->size == SIZE_MAX ? 0                                        \
+                : _Typed_grownCapacity(heap->capacity, sizeof(T), heap->size + 1);              \
+            if (capacity == 0) return STATUS_ERR_OVERFLOW;                                      \
+            STATUS status = Heap_##Name##_reserve(heap, capacity);                              \
+            if (status != STATUS_OK) return status;                                             \
+        }                                                                                       \
+        _Heap_##Name##_siftUp(heap, heap->size++, element);                                     \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS Heap_##Name##_pop(Heap_##Name* heap, T* elementOut)                    \
+    {                                                                                           \
+        if (heap->size == 0) return STATUS_ERR_UNDERFLOW;                                       \
+        if (elementOut) *elementOut = heap->data[0];                                            \
+        heap->size--;                                                                           \
+        if (heap->size > 0) _Heap_##Name##_siftDown(heap, 0, heap->data[heap->size]);           \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline const T* Heap_##Name##_top(const Heap_##Name* heap)                           \
+    {                                                                                           \
+        return heap->size > 0 ? heap->data : NULL;                                              \
+    }                                                                                           \
+                                                                                                \
+    static inline size_t Heap_##Name##_size(const Heap_##Name* heap)                            \
+    {                                                                                           \
+        return heap->size;                                                                      \
+    }
+
+/* ============================================================================
+ * AVLTree
+ * ========================================================================== */
+
+/**
+ * @brief Generates `AVLTree_K_V`, an ordered map from `K` to `V`.
+ * @details Expands to `AVLTREE_DEFINE_NAMED(K##_##V, K, V, cmp)`.
+ */
+#define AVLTREE_DEFINE(K, V, cmp) AVLTREE_DEFINE_NAMED(K##_##V, K, V, cmp)
+
+/**
+ * @brief Generates `AVLTree_Name`, an AVL-balanced ordered map from `K` to `V`.
+ *
+ * `cmp` is a function or function-like macro taking `(const K* a, const K* b)`
+ * and returning a negative, zero or positive value, like the comparators of `AVLTree`.
+ *
+ * Generated API (all `static inline`):
+ * - `void AVLTree_Name_init(AVLTree_Name* tree)` — initializes an empty tree.
+ * - `void AVLTree_Name_destroy(AVLTree_Name* tree)` — frees every node and leaves the tree empty.
+ * - `STATUS AVLTree_Name_insert(AVLTree_Name* tree, K key, V value)` — `STATUS_ERR_DUPLICATE_KEY` if present.
+ * - `STATUS AVLTree_Name_delete(AVLTree_Name* tree, const K* key)` — `STATUS_ERR_KEY_NOT_FOUND` if absent.
+ * - `V* AVLTree_Name_search(const AVLTree_Name* tree, const K* key)` — borrowed value, or NULL; valid until its key is deleted.
+ * - `void AVLTree_Name_forEach(const AVLTree_Name* tree, void (*callback)(const K*, V*))` — in key order.
+ * - `void AVLTree_Name_forEachCtx(const AVLTree_Name* tree, bool (*callback)(const K*, V*, void* ctx), void* ctx)`
+ *   — in key order, stopping once `callback` returns false.
+ * - `size_t AVLTree_Name_size(const AVLTree_Name* tree)`
+ */
+#define AVLTREE_DEFINE_NAMED(Name, K, V, cmp)                                                   \
+    typedef struct AVLTreeNode_##Name                                                           \
+    {                                                                                           \
+        K key;                                                                                  \
+        V value;                                                                                \
+        struct AVLTreeNode_##Name* left;                                                        \
+        struct AVLTreeNode_##Name* right;                                                       \
+        int height;      /* Height of the subtree rooted here; a leaf has height 1. */          \
+    } AVLTreeNode_##Name;                                                                       \
+                                                                                                \
+    typedef struct AVLTree_##Name                                                               \
+    {                                                                                           \
+        AVLTreeNode_##Name* root;                                                               \
+        size_t size;     /* The current number of keys. */                                      \
+    } AVLTree_##Name;                                                                           \
+                                                                                                \
+    static inline void AVLTree_##Name##_init(AVLTree_##Name* tree)                              \
+    {                                                                                           \
+        tree->root = NULL;                                                                      \
+        tree->size = 0;                                                                         \
+    }                                                                                           \
+                                                                                                \
+    static inline void _AVLTree_##Name##_freeNodes(AVLTreeNode_##Name* node)                           \
+    {                                                                                           \
+        while (node) {                                                                          \
+            _AVLTree_##Name##_freeNodes(node->left);                                            \
+            AVLTreeNode_##Name* right = node->right;                                            \
+            free(node);                                                                         \
+            node = right;                                                                       \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline void AVLTree_##Name##_destroy(AVLTree_##Name* tree)                           \
+    {                                                                                           \
+        if (!tree) return;                                                                      \
+        _AVLTree_##Name##_freeNodes(tree->root);                                                \
+        AVLTree_##Name##_init(tree);                                                            \
+    }                                                                                           \
+                                                                                                \
+    static inline int _AVLTree_##Name##_height(const AVLTreeNode_##Name* node)                  \
+    {                                                                                           \
+        return node ? node->height : 0;                                                         \
+    }                                                                                           \
+                                                                                                \
+    static inline void _AVLTree_##Name##_updateHeight(AVLTreeNode_##Name* node)                 \
+    {                                                                                           \
+        int left = _AVLTree_##Name##_height(node->left);                                        \
+        int right = _AVLTree_##Name##_height(node->right);                                      \
+        node->height = 1 + (left > right ? left : right);                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_rotateRight(AVLTreeNode_##Name* y)      \
+    {                                                                                           \
+        AVLTreeNode_##Name* x = y->left;                                                        \
+        y->left = x->right;                                                                     \
+        x->right = y;                                                                           \
+        _AVLTree_##Name##_updateHeight(y);                                                      \
+        _AVLTree_##Name##_updateHeight(x);                                                      \
+        return x;                                                                               \
+    }                                                                                           \
+                                                                                                \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_rotateLeft(AVLTreeNode_##Name* x)       \
+    {                                                                                           \
+        AVLTreeNode_##Name* y = x->right;                                                       \
+        x->right = y->left;                                                                     \
+        y->left = x;                                                                            \
+        _AVLTree_##Name##_updateHeight(x);                                                      \
+        _AVLTree_##Name##_updateHeight(y);                                                      \
+        return y;                                                                               \
+    }                                                                                           \
+                                                                                                \
+    /* Restores the AVL property at `node` after one of its subtrees changed height by one. */  \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_rebalance(AVLTreeNode_##Name* node)     \
+    {                                                                                           \
+        _AVLTree_##Name##_updateHeight(node);                                                   \
+        int balance = _AVLTree_##Name##_height(node->left) - _AVLTree_##Name##_height(node->right); \
+        if (balance > 1) {                                                                      \
+            if (_AVLTree_##Name##_height(node->left->left) < _AVLTree_##Name##_height(node->left->right)) \
+                node->left = _AVLTree_##Name##_rotateLeft(node->left);                          \
+            return _AVLTree_##Name##_rotateRight(node);                                         \
+        }                                                                                       \
+        if (balance < -1) {                                                                     \
+            if (_AVLTree_##Name##_height(node->right->right) < _AVLTree_##Name##_height(node->right->left)) \
+                node->right = _AVLTree_##Name##_rotateRight(node->right);                       \
+            return _AVLTree_##Name##_rotateLeft(node);                                          \
+        }                                                                                       \
+        return node;                                                                            \
+    }                                                                                           \
+                                                                                                \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_insert(AVLTreeNode_##Name* node, const K* key, \
+        const V* value, STATUS* status)                                                         \
+    {                                                                                           \
+        if (!node) {                                                                            \
+            AVLTreeNode_##Name* newNode = (AVLTreeNode_##Name*)malloc(sizeof(AVLTreeNode_##Name)); \
+            if (!newNode) {                                                                     \
+                *status = STATUS_ERR_ALLOC;                                                     \
+                return NULL;                                                                    \
+            }                                                                                   \
+            newNode->key = *key;                                                                \
+            newNode->value = *value;                                                            \
+            newNode->left = newNode->right = NULL;                                              \
+            newNode->height = 1;                                                                \
+            *status = STATUS_OK;                                                                \
+            return newNode;                                                                     \
+        }                                                                                       \
+        int order = cmp(key, &node->key);                                                       \
+        if (order == 0) {                                                                       \
+            *status = STATUS_ERR_DUPLICATE_KEY;                                                 \
+            return node;                                                                        \
+        }                                                                                       \
+        if (order < 0) node->left = _AVLTree_##Name##_insert(node->left, key, value, status);   \
+        else node->right = _AVLTree_##Name##_insert(node->right, key, value, status);           \
+        /* A failed insert leaves the subtree untouched, so there is nothing to rebalance. */   \
+        return *status == STATUS_OK ? _AVLTree_##Name##_rebalance(node) : node;                 \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS AVLTree_##Name##_insert(AVLTree_##Name* tree, K key, V value)          \
+    {                                                                                           \
+        STATUS status = STATUS_OK;                                                              \
+        tree->root = _AVLTree_##Name##_insert(tree->root, &key, &value, &status);               \
+        if (status == STATUS_OK) tree->size++;                                                  \
+        return status;                                                                          \
+    }                                                                                           \
+                                                                                                \
+    /* Detaches the minimum node of a non-empty subtree into `minOut`. */                       \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_detachMin(AVLTreeNode_##Name* node,            \
+        AVLTreeNode_##Name** minOut)                                                            \
+    {                                                                                           \
+        if (!node->left) {                                                                      \
+            *minOut = node;                                                                     \
+            return node->right;                                                                 \
+        }                                                                                       \
+        node->left = _AVLTree_##Name##_detachMin(node->left, minOut);                           \
+        return _AVLTree_##Name##_rebalance(node);                                               \
+    }                                                                                           \
+                                                                                                \
+    static inline AVLTreeNode_##Name* _AVLTree_##Name##_delete(AVLTreeNode_##Name* node, const K* key, \
+        bool* found)                                                                            \
+    {                                                                                           \
+        if (!node) return NULL;                                                                 \
+        int order = cmp(key, &node->key);                                                       \
+        if (order < 0) {                                                                        \
+            node->left = _AVLTree_##Name##_delete(node->left, key, found);                      \
+        } else if (order > 0) {                                                                 \
+            node->right = _AVLTree_##Name##_delete(node->right, key, found);                    \
+        } else {                                                                                \
+            *found = true;                                                                      \
+            AVLTreeNode_##Name* replacement;                                                    \
+            if (!node->left || !node->right) {                                                  \
+                replacement = node->left ? node->left : node->right;                            \
+                free(node);                                                                     \
+                return replacement;                                                             \
+            }                                                                                   \
+            /* Relink the in-order successor in place of the node instead of copying it. */     \
+            AVLTreeNode_##Name* right = _AVLTree_##Name##_detachMin(node->right, &replacement); \
+            replacement->left = node->left;                                                     \
+            replacement->right = right;                                                         \
+            free(node);                                                                         \
+            node = replacement;                                                                 \
+        }                                                                                       \
+        return *found ? _AVLTree_##Name##_rebalance(node) : node;                               \
+    }                                                                                           \
+                                                                                                \
+    static inline STATUS AVLTree_##Name##_delete(AVLTree_##Name* tree, const K* key)            \
+    {                                                                                           \
+        if (!key) return STATUS_ERR_INVALID_ARGUMENT;                                           \
+        bool found = false;                                                                     \
+        tree->root = _AVLTree_##Name##_delete(tree->root, key, &found);                         \
+        if (!found) return STATUS_ERR_KEY_NOT_FOUND;                                            \
+        tree->size--;                                                                           \
+        return STATUS_OK;                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline V* AVLTree_##Name##_search(const AVLTree_##Name* tree, const K* key)          \
+    {                                                                                           \
+        AVLTreeNode_##Name* node = tree->root;                                                  \
+        while (node) {                                                                          \
+            int order = cmp(key, &node->key);                                                   \
+            if (order == 0) return &node->value;                                                \
+            node = order < 0 ? node->left : node->right;                                        \
+        }                                                                                       \
+        return NULL;                                                                            \
+    }                                                                                           \
+                                                                                                \
+    static inline void _AVLTree_##Name##_forEach(AVLTreeNode_##Name* node,                             \
+        void (*callback)(const K*, V*))                                                         \
+    {                                                                                           \
+        while (node) {                                                                          \
+            _AVLTree_##Name##_forEach(node->left, callback);                                    \
+            callback(&node->key, &node->value);                                                 \
+            node = node->right;                                                                 \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    static inline void AVLTree_##Name##_forEach(const AVLTree_##Name* tree,                     \
+        void (*callback)(const K*, V*))                                                         \
+    {                                                                                           \
+        if (callback) _AVLTree_##Name##_forEach(tree->root, callback);                          \
+    }                                                                                           \
+                                                                                                \
+    /* Returns false once `callback` has asked to stop. */                                     \
+    static inline bool _AVLTree_##Name##_forEachCtx(AVLTreeNode_##Name* node,                   \
+        bool (*callback)(const K*, V*, void*), void* ctx)                                       \
+    {                                                                                           \
+        while (node) {                                                                          \
+            if (!_AVLTree_##Name##_forEachCtx(node->left, callback, ctx)) return false;         \
+            if (!callback(&node->key, &node->value, ctx)) return false;                         \
+            node = node->right;                                                                 \
+        }                                                                                       \
+        return true;                                                                            \
+    }                                                                                           \
+                                                                                                \
+    static inline void AVLTree_##Name##_forEachCtx(const AVLTree_##Name* tree,                  \
+        bool (*callback)(const K*, V*, void*), void* ctx)                                       \
+    {                                                                                           \
+        if (callback) _AVLTree_##Name##_forEachCtx(tree->root, callback, ctx);                  \
+    }                                                                                           \
+                                                                                                \
+    static inline size_t AVLTree_##Name##_size(const AVLTree_##Name* tree)                      \
+    {                                                                                           \
+        return tree->size;                                                                      \
+    }
+
+#endif // TYPED_H
@@ -0,0 +1,32 @@
+#include "allocator_internal.h"
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+static void* _Dsa_heapAlloc(void* ctx, size_t size)
+{
+    (void)ctx;
+    return malloc(size);
+}
+
+static void* _Dsa_heapRealloc(void* ctx, void* ptr, size_t oldSize, size_t newSize)
+{
+    (void)ctx;
+    (void)oldSize;
+    return realloc(ptr, newSize);
+}
+
+static void _Dsa_heapFree(void* ctx, void* ptr, size_t size)
+{
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+/* ----------------------------- Shared Definitions ----------------------------- */
+
+const DsaAllocator _Dsa_defaultAllocator = {
+    _Dsa_heapAlloc,
+    _Dsa_heapRealloc,
+    _Dsa_heapFree,
+    NULL,
+};
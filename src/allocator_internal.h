@@ -0,0 +1,75 @@
+/**
+ * @file allocator_internal.h
+ * @internal
+ * @brief Helpers through which containers call their DsaAllocator.
+ *
+ * This header is not installed.
+ */
+#ifndef ALLOCATOR_INTERNAL_H
+#define ALLOCATOR_INTERNAL_H
+
+#include "../include/allocator.h"
+
+/**
+ * @internal
+ * @brief The allocator used by every plain `*_init` function: `malloc`, `realloc` and `free`.
+ */
+extern const DsaAllocator _Dsa_defaultAllocator;
+
+/**
+ * @internal
+ * @brief Validates an allocator passed to an `*_initWithAllocator` function.
+ * @return `allocator`, the default allocator if it is NULL, or NULL if it has no `alloc` callback.
+ */
+static inline const DsaAllocator* _Dsa_resolve(const DsaAllocator* allocator)
+{
+    if (!allocator) return &_Dsa_defaultAllocator;
+    return allocator->alloc ? allocator : NULL;
+}
+
+static inline void* _Dsa_alloc(const DsaAllocator* allocator, size_t size)
+{
+    return allocator->alloc(allocator->ctx, size);
+}
+
+static inline void _Dsa_free(const DsaAllocator* allocator, void* ptr, size_t size)
+{
+    if (ptr && allocator->free) allocator->free(allocator->ctx, ptr, size);
+}
+
+/**
+ * @internal
+ * @brief Resizes a block, emulating `realloc` with alloc + copy + free when the allocator has none.
+ * @return The new block, or NULL on failure with the old block still valid.
+ */
+static inline void* _Dsa_realloc(const DsaAllocator* allocator, void* ptr, size_t oldSize, size_t newSize)
+{
+    if (allocator->realloc) return allocator->realloc(allocator->ctx, ptr, oldSize, newSize);
+
+    void* block = allocator->alloc(allocator->ctx, newSize);
+    if (block && ptr) {
+        memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+        _Dsa_free(allocator, ptr, oldSize);
+    }
+    return block;
+}
+
+/**
+ * @internal
+ * @brief Whether memory must be returned block by block; false for bulk allocators such as arenas.
+ */
+static inline bool _Dsa_freesIndividually(const DsaAllocator* allocator)
+{
+    return allocator->free != NULL;
+}
+
+/**
+ * @internal
+ * @brief Whether blocks from one allocator may be released through the other.
+ */
+static inline bool _Dsa_sameAllocator(const DsaAllocator* a, const DsaAllocator* b)
+{
+    return a->alloc == b->alloc && a->realloc == b->realloc && a->free == b->free && a->ctx == b->ctx;
+}
+
+#endif // ALLOCATOR_INTERNAL_H
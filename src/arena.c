@@ -0,0 +1,185 @@
+#include "../include/arena.h"
+
+/**
+ * @internal
+ * @brief Chunk size used when `Arena_init` is given 0.
+ */
+#define ARENA_DEFAULT_CHUNK (64 * 1024)
+
+/**
+ * @internal
+ * @brief Alignment of every block, enough for any object type.
+ */
+#define ARENA_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * @internal
+ * @struct ArenaChunk
+ * @brief A block of memory obtained with `malloc`, carved up by bump allocation.
+ */
+typedef struct ArenaChunk
+{
+    struct ArenaChunk* next;                    // The next chunk; later chunks were added later.
+    size_t capacity;                            // The usable size of `data` in bytes.
+    max_align_t data[];                         // The memory handed out, maximally aligned.
+} ArenaChunk;
+
+/**
+ * @internal
+ * @struct Arena
+ * @brief Defines the internal structure of the arena.
+ * @details Chunks before `current` are full, `current` is being bumped through,
+ * and chunks after it are spares kept by `Arena_reset`.
+ */
+struct Arena
+{
+    ArenaChunk* head;                           // The first chunk, or NULL before the first allocation.
+    ArenaChunk* current;                        // The chunk allocations are taken from.
+    size_t offset;                              // Bytes of `current` already handed out.
+    size_t chunkSize;                           // The usual capacity of a new chunk.
+    size_t used;                                // Bytes handed out since the last reset.
+    void* last;                                 // The most recent block, which can grow in place.
+};
+
+/* ----------------------------------------Private Helper Functions---------------------------------------- */
+
+/**
+ * @internal
+ * @brief Rounds `size` up to a multiple of `ARENA_ALIGNMENT`, or returns 0 on overflow.
+ */
+static size_t _Arena_align(size_t size)
+{
+    if (size > SIZE_MAX - (ARENA_ALIGNMENT - 1)) return 0;
+    return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+/**
+ * @internal
+ * @brief Makes a chunk with room for `size` bytes the current one.
+ * @details Reuses the next spare chunk if it is big enough; otherwise a new
+ * chunk is linked in after `current`, so spares are never lost.
+ * @return `true` on success, `false` on allocation failure.
+ */
+static bool _Arena_advance(Arena* arena, size_t size)
+{
+    ArenaChunk* spare = arena->current ? arena->current->next : arena->head;
+    if (spare && spare->capacity >= size) {
+        arena->current = spare;
+        arena->offset = 0;
+        return true;
+    }
+
+    size_t capacity = size > arena->chunkSize ? size : arena->chunkSize;
+    if (capacity > SIZE_MAX - sizeof(ArenaChunk)) return false;
+    ArenaChunk* chunk = malloc(sizeof(ArenaChunk) + capacity);
+    if (!chunk) return false;
+
+    chunk->capacity = capacity;
+    chunk->next = spare;
+    if (arena->current) arena->current->next = chunk;
+    else arena->head = chunk;
+    arena->current = chunk;
+    arena->offset = 0;
+    return true;
+}
+
+/**
+ * @internal
+ * @brief `DsaAllocator.alloc` callback.
+ */
+static void* _Arena_allocCallback(void* ctx, size_t size)
+{
+    return Arena_alloc(ctx, size);
+}
+
+/**
+ * @internal
+ * @brief `DsaAllocator.realloc` callback. Grows or shrinks the most recent
+ * block in place when it fits in its chunk; otherwise allocates and copies.
+ */
+static void* _Arena_reallocCallback(void* ctx, void* ptr, size_t oldSize, size_t newSize)
+{
+    Arena* arena = ctx;
+    if (ptr && ptr == arena->last) {
+        size_t start = (size_t)((unsigned char*)ptr - (unsigned char*)arena->current->data);
+        size_t aligned = _Arena_align(newSize);
+        if (aligned != 0 && aligned <= arena->current->capacity - start) {
+            arena->used = arena->used - (arena->offset - start) + aligned;
+            arena->offset = start + aligned;
+            return ptr;
+        }
+    }
+
+    void* block = Arena_alloc(arena, newSize);
+    if (block && ptr) memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+    return block;
+}
+
+/* ----------------------------------------Public API Functions---------------------------------------- */
+
+Arena* Arena_init(size_t chunkSize)
+{
+    Arena* arena = malloc(sizeof(Arena));
+    if (!arena) return NULL;
+
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->offset = 0;
+    arena->chunkSize = chunkSize ? _Arena_align(chunkSize) : ARENA_DEFAULT_CHUNK;
+    if (arena->chunkSize == 0) arena->chunkSize = ARENA_DEFAULT_CHUNK;
+    arena->used = 0;
+    arena->last = NULL;
+    return arena;
+}
+
+void Arena_destroy(Arena* arena)
+{
+    if (!arena) return;
+
+    ArenaChunk* chunk = arena->head;
+    while (chunk) {
+        ArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+void* Arena_alloc(Arena* arena, size_t size)
+{
+    if (!arena) return NULL;
+
+    size_t aligned = _Arena_align(size ? size : 1);
+    if (aligned == 0) return NULL;
+
+    if (!arena->current || aligned > arena->current->capacity - arena->offset) {
+        if (!_Arena_advance(arena, aligned)) return NULL;
+    }
+
+    void* block = (unsigned char*)arena->current->data + arena->offset;
+    arena->offset += aligned;
+    arena->used += aligned;
+    arena->last = block;
+    return block;
+}
+
+void Arena_reset(Arena* arena)
+{
+    if (!arena) return;
+
+    arena->current = arena->head;
+    arena->offset = 0;
+    arena->used = 0;
+    arena->last = NULL;
+}
+
+size_t Arena_bytesUsed(const Arena* arena)
+{
+    return arena ? arena->used : 0;
+}
+
+DsaAllocator Arena_allocator(Arena* arena)
+{
+    DsaAllocator allocator = { _Arena_allocCallback, _Arena_reallocCallback, NULL, arena };
+    return allocator;
+}
@@ -1,82 +1,221 @@
-#include "../include/arraylist.h"
+#include "arraylist_internal.h"
+#include <sys/mman.h>
 
-/**
- * @brief The internal structure of the ArrayList.
- * @details This struct holds all the necessary state for the list, including
- * its size, capacity, the size of the data type it holds, and a void pointer
- * to the actual block of memory where elements are stored.
- */
-struct ArrayList
-{
-    size_t capacity; // The total number of elements the list can currently hold.
-    size_t dataSize; // The size of a single element in bytes (e.g., sizeof(int)).
-    size_t size;     // The current number of elements in the list.
-    void* data;      // A void pointer to the contiguous block of memory for the elements.
-};
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /** @internal Constants */
 
 /**
- * @brief The default initial capacity for a list created with a capacity of 0.
+ * @brief The default minimum capacity: the first allocation of a list created
+ * with a capacity of 0, and the floor below which it is never shrunk.
  * This prevents frequent reallocations when starting with an empty list.
  */
 #define DEFAULT_CAPACITY 8
 
 /**
- * @brief The factor by which the list's capacity will grow when it's full.
+ * @brief The default factor by which the list's capacity will grow when it's full.
  * A factor of 2 is a common choice that provides good amortized performance.
  */
 #define DEFAULT_EXPANSION_FACTOR 2
 
+/**
+ * @brief Ranges of at most this many elements are finished with insertion sort.
+ */
+#define SORT_INSERTION_THRESHOLD 16
+
+/**
+ * @brief Lists shorter than this are sorted serially by `ArrayList_parallelSort`.
+ */
+#define PARALLEL_SORT_THRESHOLD 8192
+
+/**
+ * @brief Smallest slice of output merged by one thread in a parallel merge round.
+ */
+#define PARALLEL_MERGE_MIN_GRAIN 4096
+
 /* --------------------------- Private Helper Functions --------------------------- */
 
+/**
+ * @internal
+ * @brief Reports whether `capacity` elements fit in the list's inline storage.
+ */
+static inline bool _ArrayList_fitsInline(const ArrayList* arrayList, size_t capacity)
+{
+    return capacity <= ARRAYLIST_INLINE_BYTES / arrayList->dataSize;
+}
+
+/**
+ * @internal
+ * @brief Releases the data buffer, unmapping it if it belongs to a file mapping,
+ * and points the list back at its inline storage.
+ */
+static void _ArrayList_releaseData(ArrayList* arrayList)
+{
+    if (arrayList->mapping) {
+        munmap(arrayList->mapping, arrayList->mappingLength);
+        arrayList->mapping = NULL;
+    } else if (arrayList->data != arrayList->inlineData) {
+        _Dsa_free(&arrayList->allocator, arrayList->data, arrayList->capacity * arrayList->dataSize);
+    }
+    arrayList->data = arrayList->inlineData;
+}
+
 /**
  * @internal
  * @brief Internal helper to reallocate the data buffer of the ArrayList.
+ * @details Capacities that fit in the inline storage use it; moving between it
+ * and the allocator copies the elements. A mapped buffer is always copied out.
  * @param arrayList A pointer to the ArrayList.
  * @param newCapacity The desired new capacity.
  * @return `true` on successful reallocation, `false` otherwise.
  */
 static bool _ArrayList_realloc(ArrayList* arrayList, size_t newCapacity)
 {
-    void* newData = realloc(arrayList->data, newCapacity * arrayList->dataSize);
-    if (!newData)
-        return false; // Reallocation failed; the original block is still valid.
+    bool wasInline = arrayList->data == arrayList->inlineData;
+    bool toInline = _ArrayList_fitsInline(arrayList, newCapacity);
+    size_t bytes = arrayList->size * arrayList->dataSize;
+    if (wasInline && toInline) {
+        arrayList->capacity = newCapacity;
+        return true;
+    }
+
+    void* newData;
+    if (arrayList->mapping || wasInline || toInline) {
+        // The old buffer cannot simply be resized: copy the elements across and release it.
+        newData = toInline ? arrayList->inlineData
+                           : _Dsa_alloc(&arrayList->allocator, newCapacity * arrayList->dataSize);
+        if (!newData)
+            return false;
+        memcpy(newData, arrayList->data, bytes);
+        if (!wasInline)
+            _ArrayList_releaseData(arrayList);
+    } else {
+        newData = _Dsa_realloc(&arrayList->allocator, arrayList->data,
+            arrayList->capacity * arrayList->dataSize, newCapacity * arrayList->dataSize);
+        if (!newData)
+            return false; // Reallocation failed; the original block is still valid.
+    }
 
     // On success, update the data pointer and the capacity.
+    DSA_STAT_ADD(arrayList, reallocs, 1);
+    DSA_STAT_ADD(arrayList, bytesMoved, bytes);
     arrayList->data = newData;
     arrayList->capacity = newCapacity;
     return true;
 }
 
+/**
+ * @internal
+ * @brief Computes the capacity the list grows to when it must hold `minCapacity` elements.
+ * @details Starts from the current capacity (or the policy's minimum for an
+ * unallocated list) and multiplies by the growth factor until `minCapacity`
+ * fits, so repeated growth stays amortized O(1) per element. Falls back to
+ * exactly `minCapacity` when the geometric step would overflow.
+ */
+static size_t _ArrayList_grownCapacity(const ArrayList* arrayList, size_t minCapacity)
+{
+    size_t maxCapacity = SIZE_MAX / arrayList->dataSize;
+    size_t newCapacity = arrayList->capacity;
+    if (newCapacity == 0)
+        newCapacity = arrayList->policy.minCapacity > 0 ? arrayList->policy.minCapacity : 1;
+
+    while (newCapacity < minCapacity) {
+        double next = (double)newCapacity * arrayList->policy.growthFactor;
+        if (next >= (double)maxCapacity)
+            return minCapacity;
+        // Small capacities times a small factor could truncate back to the same value.
+        newCapacity = (size_t)next > newCapacity ? (size_t)next : newCapacity + 1;
+    }
+    return newCapacity <= maxCapacity ? newCapacity : minCapacity;
+}
+
+/**
+ * @internal
+ * @brief Ensures the list can hold at least `minCapacity` elements without reallocating.
+ * @details Grows geometrically according to the list's policy, but never below
+ * `minCapacity`. Declared in arraylist_internal.h for containers that bulk-fill the buffer.
+ * @return `STATUS_OK`, `STATUS_ERR_OVERFLOW` or `STATUS_ERR_ALLOC`.
+ */
+STATUS _ArrayList_reserve(ArrayList* arrayList, size_t minCapacity)
+{
+    if (minCapacity <= arrayList->capacity)
+        return STATUS_OK;
+
+    if (minCapacity > SIZE_MAX / arrayList->dataSize)
+        return STATUS_ERR_OVERFLOW;
+
+    size_t newCapacity = _ArrayList_grownCapacity(arrayList, minCapacity);
+    return _ArrayList_realloc(arrayList, newCapacity) ? STATUS_OK : STATUS_ERR_ALLOC;
+}
+
+/**
+ * @internal
+ * @brief Halves the capacity once the list is a quarter full, if the policy allows it.
+ * @details The gap between the grow and shrink thresholds keeps a list that
+ * hovers around one size from reallocating on every operation.
+ */
+static void _ArrayList_maybeShrink(ArrayList* arrayList)
+{
+    size_t floor = arrayList->policy.minCapacity > 0 ? arrayList->policy.minCapacity : 1;
+
+    if (!arrayList->policy.shrinkOnDelete || arrayList->capacity <= floor ||
+        arrayList->size > arrayList->capacity / 4)
+        return;
+
+    size_t newCapacity = arrayList->capacity / 2;
+
+    // Ensure we don't shrink below the policy's minimum.
+    if (newCapacity < floor) newCapacity = floor;
+
+    // Note: We don't strictly need to handle allocation failure here,
+    // as shrinking is an optimization. The list remains valid even if it fails.
+    _ArrayList_realloc(arrayList, newCapacity);
+}
+
 /* ----------------------------- Public API Functions ----------------------------- */
 
 ArrayList* ArrayList_init(size_t capacity, size_t dataSize)
 {
-    if (dataSize == 0)
+    return ArrayList_initWithAllocator(capacity, dataSize, NULL);
+}
+
+ArrayList* ArrayList_initWithAllocator(size_t capacity, size_t dataSize, const DsaAllocator* allocator)
+{
+    allocator = _Dsa_resolve(allocator);
+    if (!allocator || dataSize == 0 || capacity > SIZE_MAX / dataSize)
         return NULL;
 
-    ArrayList* arrayList = (ArrayList* )malloc(sizeof(ArrayList));
+    ArrayList* arrayList = _Dsa_alloc(allocator, sizeof(ArrayList));
     if (!arrayList)
         return NULL; // Allocation failed.
 
     arrayList->capacity = capacity;
     arrayList->dataSize = dataSize;
     arrayList->size = 0;
-    arrayList->data = NULL; // Initialize data pointer to NULL.
+    arrayList->data = arrayList->inlineData; // Small capacities need no separate buffer.
+    arrayList->policy.growthFactor = DEFAULT_EXPANSION_FACTOR;
+    arrayList->policy.shrinkOnDelete = true;
+    arrayList->policy.minCapacity = DEFAULT_CAPACITY;
+    arrayList->allocator = *allocator;
+    arrayList->mapping = NULL;
+    arrayList->mappingLength = 0;
+    DSA_STATS_INIT(arrayList);
 
-    // If the user requests an initial capacity, allocate the data block now.
-    if (capacity > 0) {
-        arrayList->data = malloc(arrayList->dataSize * capacity);
+    // If the user requests more capacity than fits inline, allocate the data block now.
+    if (!_ArrayList_fitsInline(arrayList, capacity)) {
+        arrayList->data = _Dsa_alloc(allocator, arrayList->dataSize * capacity);
         if (!arrayList->data)
         {
             // If data allocation fails, we must clean up the struct we just allocated.
-            free(arrayList);
-            arrayList = NULL;
+            _Dsa_free(allocator, arrayList, sizeof(ArrayList));
             return NULL;
         }
     }
-    // If capacity is 0, data remains NULL. Allocation is deferred until the first insert.
+    // Otherwise allocation is deferred until the list outgrows its inline storage.
 
     return arrayList;
 }
@@ -85,33 +224,27 @@ void ArrayList_destroy(ArrayList* arrayList)
 {
     if (!arrayList)
         return;
-    
-    free(arrayList->data);
-    arrayList->data = NULL;
 
-    free(arrayList);
+    DsaAllocator allocator = arrayList->allocator;
+    _ArrayList_releaseData(arrayList);
+    _Dsa_free(&allocator, arrayList, sizeof(ArrayList));
 }
 
 STATUS ArrayList_insert(ArrayList* arrayList, void* element)
 {
+    DSA_TRACE("ArrayList", "insert", arrayList);
     if (!arrayList || !element)
         return STATUS_ERR_INVALID_ARGUMENT;
 
     // Check if the list is full and needs to be expanded.
     if (arrayList->size >= arrayList->capacity)
     {
-        // Check for potential integer overflow before multiplication.
-        if (arrayList->capacity > SIZE_MAX / DEFAULT_EXPANSION_FACTOR)
+        if (arrayList->size == SIZE_MAX)
             return STATUS_ERR_OVERFLOW; // Cannot grow further.
 
-        // Determine the new capacity. If current capacity is 0, use the default.
-        size_t newCapacity = arrayList->capacity == 0
-            ? DEFAULT_CAPACITY
-            : arrayList->capacity * DEFAULT_EXPANSION_FACTOR;
-
-        // Attempt to reallocate with the new capacity.
-        if (!_ArrayList_realloc(arrayList, newCapacity))
-            return STATUS_ERR_ALLOC;
+        STATUS status = _ArrayList_reserve(arrayList, arrayList->size + 1);
+        if (status != STATUS_OK)
+            return status;
     }
 
     // Calculate the memory address for the new element at the end of the array.
@@ -127,6 +260,7 @@ STATUS ArrayList_insert(ArrayList* arrayList, void* element)
 
 STATUS ArrayList_delete(ArrayList* arrayList, size_t index)
 {
+    DSA_TRACE("ArrayList", "delete", arrayList);
     if (!arrayList)
         return STATUS_ERR_INVALID_ARGUMENT;
 
@@ -142,31 +276,19 @@ STATUS ArrayList_delete(ArrayList* arrayList, size_t index)
         (char* )arrayList->data + index * arrayList->dataSize, // Destination
         (char* )arrayList->data + (index + 1) * arrayList->dataSize, // Source
         (arrayList->size - index - 1) * arrayList->dataSize); // Total bytes to move
+    DSA_STAT_ADD(arrayList, bytesMoved, (arrayList->size - index - 1) * arrayList->dataSize);
 
     arrayList->size--;
 
     // Check if the array should be shrunk to conserve memory.
-    // We shrink if size is 1/4 of capacity, but not below the default capacity.
-    if (arrayList->capacity > DEFAULT_CAPACITY && arrayList->size <= arrayList->capacity / 4)
-    {
-        size_t newCapacity = arrayList->capacity / 2;
-        
-        // Ensure we don't shrink below our defined minimum.
-        if (newCapacity < DEFAULT_CAPACITY) newCapacity = DEFAULT_CAPACITY;
-
-        // Only reallocate if the calculated new capacity is different.
-        if (newCapacity != arrayList->capacity) {
-             _ArrayList_realloc(arrayList, newCapacity);
-             // Note: We don't strictly need to handle allocation failure here,
-             // as shrinking is an optimization. The list remains valid even if it fails.
-        }
-    }
+    _ArrayList_maybeShrink(arrayList);
 
     return STATUS_OK;
 }
 
 STATUS ArrayList_get(ArrayList* arrayList, size_t index, void* dataOut)
 {
+    DSA_TRACE("ArrayList", "get", arrayList);
     if (!arrayList || !dataOut || index >= arrayList->size)
         return STATUS_ERR_INVALID_ARGUMENT;
 
@@ -180,6 +302,7 @@ STATUS ArrayList_get(ArrayList* arrayList, size_t index, void* dataOut)
 
 STATUS ArrayList_set(ArrayList* arrayList, size_t index, void* element)
 {
+    DSA_TRACE("ArrayList", "set", arrayList);
     if (!arrayList || !element || index >= arrayList->size)
         return STATUS_ERR_INVALID_ARGUMENT;
 
@@ -193,6 +316,7 @@ STATUS ArrayList_set(ArrayList* arrayList, size_t index, void* element)
 
 STATUS ArrayList_search(ArrayList* arr, void* key, size_t* index, int (*cmp)(const void* , const void* )) 
 {
+    DSA_TRACE("ArrayList", "search", arr);
     if (!arr || !key || !cmp || !index)
         return STATUS_ERR_INVALID_ARGUMENT;
 
@@ -201,12 +325,14 @@ STATUS ArrayList_search(ArrayList* arr, void* key, size_t* index, int (*cmp)(con
         void* element = (char*)arr->data + i * arr->dataSize;
         // Use the user-provided comparison function to check for a match.
         if (cmp(element, key) == 0) {
+            DSA_STAT_ADD(arr, comparisons, i + 1);
             *index = i; // Store the found index in the output parameter.
             return STATUS_OK;
         }
     }
 
     // If the loop completes without a match, the key was not found.
+    DSA_STAT_ADD(arr, comparisons, arr->size);
     return STATUS_ERR_KEY_NOT_FOUND;
 }
 
@@ -226,6 +352,19 @@ STATUS ArrayList_forEach(ArrayList* arrayList, void (*callBack)(void* ))
     return STATUS_OK;
 }
 
+STATUS ArrayList_forEachCtx(ArrayList* arrayList, bool (*callBack)(void*, void*), void* ctx)
+{
+    if (!arrayList || !callBack)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    for (size_t i = 0; i < arrayList->size; i++)
+    {
+        if (!callBack(_ArrayList_at(arrayList, i), ctx))
+            break;
+    }
+    return STATUS_OK;
+}
+
 size_t ArrayList_size(const ArrayList* arrayList)
 {
     if (!arrayList) {
@@ -240,4 +379,781 @@ size_t ArrayList_capacity(const ArrayList* arrayList)
         return 0;
     }
     return arrayList->capacity;
-}
\ No newline at end of file
+}
+
+/* ------------------------------ Capacity Management ------------------------------ */
+
+STATUS ArrayList_reserve(ArrayList* arrayList, size_t capacity)
+{
+    if (!arrayList)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (capacity <= arrayList->capacity)
+        return STATUS_OK;
+
+    if (capacity > SIZE_MAX / arrayList->dataSize)
+        return STATUS_ERR_OVERFLOW;
+
+    // The caller knows the final size, so allocate exactly that much.
+    return _ArrayList_realloc(arrayList, capacity) ? STATUS_OK : STATUS_ERR_ALLOC;
+}
+
+STATUS ArrayList_shrinkToFit(ArrayList* arrayList)
+{
+    if (!arrayList)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (arrayList->size == arrayList->capacity)
+        return STATUS_OK;
+
+    if (arrayList->size == 0) {
+        // Release the buffer entirely; the next insert allocates again.
+        _ArrayList_releaseData(arrayList);
+        arrayList->capacity = 0;
+        return STATUS_OK;
+    }
+
+    return _ArrayList_realloc(arrayList, arrayList->size) ? STATUS_OK : STATUS_ERR_ALLOC;
+}
+
+STATUS ArrayList_clear(ArrayList* arrayList)
+{
+    if (!arrayList)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    arrayList->size = 0;
+    return STATUS_OK;
+}
+
+STATUS ArrayList_setPolicy(ArrayList* arrayList, const ArrayListPolicy* policy)
+{
+    if (!arrayList || !policy)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    // Written so that NaN is rejected as well.
+    if (!(policy->growthFactor > 1.0))
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    arrayList->policy = *policy;
+    return STATUS_OK;
+}
+
+STATUS ArrayList_getPolicy(const ArrayList* arrayList, ArrayListPolicy* policyOut)
+{
+    if (!arrayList || !policyOut)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    *policyOut = arrayList->policy;
+    return STATUS_OK;
+}
+
+/* --------------------------------- Bulk Operations --------------------------------- */
+
+STATUS ArrayList_insertMany(ArrayList* arrayList, const void* elements, size_t count)
+{
+    if (!arrayList || (!elements && count > 0))
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (count == 0)
+        return STATUS_OK;
+
+    if (count > SIZE_MAX - arrayList->size)
+        return STATUS_ERR_OVERFLOW;
+
+    STATUS status = _ArrayList_reserve(arrayList, arrayList->size + count);
+    if (status != STATUS_OK)
+        return status;
+
+    memcpy(_ArrayList_at(arrayList, arrayList->size), elements, count * arrayList->dataSize);
+    arrayList->size += count;
+    return STATUS_OK;
+}
+
+STATUS ArrayList_insertAt(ArrayList* arrayList, size_t index, const void* element)
+{
+    if (!arrayList || !element || index > arrayList->size)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (arrayList->size == SIZE_MAX)
+        return STATUS_ERR_OVERFLOW;
+
+    STATUS status = _ArrayList_reserve(arrayList, arrayList->size + 1);
+    if (status != STATUS_OK)
+        return status;
+
+    // Open a gap by shifting the tail one position to the right.
+    char* target = _ArrayList_at(arrayList, index);
+    memmove(target + arrayList->dataSize, target, (arrayList->size - index) * arrayList->dataSize);
+    DSA_STAT_ADD(arrayList, bytesMoved, (arrayList->size - index) * arrayList->dataSize);
+    memcpy(target, element, arrayList->dataSize);
+    arrayList->size++;
+    return STATUS_OK;
+}
+
+STATUS ArrayList_removeRange(ArrayList* arrayList, size_t begin, size_t end)
+{
+    if (!arrayList || begin > end || end > arrayList->size)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (begin == end)
+        return STATUS_OK;
+
+    // Close the gap with a single move of the tail.
+    memmove(_ArrayList_at(arrayList, begin), _ArrayList_at(arrayList, end),
+        (arrayList->size - end) * arrayList->dataSize);
+    DSA_STAT_ADD(arrayList, bytesMoved, (arrayList->size - end) * arrayList->dataSize);
+    arrayList->size -= end - begin;
+
+    _ArrayList_maybeShrink(arrayList);
+    return STATUS_OK;
+}
+
+STATUS ArrayList_removeIf(ArrayList* arrayList, bool (*pred)(const void*), size_t* removedOut)
+{
+    if (!arrayList || !pred)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t dataSize = arrayList->dataSize;
+    size_t write = 0;    // Number of elements kept so far; also the next write slot.
+    size_t runStart = 0; // First element of the current run of kept elements.
+
+    // Each run of kept elements is moved down with one memmove once its end is found.
+    for (size_t i = 0; i <= arrayList->size; i++) {
+        if (i < arrayList->size && !pred(_ArrayList_at(arrayList, i)))
+            continue;
+
+        size_t runLength = i - runStart;
+        if (runLength > 0 && write != runStart) {
+            memmove(_ArrayList_at(arrayList, write), _ArrayList_at(arrayList, runStart), runLength * dataSize);
+            DSA_STAT_ADD(arrayList, bytesMoved, runLength * dataSize);
+        }
+        write += runLength;
+        runStart = i + 1;
+    }
+
+    if (removedOut) *removedOut = arrayList->size - write;
+    if (write != arrayList->size) {
+        arrayList->size = write;
+        _ArrayList_maybeShrink(arrayList);
+    }
+    return STATUS_OK;
+}
+
+/* ------------------------------- Sorting & Searching ------------------------------- */
+
+/**
+ * @internal
+ * @brief Swaps two elements of `size` bytes.
+ * @details 4- and 8-byte elements are exchanged as single words; larger ones
+ * are exchanged through a small stack buffer, a chunk at a time.
+ */
+static void _ArrayList_swap(char* a, char* b, size_t size)
+{
+    if (size == sizeof(uint32_t)) {
+        uint32_t t;
+        memcpy(&t, a, sizeof t);
+        memcpy(a, b, sizeof t);
+        memcpy(b, &t, sizeof t);
+    } else if (size == sizeof(uint64_t)) {
+        uint64_t t;
+        memcpy(&t, a, sizeof t);
+        memcpy(a, b, sizeof t);
+        memcpy(b, &t, sizeof t);
+    } else {
+        unsigned char buffer[64];
+        while (size > 0) {
+            size_t chunk = size < sizeof buffer ? size : sizeof buffer;
+            memcpy(buffer, a, chunk);
+            memcpy(a, b, chunk);
+            memcpy(b, buffer, chunk);
+            a += chunk;
+            b += chunk;
+            size -= chunk;
+        }
+    }
+}
+
+/**
+ * @internal
+ * @brief Sorts a short range by insertion.
+ */
+static void _ArrayList_insertionSort(char* base, size_t count, size_t size, int (*cmp)(const void*, const void*))
+{
+    for (size_t i = 1; i < count; i++) {
+        for (size_t j = i; j > 0 && cmp(base + (j - 1) * size, base + j * size) > 0; j--)
+            _ArrayList_swap(base + (j - 1) * size, base + j * size, size);
+    }
+}
+
+/**
+ * @internal
+ * @brief Restores the max-heap property below `root` in `base[0 .. count)`.
+ */
+static void _ArrayList_siftDown(char* base, size_t root, size_t count, size_t size, int (*cmp)(const void*, const void*))
+{
+    for (;;) {
+        size_t largest = root;
+        size_t left = 2 * root + 1;
+        size_t right = left + 1;
+        if (left < count && cmp(base + left * size, base + largest * size) > 0) largest = left;
+        if (right < count && cmp(base + right * size, base + largest * size) > 0) largest = right;
+        if (largest == root) return;
+        _ArrayList_swap(base + root * size, base + largest * size, size);
+        root = largest;
+    }
+}
+
+/**
+ * @internal
+ * @brief Sorts a range by heapsort, the guaranteed O(n log n) fallback of introsort.
+ */
+static void _ArrayList_heapSort(char* base, size_t count, size_t size, int (*cmp)(const void*, const void*))
+{
+    for (size_t i = count / 2; i > 0; i--)
+        _ArrayList_siftDown(base, i - 1, count, size, cmp);
+    for (size_t end = count - 1; end > 0; end--) {
+        _ArrayList_swap(base, base + end * size, size);
+        _ArrayList_siftDown(base, 0, end, size, cmp);
+    }
+}
+
+/**
+ * @internal
+ * @brief Introsort of `base[0 .. count)`.
+ * @details Each round moves the median of the first, middle and last elements
+ * to the front as the pivot and partitions Hoare-style, so runs of equal
+ * elements split evenly. The smaller side is sorted recursively and the larger
+ * one iteratively, bounding the stack at O(log n); once `depthLimit` rounds
+ * have been spent the range is heapsorted instead.
+ */
+static void _ArrayList_introSort(char* base, size_t count, size_t size, size_t depthLimit, int (*cmp)(const void*, const void*))
+{
+    while (count > SORT_INSERTION_THRESHOLD) {
+        if (depthLimit == 0) {
+            _ArrayList_heapSort(base, count, size, cmp);
+            return;
+        }
+        depthLimit--;
+
+        char* middle = base + (count / 2) * size;
+        char* last = base + (count - 1) * size;
+        if (cmp(middle, base) < 0) _ArrayList_swap(middle, base, size);
+        if (cmp(last, middle) < 0) {
+            _ArrayList_swap(last, middle, size);
+            if (cmp(middle, base) < 0) _ArrayList_swap(middle, base, size);
+        }
+        _ArrayList_swap(base, middle, size);
+
+        // The pivot stays at base[0] while both scans stop on elements equal to it.
+        size_t i = 0, j = count;
+        for (;;) {
+            do i++; while (i < count && cmp(base + i * size, base) < 0);
+            do j--; while (cmp(base + j * size, base) > 0);
+            if (i >= j) break;
+            _ArrayList_swap(base + i * size, base + j * size, size);
+        }
+        _ArrayList_swap(base, base + j * size, size);
+
+        size_t leftCount = j;
+        size_t rightCount = count - j - 1;
+        char* right = base + (j + 1) * size;
+        if (leftCount < rightCount) {
+            _ArrayList_introSort(base, leftCount, size, depthLimit, cmp);
+            base = right;
+            count = rightCount;
+        } else {
+            _ArrayList_introSort(right, rightCount, size, depthLimit, cmp);
+            count = leftCount;
+        }
+    }
+    _ArrayList_insertionSort(base, count, size, cmp);
+}
+
+/**
+ * @internal
+ * @brief Returns the number of quicksort rounds introsort allows on `count` elements: 2 log2(count).
+ */
+static size_t _ArrayList_depthLimit(size_t count)
+{
+    size_t depthLimit = 0;
+    for (size_t n = count; n > 1; n >>= 1)
+        depthLimit += 2;
+    return depthLimit;
+}
+
+/**
+ * @internal
+ * @brief Returns the index of the first element for which `cmp(element, key)`
+ * is not below `bias`: 0 gives the lower bound, 1 the upper bound.
+ */
+static size_t _ArrayList_bound(const ArrayList* arrayList, const void* key, int (*cmp)(const void*, const void*), int bias)
+{
+    size_t lo = 0, hi = arrayList->size;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        DSA_STAT_ADD(arrayList, comparisons, 1);
+        if (cmp(_ArrayList_at(arrayList, mid), key) < bias) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+STATUS ArrayList_sort(ArrayList* arrayList, int (*cmp)(const void*, const void*))
+{
+    DSA_TRACE("ArrayList", "sort", arrayList);
+    if (!arrayList || !cmp)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    if (arrayList->size > 1)
+        _ArrayList_introSort(arrayList->data, arrayList->size, arrayList->dataSize,
+            _ArrayList_depthLimit(arrayList->size), cmp);
+    return STATUS_OK;
+}
+
+size_t ArrayList_lowerBound(const ArrayList* arrayList, const void* key, int (*cmp)(const void*, const void*))
+{
+    if (!arrayList || !key || !cmp)
+        return 0;
+    return _ArrayList_bound(arrayList, key, cmp, 0);
+}
+
+STATUS ArrayList_binarySearch(const ArrayList* arrayList, const void* key, size_t* index, int (*cmp)(const void*, const void*))
+{
+    if (!arrayList || !key || !index || !cmp)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t position = _ArrayList_bound(arrayList, key, cmp, 0);
+    if (position == arrayList->size)
+        return STATUS_ERR_KEY_NOT_FOUND;
+    DSA_STAT_ADD(arrayList, comparisons, 1);
+    if (cmp(_ArrayList_at(arrayList, position), key) != 0)
+        return STATUS_ERR_KEY_NOT_FOUND;
+
+    *index = position;
+    return STATUS_OK;
+}
+
+STATUS ArrayList_insertSorted(ArrayList* arrayList, const void* element, int (*cmp)(const void*, const void*))
+{
+    if (!arrayList || !element || !cmp)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    return ArrayList_insertAt(arrayList, _ArrayList_bound(arrayList, element, cmp, 1), element);
+}
+
+STATUS ArrayList_findInt32(const ArrayList* arrayList, int32_t key, size_t* index)
+{
+    if (!arrayList || !index || arrayList->dataSize != sizeof(int32_t))
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    const int32_t* data = arrayList->data;
+    size_t size = arrayList->size;
+    size_t i = 0;
+
+    // Compare a vector of elements at once; a non-zero mask locates the first match.
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi32(key);
+    for (; i + 8 <= size; i += 8) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if (mask) {
+            *index = i + (size_t)__builtin_ctz(mask);
+            return STATUS_OK;
+        }
+    }
+#elif defined(__SSE2__)
+    __m128i needle = _mm_set1_epi32(key);
+    for (; i + 4 <= size; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+        unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if (mask) {
+            *index = i + (size_t)__builtin_ctz(mask);
+            return STATUS_OK;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int32x4_t needle = vdupq_n_s32(key);
+    for (; i + 4 <= size; i += 4) {
+        // Narrow the 32-bit lane masks to a 64-bit word with 16 bits per lane.
+        uint32x4_t eq = vceqq_s32(vld1q_s32(data + i), needle);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(eq)), 0);
+        if (mask) {
+            *index = i + (size_t)(__builtin_ctzll(mask) / 16);
+            return STATUS_OK;
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        if (data[i] == key) {
+            *index = i;
+            return STATUS_OK;
+        }
+    }
+    return STATUS_ERR_KEY_NOT_FOUND;
+}
+
+STATUS ArrayList_findInt64(const ArrayList* arrayList, int64_t key, size_t* index)
+{
+    if (!arrayList || !index || arrayList->dataSize != sizeof(int64_t))
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    const int64_t* data = arrayList->data;
+    size_t size = arrayList->size;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi64x(key);
+    for (; i + 4 <= size; i += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned mask = (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, needle)));
+        if (mask) {
+            *index = i + (size_t)__builtin_ctz(mask);
+            return STATUS_OK;
+        }
+    }
+#elif defined(__SSE2__)
+    // SSE2 has no 64-bit compare: both 32-bit halves of a lane must match.
+    __m128i needle = _mm_set1_epi64x(key);
+    for (; i + 2 <= size; i += 2) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), needle);
+        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        unsigned mask = (unsigned)_mm_movemask_pd(_mm_castsi128_pd(eq));
+        if (mask) {
+            *index = i + (size_t)__builtin_ctz(mask);
+            return STATUS_OK;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int64x2_t needle = vdupq_n_s64(key);
+    for (; i + 2 <= size; i += 2) {
+        uint64x2_t eq = vceqq_s64(vld1q_s64(data + i), needle);
+        if (vgetq_lane_u64(eq, 0)) {
+            *index = i;
+            return STATUS_OK;
+        }
+        if (vgetq_lane_u64(eq, 1)) {
+            *index = i + 1;
+            return STATUS_OK;
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        if (data[i] == key) {
+            *index = i;
+            return STATUS_OK;
+        }
+    }
+    return STATUS_ERR_KEY_NOT_FOUND;
+}
+
+/* --------------------------------- Parallel Algorithms --------------------------------- */
+
+/**
+ * @internal
+ * @brief Arguments shared by the parallel loop bodies below.
+ */
+typedef struct
+{
+    char* data;                                 // The list's elements (the source of a merge round).
+    char* scratch;                              // The destination of a merge round.
+    size_t size;                                // The number of elements.
+    size_t dataSize;                            // The size in bytes of each element.
+    size_t width;                               // Run length of a sort or merge round; block length of a reduce.
+    int (*cmp)(const void*, const void*);
+    void (*callBack)(void*, void*);
+    void (*accumulate)(void*, const void*, void*);
+    void* partials;                             // One partial result per reduce block.
+    const void* identity;                       // The caller's initial reduce value.
+    size_t resultSize;
+    void* ctx;
+} ArrayListParallelJob;
+
+static ThreadPool* _ArrayList_pool(ThreadPool* pool)
+{
+    return pool ? pool : ThreadPool_default();
+}
+
+static void _ArrayList_forEachBody(size_t begin, size_t end, void* arg)
+{
+    ArrayListParallelJob* job = arg;
+    for (size_t i = begin; i < end; i++)
+        job->callBack(job->data + i * job->dataSize, job->ctx);
+}
+
+static void _ArrayList_reduceBody(size_t begin, size_t end, void* arg)
+{
+    ArrayListParallelJob* job = arg;
+    for (size_t block = begin; block < end; block++) {
+        void* partial = (char*)job->partials + block * job->resultSize;
+        memcpy(partial, job->identity, job->resultSize);
+
+        size_t first = block * job->width;
+        size_t last = job->size - first > job->width ? first + job->width : job->size;
+        for (size_t i = first; i < last; i++)
+            job->accumulate(partial, job->data + i * job->dataSize, job->ctx);
+    }
+}
+
+static void _ArrayList_sortRunsBody(size_t begin, size_t end, void* arg)
+{
+    ArrayListParallelJob* job = arg;
+    for (size_t run = begin; run < end; run++) {
+        size_t first = run * job->width;
+        if (first >= job->size) break;
+        size_t count = job->size - first > job->width ? job->width : job->size - first;
+        _ArrayList_introSort(job->data + first * job->dataSize, count, job->dataSize,
+            _ArrayList_depthLimit(count), job->cmp);
+    }
+}
+
+/**
+ * @internal
+ * @brief Returns how many of the first `k` elements of the merge of sorted runs
+ * `a[0 .. m)` and `b[0 .. n)` come from `a`, taking from `a` first on ties.
+ */
+static size_t _ArrayList_coRank(const char* a, size_t m, const char* b, size_t n, size_t k,
+    size_t size, int (*cmp)(const void*, const void*))
+{
+    size_t lo = k > n ? k - n : 0;
+    size_t hi = k < m ? k : m;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        // a[i] belongs among the first k if it is not ordered after b[k - i - 1].
+        if (cmp(a + i * size, b + (k - i - 1) * size) <= 0) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+/**
+ * @internal
+ * @brief Merges the sorted runs `a[0 .. m)` and `b[0 .. n)` into `out`, taking from `a` first on ties.
+ */
+static void _ArrayList_merge(const char* a, size_t m, const char* b, size_t n, char* out,
+    size_t size, int (*cmp)(const void*, const void*))
+{
+    size_t i = 0, j = 0;
+    while (i < m && j < n) {
+        if (cmp(b + j * size, a + i * size) < 0) memcpy(out, b + (j++) * size, size);
+        else memcpy(out, a + (i++) * size, size);
+        out += size;
+    }
+    memcpy(out, a + i * size, (m - i) * size);
+    memcpy(out + (m - i) * size, b + j * size, (n - j) * size);
+}
+
+/**
+ * @internal
+ * @brief Writes output positions `[begin, end)` of one merge round, in which
+ * neighbouring runs of `width` elements are merged pairwise from `data` into `scratch`.
+ */
+static void _ArrayList_mergeBody(size_t begin, size_t end, void* arg)
+{
+    ArrayListParallelJob* job = arg;
+    size_t size = job->dataSize;
+
+    for (size_t pair = begin / (2 * job->width) * (2 * job->width); pair < end; pair += 2 * job->width) {
+        size_t middle = job->size - pair > job->width ? pair + job->width : job->size;
+        size_t pairEnd = job->size - middle > job->width ? middle + job->width : job->size;
+        const char* a = job->data + pair * size;
+        const char* b = job->data + middle * size;
+        size_t m = middle - pair, n = pairEnd - middle;
+
+        size_t from = (begin > pair ? begin : pair) - pair;
+        size_t to = (end < pairEnd ? end : pairEnd) - pair;
+        size_t i0 = _ArrayList_coRank(a, m, b, n, from, size, job->cmp);
+        size_t i1 = _ArrayList_coRank(a, m, b, n, to, size, job->cmp);
+        _ArrayList_merge(a + i0 * size, i1 - i0, b + (from - i0) * size, (to - i1) - (from - i0),
+            job->scratch + (pair + from) * size, size, job->cmp);
+    }
+}
+
+static void _ArrayList_copyBody(size_t begin, size_t end, void* arg)
+{
+    ArrayListParallelJob* job = arg;
+    memcpy(job->scratch + begin * job->dataSize, job->data + begin * job->dataSize, (end - begin) * job->dataSize);
+}
+
+STATUS ArrayList_parallelForEach(ArrayList* arrayList, ThreadPool* pool,
+    void (*callBack)(void* element, void* ctx), void* ctx, size_t grain)
+{
+    if (!arrayList || !callBack)
+        return STATUS_ERR_INVALID_ARGUMENT;
+    if (!(pool = _ArrayList_pool(pool)))
+        return STATUS_ERR_ALLOC;
+
+    ArrayListParallelJob job = { .data = arrayList->data, .dataSize = arrayList->dataSize,
+        .callBack = callBack, .ctx = ctx };
+    return ThreadPool_parallelFor(pool, arrayList->size, grain, _ArrayList_forEachBody, &job);
+}
+
+STATUS ArrayList_parallelReduce(const ArrayList* arrayList, ThreadPool* pool, void* result, size_t resultSize,
+    void (*accumulate)(void* partial, const void* element, void* ctx),
+    void (*combine)(void* result, const void* partial, void* ctx), void* ctx, size_t grain)
+{
+    if (!arrayList || !result || resultSize == 0 || !accumulate || !combine)
+        return STATUS_ERR_INVALID_ARGUMENT;
+    if (arrayList->size == 0)
+        return STATUS_OK;
+    if (!(pool = _ArrayList_pool(pool)))
+        return STATUS_ERR_ALLOC;
+
+    if (grain == 0) {
+        grain = arrayList->size / (ThreadPool_threadCount(pool) * 8);
+        if (grain == 0) grain = 1;
+    }
+    size_t blocks = arrayList->size / grain + (arrayList->size % grain != 0);
+    if (blocks > SIZE_MAX / resultSize)
+        return STATUS_ERR_OVERFLOW;
+
+    void* partials = _Dsa_alloc(&arrayList->allocator, blocks * resultSize);
+    if (!partials)
+        return STATUS_ERR_ALLOC;
+
+    ArrayListParallelJob job = { .data = arrayList->data, .size = arrayList->size,
+        .dataSize = arrayList->dataSize, .width = grain, .accumulate = accumulate,
+        .partials = partials, .identity = result, .resultSize = resultSize, .ctx = ctx };
+    ThreadPool_parallelFor(pool, blocks, 1, _ArrayList_reduceBody, &job);
+
+    for (size_t block = 0; block < blocks; block++)
+        combine(result, (char*)partials + block * resultSize, ctx);
+
+    _Dsa_free(&arrayList->allocator, partials, blocks * resultSize);
+    return STATUS_OK;
+}
+
+STATUS ArrayList_parallelSort(ArrayList* arrayList, ThreadPool* pool, int (*cmp)(const void*, const void*))
+{
+    if (!arrayList || !cmp)
+        return STATUS_ERR_INVALID_ARGUMENT;
+    if (arrayList->size < PARALLEL_SORT_THRESHOLD)
+        return ArrayList_sort(arrayList, cmp);
+    if (!(pool = _ArrayList_pool(pool)))
+        return STATUS_ERR_ALLOC;
+
+    size_t threads = ThreadPool_threadCount(pool);
+    size_t bytes = arrayList->size * arrayList->dataSize;
+    if (threads == 1)
+        return ArrayList_sort(arrayList, cmp);
+
+    char* scratch = _Dsa_alloc(&arrayList->allocator, bytes);
+    if (!scratch)
+        return STATUS_ERR_ALLOC;
+
+    ArrayListParallelJob job = { .data = arrayList->data, .scratch = scratch, .size = arrayList->size,
+        .dataSize = arrayList->dataSize, .cmp = cmp };
+    job.width = arrayList->size / threads + (arrayList->size % threads != 0);
+    ThreadPool_parallelFor(pool, threads, 1, _ArrayList_sortRunsBody, &job);
+
+    size_t grain = arrayList->size / (threads * 4);
+    if (grain < PARALLEL_MERGE_MIN_GRAIN) grain = PARALLEL_MERGE_MIN_GRAIN;
+    for (; job.width < job.size; job.width *= 2) {
+        ThreadPool_parallelFor(pool, job.size, grain, _ArrayList_mergeBody, &job);
+        char* swap = job.data;
+        job.data = job.scratch;
+        job.scratch = swap;
+    }
+
+    // After an odd number of rounds the sorted elements are in the scratch buffer.
+    if (job.data != arrayList->data) {
+        job.scratch = arrayList->data;
+        ThreadPool_parallelFor(pool, job.size, grain, _ArrayList_copyBody, &job);
+    }
+    _Dsa_free(&arrayList->allocator, scratch, bytes);
+    return STATUS_OK;
+}
+
+/* --------------------------------- Snapshots --------------------------------- */
+
+ArrayList* _ArrayList_readSnapshot(int fd, const SnapshotInfo* info)
+{
+    ArrayList* arrayList = ArrayList_init((size_t)info->count, (size_t)info->dataSize);
+    if (!arrayList)
+        return NULL;
+
+    if (_Snapshot_read(fd, arrayList->data, (size_t)(info->count * info->dataSize)) != STATUS_OK) {
+        ArrayList_destroy(arrayList);
+        return NULL;
+    }
+    arrayList->size = (size_t)info->count;
+    return arrayList;
+}
+
+ArrayList* _ArrayList_mapSnapshot(const char* path, size_t dataSize, uint32_t kind, SnapshotInfo* info)
+{
+    void* base;
+    size_t length;
+    if (_Snapshot_map(path, info, &base, &length) != STATUS_OK)
+        return NULL;
+
+    ArrayList* arrayList = NULL;
+    if (info->dataSize == dataSize && (kind == 0 || info->kind == kind))
+        arrayList = ArrayList_init(0, dataSize);
+    if (!arrayList) {
+        if (base) munmap(base, length);
+        return NULL;
+    }
+
+    if (base) {
+        arrayList->mapping = base;
+        arrayList->mappingLength = length;
+        arrayList->data = (char*)base + SNAPSHOT_HEADER_SIZE;
+        arrayList->size = arrayList->capacity = (size_t)info->count;
+    }
+    return arrayList;
+}
+
+STATUS ArrayList_save(const ArrayList* arrayList, int fd)
+{
+    if (!arrayList || fd < 0)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    SnapshotInfo info = { SNAPSHOT_ARRAYLIST, 0, arrayList->dataSize, arrayList->size };
+    STATUS status = _Snapshot_writeHeader(fd, &info);
+    if (status != STATUS_OK)
+        return status;
+    return _Snapshot_write(fd, arrayList->data, arrayList->size * arrayList->dataSize);
+}
+
+ArrayList* ArrayList_load(int fd)
+{
+    SnapshotInfo info;
+    if (fd < 0 || _Snapshot_readHeader(fd, &info) != STATUS_OK)
+        return NULL;
+    return _ArrayList_readSnapshot(fd, &info);
+}
+
+ArrayList* ArrayList_mapFile(const char* path, size_t dataSize)
+{
+    SnapshotInfo info;
+    if (!path || dataSize == 0)
+        return NULL;
+    return _ArrayList_mapSnapshot(path, dataSize, 0, &info);
+}
+
+/* --------------------------------- Instrumentation --------------------------------- */
+
+STATUS ArrayList_getStats(const ArrayList* arrayList, DsaStats* statsOut)
+{
+    if (!arrayList || !statsOut)
+        return STATUS_ERR_INVALID_ARGUMENT;
+
+    DSA_STATS_COPY(statsOut, arrayList);
+    return STATUS_OK;
+}
+
+/* --------------------------------- Borrowed Access --------------------------------- */
+
+void* ArrayList_at(const ArrayList* arrayList, size_t index)
+{
+    if (!arrayList || index >= arrayList->size)
+        return NULL;
+    return _ArrayList_at(arrayList, index);
+}
+
+void* ArrayList_data(const ArrayList* arrayList)
+{
+    if (!arrayList || arrayList->capacity == 0)
+        return NULL;
+    return arrayList->data;
+}
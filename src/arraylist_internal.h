@@ -0,0 +1,78 @@
+/**
+ * @file arraylist_internal.h
+ * @internal
+ * @brief Private layout of the ArrayList, shared with modules built on top of it.
+ *
+ * This header is not installed. It lets sibling containers (such as the Heap)
+ * operate directly on an ArrayList's contiguous buffer instead of copying
+ * every element through `ArrayList_get`/`ArrayList_set`.
+ */
+#ifndef ARRAYLIST_INTERNAL_H
+#define ARRAYLIST_INTERNAL_H
+
+#include "../include/arraylist.h"
+#include "allocator_internal.h"
+#include "snapshot_internal.h"
+#include "stats_internal.h"
+
+/**
+ * @brief Bytes of element storage inside the ArrayList struct itself.
+ * @details A list whose capacity fits here keeps its elements inline and
+ * never allocates a separate buffer, so small lists cost one allocation and
+ * one cache miss fewer. Larger capacities move to the allocator.
+ */
+#define ARRAYLIST_INLINE_BYTES 64
+
+/**
+ * @brief The internal structure of the ArrayList.
+ * @details This struct holds all the necessary state for the list, including
+ * its size, capacity, the size of the data type it holds, and a void pointer
+ * to the actual block of memory where elements are stored.
+ */
+struct ArrayList
+{
+    size_t capacity; // The total number of elements the list can currently hold.
+    size_t dataSize; // The size of a single element in bytes (e.g., sizeof(int)).
+    size_t size;     // The current number of elements in the list.
+    void* data;      // The elements: `inlineData`, a buffer from the allocator, or a file mapping.
+    ArrayListPolicy policy; // How the capacity grows and shrinks.
+    DsaAllocator allocator; // Where the struct and its buffer are allocated.
+    void* mapping;          // The file mapping `data` points into, or NULL if `data` came from the allocator.
+    size_t mappingLength;   // The length of `mapping` in bytes.
+    DSA_STATS_MEMBER        // Work counters, present only when built with DSA_STATS.
+    _Alignas(max_align_t) unsigned char inlineData[ARRAYLIST_INLINE_BYTES]; // Storage for small capacities.
+};
+
+/**
+ * @internal
+ * @brief Returns the address of the element at `index` without bounds checking.
+ */
+static inline void* _ArrayList_at(const ArrayList* arrayList, size_t index)
+{
+    return (char*)arrayList->data + index * arrayList->dataSize;
+}
+
+/**
+ * @internal
+ * @brief Ensures the list can hold at least `minCapacity` elements without reallocating.
+ * @return `STATUS_OK`, `STATUS_ERR_OVERFLOW` or `STATUS_ERR_ALLOC`.
+ */
+STATUS _ArrayList_reserve(ArrayList* arrayList, size_t minCapacity);
+
+/**
+ * @internal
+ * @brief Creates a list holding a snapshot's payload, read from `fd` just after its header.
+ * @return The list, or NULL on allocation or read failure.
+ */
+ArrayList* _ArrayList_readSnapshot(int fd, const SnapshotInfo* info);
+
+/**
+ * @internal
+ * @brief Creates a list whose buffer is a private mapping of a snapshot file's payload.
+ * @param kind The required container kind, or 0 to accept any.
+ * @param info Receives the header fields.
+ * @return The list, or NULL if the file cannot be mapped or does not match.
+ */
+ArrayList* _ArrayList_mapSnapshot(const char* path, size_t dataSize, uint32_t kind, SnapshotInfo* info);
+
+#endif // ARRAYLIST_INTERNAL_H
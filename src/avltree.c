@@ -1,4 +1,8 @@
 #include "../include/avltree.h"
+#include "../include/pool.h"
+#include "allocator_internal.h"
+#include "snapshot_internal.h"
+#include "stats_internal.h"
 
 /**
  * @internal
@@ -7,10 +11,12 @@
  */
 typedef struct AVLNode
 {
-    void* data;             // Pointer to the stored data, which is heap-allocated.
     struct AVLNode* left;   // Pointer to the left child node.
     struct AVLNode* right;  // Pointer to the right child node.
     int height;             // The height of the subtree rooted at this node.
+    bool dead;              // Whether the node is a tombstone left by a lazy delete.
+    size_t size;            // The number of live (not dead) nodes in the subtree rooted at this node.
+    unsigned char data[];   // The stored element, inline in the same allocation as the node.
 } AVLNode;
 
 /**
@@ -23,41 +29,90 @@ struct AVLTree
     AVLNode* root;                              // Pointer to the root node of the tree.
     size_t dataSize;                            // The size in bytes of the data stored in each node.
     int (*cmp)(const void *, const void *);     // Function to compare two elements.
+    Pool* pool;                                 // Node allocator when the tree is pooled, otherwise `NULL`.
+    DsaAllocator allocator;                     // Where the struct and (unless pooled) the nodes are allocated.
+    size_t tombstones;                          // Dead nodes still linked into the tree.
+    double maxTombstoneRatio;                   // Lazy deletion compacts beyond this share of dead nodes; 0 if disabled.
+    DSA_STATS_MEMBER                            // Work counters, present only when built with DSA_STATS.
 };
 
 /* --------------------------------------Creation & Destruction-------------------------------------- */
 
 AVLTree* AVLTree_init(size_t datasize, int (*cmp)(const void *, const void *))
 {
-    if (!cmp || datasize == 0) return NULL;
+    return AVLTree_initWithAllocator(datasize, cmp, NULL);
+}
+
+AVLTree* AVLTree_initWithAllocator(size_t datasize, int (*cmp)(const void *, const void *), const DsaAllocator* allocator)
+{
+    allocator = _Dsa_resolve(allocator);
+    if (!allocator || !cmp || datasize == 0 || datasize > SIZE_MAX - sizeof(AVLNode)) return NULL;
 
-    AVLTree* avl = malloc(sizeof(AVLTree));
+    AVLTree* avl = _Dsa_alloc(allocator, sizeof(AVLTree));
     if (!avl) return NULL;
 
     avl->root = NULL;
     avl->dataSize = datasize;
     avl->cmp = cmp;
+    avl->pool = NULL;
+    avl->allocator = *allocator;
+    avl->tombstones = 0;
+    avl->maxTombstoneRatio = 0.0;
+    DSA_STATS_INIT(avl);
+    return avl;
+}
+
+AVLTree* AVLTree_initPooled(size_t datasize, int (*cmp)(const void *, const void *), size_t nodesPerChunk)
+{
+    AVLTree* avl = AVLTree_init(datasize, cmp);
+    if (!avl) return NULL;
+
+    avl->pool = Pool_init(sizeof(AVLNode) + datasize, nodesPerChunk);
+    if (!avl->pool) {
+        _Dsa_free(&avl->allocator, avl, sizeof(AVLTree));
+        return NULL;
+    }
     return avl;
 }
 
 /**
  * @internal
- * @brief Recursively frees a node and all its descendants.
+ * @brief Frees a node and all its descendants without recursion.
+ * @details Whenever the current node has a left child, a right rotation moves
+ * that child up; once it has none, the node is freed and its right subtree
+ * is processed next. Every node is rotated at most once, so this is O(n)
+ * with no stack. With a bulk allocator there is nothing to free.
  */
-static void _AVLTree_destroyNode(AVLNode* root)
+static void _AVLTree_destroyNode(const AVLTree* avl, AVLNode* root)
 {
-    if (!root) return;
-    _AVLTree_destroyNode(root->left);
-    _AVLTree_destroyNode(root->right);
-    free(root->data);
-    free(root);
+    if (!_Dsa_freesIndividually(&avl->allocator)) return;
+
+    while (root) {
+        if (root->left) {
+            AVLNode* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            AVLNode* right = root->right;
+            _Dsa_free(&avl->allocator, root, sizeof(AVLNode) + avl->dataSize);
+            root = right;
+        }
+    }
 }
 
 void AVLTree_destroy(AVLTree* avl)
 {
     if (!avl) return;
-    _AVLTree_destroyNode(avl->root);
-    free(avl);
+    if (avl->pool) {
+        // Every node lives in the pool's chunks; release them wholesale.
+        Pool_destroy(avl->pool);
+        avl->pool = NULL;
+    } else {
+        _AVLTree_destroyNode(avl, avl->root);
+    }
+    DsaAllocator allocator = avl->allocator;
+    _Dsa_free(&allocator, avl, sizeof(AVLTree));
 }
 
 /* -----------------------------------Private Helpers for Balancing----------------------------------- */
@@ -74,14 +129,24 @@ static int _AVLTree_getHeight(AVLNode* node)
 
 /**
  * @internal
- * @brief Updates the height of a node based on the height of its children.
+ * @brief Gets the number of live nodes in a subtree. Returns 0 for a NULL node.
  */
-static void _AVLTree_updateHeight(AVLNode* root)
+static size_t _AVLTree_getSize(const AVLNode* node)
+{
+    return node ? node->size : 0;
+}
+
+/**
+ * @internal
+ * @brief Updates the height and live subtree size of a node based on its children.
+ */
+static void _AVLTree_updateNode(AVLNode* root)
 {
     if (root) {
         int leftHeight = _AVLTree_getHeight(root->left);
         int rightHeight = _AVLTree_getHeight(root->right);
         root->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+        root->size = !root->dead + _AVLTree_getSize(root->left) + _AVLTree_getSize(root->right);
     }
 }
 
@@ -95,31 +160,52 @@ static int _AVLTree_getBalanceFactor(AVLNode* root)
     return (_AVLTree_getHeight(root->left) - _AVLTree_getHeight(root->right));
 }
 
+/**
+ * @internal
+ * @brief Calls the comparator, counting the call in stats builds.
+ */
+static inline int _AVLTree_compare(const AVLTree* avl, const void* a, const void* b)
+{
+    DSA_STAT_ADD(avl, comparisons, 1);
+    return avl->cmp(a, b);
+}
+
 /**
  * @internal
  * @brief Allocates a new node and copies the provided data into it.
+ * @details The node and its element are a single block, taken from the tree's
+ * pool when it has one and from its allocator otherwise.
  */
-static AVLNode* _AVLTree_getNewNode(size_t dataSize, void *element)
+static AVLNode* _AVLTree_getNewNode(const AVLTree* avl, const void *element)
 {
     if (!element) return NULL;
 
-    AVLNode* newNode = malloc(sizeof(AVLNode));
+    AVLNode* newNode = avl->pool
+        ? Pool_alloc(avl->pool)
+        : _Dsa_alloc(&avl->allocator, sizeof(AVLNode) + avl->dataSize);
     if (!newNode) return NULL;
+    DSA_STAT_ADD(avl, nodeAllocs, 1);
 
-    newNode->data = malloc(dataSize);
-    if (!newNode->data)
-    {
-        free(newNode);
-        return NULL;
-    }
-
-    memcpy(newNode->data, element, dataSize);
+    memcpy(newNode->data, element, avl->dataSize);
     newNode->left = NULL;
     newNode->right = NULL;
     newNode->height = 0; // Height of a new leaf node is 0
+    newNode->dead = false;
+    newNode->size = 1;
     return newNode;
 }
 
+/**
+ * @internal
+ * @brief Releases a node back to wherever it was allocated from.
+ */
+static void _AVLTree_freeNode(const AVLTree* avl, AVLNode* node)
+{
+    DSA_STAT_ADD(avl, nodeFrees, 1);
+    if (avl->pool) Pool_free(avl->pool, node);
+    else _Dsa_free(&avl->allocator, node, sizeof(AVLNode) + avl->dataSize);
+}
+
 /**
  * @internal
  * @brief Performs a right rotation on the subtree rooted at `root`.
@@ -134,9 +220,9 @@ static AVLNode* _AVLTree_rightRotate(AVLNode* root)
     x->right = root;
     root->left = y;
 
-    // Update heights
-    _AVLTree_updateHeight(root);
-    _AVLTree_updateHeight(x);
+    // Update heights and sizes
+    _AVLTree_updateNode(root);
+    _AVLTree_updateNode(x);
 
     return x; // New root of the subtree
 }
@@ -155,210 +241,410 @@ static AVLNode* _AVLTree_leftRotate(AVLNode* root)
     x->left = root;
     root->right = y;
 
-    // Update heights
-    _AVLTree_updateHeight(root);
-    _AVLTree_updateHeight(x);
+    // Update heights and sizes
+    _AVLTree_updateNode(root);
+    _AVLTree_updateNode(x);
 
     return x; // New root of the subtree
 }
 
-/* ------------------------------------------Insertion Logic------------------------------------------ */
-
 /**
  * @internal
- * @brief Recursively inserts a node and then rebalances the tree on the way back up.
+ * @brief Restores the AVL property at `root` after one of its subtrees changed height by one.
+ * @details Picks the single or double rotation from the balance factor of the
+ * heavy child, so no comparator calls are needed.
+ * @param rotations If not NULL, increased by the number of rotations performed.
+ * @return The new root of the subtree.
  */
-static AVLNode* _AVLTree_insertNode(AVLNode* root, size_t dataSize, void* data, int (*cmp)(const void *, const void *), InsertStatus* status)
+static AVLNode* _AVLTree_rebalance(AVLNode* root, unsigned* rotations)
 {
-    // 1. Standard BST insertion
-    if (!root) {
-        root = _AVLTree_getNewNode(dataSize, data);
-        if (root) status->isInserted = true;
-        else status->isAllocFailed = true;
-        return root;
-    }
-    else if (cmp(data, root->data) < 0)
-        root->left = _AVLTree_insertNode(root->left, dataSize, data, cmp, status);
-    else if (cmp(data, root->data) > 0)
-        root->right = _AVLTree_insertNode(root->right, dataSize, data, cmp, status);
-    else {
-        status->isDuplicate = true;
-        return root;
-    }
-
-    // 2. Update height of the current node
-    _AVLTree_updateHeight(root);
-
-    // 3. Get balance factor and check for imbalance
+    _AVLTree_updateNode(root);
     int balanceFactor = _AVLTree_getBalanceFactor(root);
 
-    // 4. Perform rotations if needed
-    // Left-Left (LL) Case
-    // LL -> happens when BF at imbalanced node is 2 and key < root.left.data
-    if (balanceFactor > 1 && root->left && cmp(data, root->left->data) < 0)
-        return _AVLTree_rightRotate(root);
-
-    // Right-Right (RR) Case
-    // RR -> happens when BF at imbalanced node is -2 and key > root.right.data
-    if (balanceFactor < -1 && root->right && cmp(data, root->right->data) > 0)
-        return _AVLTree_leftRotate(root);
-
-    // Left-Right (LR) Case
-    // LR -> happens when BF at imbalanced node is 2 and key > root.left.data
-    if (balanceFactor > 1 && root->left && cmp(data, root->left->data) > 0)
-    {
-        root->left = _AVLTree_leftRotate(root->left);
+    // Left-heavy: LL when the left child leans left or is balanced, otherwise LR.
+    if (balanceFactor > 1) {
+        if (_AVLTree_getBalanceFactor(root->left) < 0) {
+            root->left = _AVLTree_leftRotate(root->left);
+            if (rotations) (*rotations)++;
+        }
+        if (rotations) (*rotations)++;
         return _AVLTree_rightRotate(root);
     }
 
-    // Right-Left (RL) Case
-    // RL -> happens when BF at imbalanced node is -2 and key < root.right.data
-    if (balanceFactor < -1 && root->right && cmp(data, root->right->data) < 0)
-    {
-        root->right = _AVLTree_rightRotate(root->right);
+    // Right-heavy: RR when the right child leans right or is balanced, otherwise RL.
+    if (balanceFactor < -1) {
+        if (_AVLTree_getBalanceFactor(root->right) > 0) {
+            root->right = _AVLTree_rightRotate(root->right);
+            if (rotations) (*rotations)++;
+        }
+        if (rotations) (*rotations)++;
         return _AVLTree_leftRotate(root);
     }
 
     return root;
 }
 
+/**
+ * @internal
+ * @brief Walks back up a recorded search path, rebalancing each subtree.
+ * @details `path[i]` is the link (parent's child pointer, or the root pointer)
+ * through which the i-th node of the path was reached. Retracing stops as soon
+ * as a subtree ends up with the height it had before the change, since no
+ * ancestor above it can be affected. Subtree sizes must already be up to date
+ * along the whole path.
+ */
+static void _AVLTree_retrace(const AVLTree* avl, AVLNode** path[], size_t depth)
+{
+    unsigned rotations = 0;
+    while (depth > 0) {
+        AVLNode** link = path[--depth];
+        int oldHeight = (*link)->height;
+        *link = _AVLTree_rebalance(*link, &rotations);
+        if ((*link)->height == oldHeight) break;
+    }
+    DSA_STAT_ADD(avl, rotations, rotations);
+}
+
+/* ------------------------------------------Insertion Logic------------------------------------------ */
+
 STATUS AVLTree_insert(AVLTree* avl, void* element)
 {
+    DSA_TRACE("AVLTree", "insert", avl);
     if (!avl || !element) return STATUS_ERR_INVALID_ARGUMENT;
 
-    InsertStatus status = {0};
+    AVLNode** path[AVLTREE_MAX_DEPTH];
+    size_t depth = 0;
+    AVLNode** link = &avl->root;
 
-    avl->root = _AVLTree_insertNode(avl->root, avl->dataSize, element, avl->cmp, &status);
-    
-    if (status.isInserted) return STATUS_OK;
-    if (status.isAllocFailed) return STATUS_ERR_ALLOC;
-    if (status.isDuplicate) return STATUS_ERR_DUPLICATE_KEY;
-    
-    return STATUS_ERR_UNKNOWN;
+    // 1. Standard BST descent, one comparison per level.
+    while (*link) {
+        AVLNode* node = *link;
+        int order = _AVLTree_compare(avl, element, node->data);
+        if (order == 0) {
+            if (!node->dead) return STATUS_ERR_DUPLICATE_KEY;
+            // Revive the tombstone in place; the tree's shape does not change.
+            memcpy(node->data, element, avl->dataSize);
+            node->dead = false;
+            node->size++;
+            for (size_t i = 0; i < depth; i++)
+                (*path[i])->size++;
+            avl->tombstones--;
+            return STATUS_OK;
+        }
+        path[depth++] = link;
+        link = order < 0 ? &node->left : &node->right;
+    }
+
+    // 2. Attach the new leaf.
+    AVLNode* newNode = _AVLTree_getNewNode(avl, element);
+    if (!newNode) return STATUS_ERR_ALLOC;
+    *link = newNode;
+
+    // Every node on the path gained one descendant.
+    for (size_t i = 0; i < depth; i++)
+        (*path[i])->size++;
+
+    // 3. Update heights and rotate on the way back up; at most one rotation is needed.
+    _AVLTree_retrace(avl, path, depth);
+    DSA_STAT_MAX(avl, maxHeight, avl->root->height + 1);
+    return STATUS_OK;
 }
 
 /* ----------------------------------------------Deletion Logic---------------------------------------------- */
 
 /**
  * @internal
- * @brief Finds the node with the minimum value in a subtree (the leftmost node).
+ * @brief Builds a perfectly balanced subtree from the first `count` nodes of a
+ * vine (nodes linked through `right` in order), advancing `*vine` past them.
  */
-static AVLNode* _AVLTree_getMin(AVLNode* root) {
-    if (!root) return NULL;
-    if (!root->left) return root;
-    return _AVLTree_getMin(root->left);
+static AVLNode* _AVLTree_buildFromVine(AVLNode** vine, size_t count)
+{
+    if (count == 0) return NULL;
+
+    AVLNode* left = _AVLTree_buildFromVine(vine, count / 2);
+    AVLNode* node = *vine;
+    *vine = node->right;
+    node->left = left;
+    node->right = _AVLTree_buildFromVine(vine, count - count / 2 - 1);
+    _AVLTree_updateNode(node);
+    return node;
 }
 
 /**
  * @internal
- * @brief Recursively deletes a node and then rebalances the tree on the way back up.
+ * @brief Frees every tombstone, and every element equal to one of `count` keys
+ * in non-decreasing order, then rebuilds the tree perfectly balanced.
+ * @details Flattens the tree into a vine with right rotations, as
+ * `_AVLTree_destroyNode` does, dropping nodes along the way, then rebuilds it
+ * from the vine. Costs O(n + k) for k keys, without allocating.
+ * @param deleted If not NULL, increased by the number of live elements removed by key.
  */
-static AVLNode* _AVLTree_deleteNode(AVLNode* root, void* key, size_t datasize, int (*cmp)(const void *, const void *), DeleteStatus* status) {
-    // 1. Standard BST deletion
-    if (!root) {
-        status->isKeyNotFound = true;
-        return NULL;
-    }
-    else if (cmp(key, root->data) < 0)
-        root->left = _AVLTree_deleteNode(root->left, key, datasize, cmp, status);
-    else if (cmp(key, root->data) > 0)
-        root->right = _AVLTree_deleteNode(root->right, key, datasize, cmp, status);
-    else { // Node to be deleted found
-        // No child
-        if (!root->left && !root->right) {
-            free(root->data);
-            free(root);
-            root = NULL;
-        }
-        // One child
-        else if (!root->left) {
-            AVLNode* temp = root;
-            root = root->right;
-            free(temp->data);
-            free(temp);
-            temp = NULL;
-        }
-        else if (!root->right) {
-            AVLNode* temp = root;
-            root = root->left;
-            free(temp->data);
-            free(temp);
-            temp = NULL;
-        }
-        // Node with 2 children: get in-order successor (smallest in right subtree)
-        else {
-            AVLNode* inorderSuccessor = _AVLTree_getMin(root->right);
-            if (!inorderSuccessor) return root;
-            memcpy(root->data, inorderSuccessor->data, datasize);
-            // Delete the in-order successor
-            root->right = _AVLTree_deleteNode(root->right, inorderSuccessor->data, datasize, cmp, status);
+static void _AVLTree_rebuild(AVLTree* avl, const char* keys, size_t count, size_t* deleted)
+{
+    AVLNode* vine = NULL;
+    AVLNode** tail = &vine;
+    size_t live = 0;
+    AVLNode* root = avl->root;
+    while (root) {
+        if (root->left) {
+            AVLNode* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            AVLNode* right = root->right;
+            // Nodes arrive in order, so the keys are consumed as in a merge.
+            int order = 1;
+            while (count > 0 && (order = avl->cmp(keys, root->data)) < 0) {
+                keys += avl->dataSize;
+                count--;
+            }
+            if (root->dead || (count > 0 && order == 0)) {
+                if (!root->dead && deleted) (*deleted)++;
+                _AVLTree_freeNode(avl, root);
+            } else {
+                *tail = root;
+                tail = &root->right;
+                live++;
+            }
+            root = right;
         }
-        status->isDeleted = true;
     }
+    *tail = NULL;
 
-    if (!root) return NULL; // Handle if tree became empty after deletion
+    avl->root = _AVLTree_buildFromVine(&vine, live);
+    avl->tombstones = 0;
+}
+
+/**
+ * @internal
+ * @brief Compacts the tree if it holds any tombstones, for operations that only handle live nodes.
+ */
+static void _AVLTree_purge(AVLTree* avl)
+{
+    if (avl->tombstones > 0) _AVLTree_rebuild(avl, NULL, 0, NULL);
+}
 
-    // 2. Update height
-    _AVLTree_updateHeight(root);
+STATUS AVLTree_delete(AVLTree* avl, void* key)
+{
+    DSA_TRACE("AVLTree", "delete", avl);
+    if (!avl || !key) return STATUS_ERR_INVALID_ARGUMENT;
 
-    // 3. Get balance factor and rebalance if necessary
-    int balanceFactor = _AVLTree_getBalanceFactor(root);
+    AVLNode** path[AVLTREE_MAX_DEPTH];
+    size_t depth = 0;
+    AVLNode** link = &avl->root;
 
-    // case - 1 deletion in right causes heavy left subtree
-    // R0 -> LL R1 -> LL | R-1 -> LR
-    if (balanceFactor > 1 && _AVLTree_getBalanceFactor(root->left) >= 0)
-        return _AVLTree_rightRotate(root);
-    if (balanceFactor > 1 && _AVLTree_getBalanceFactor(root->left) < 0) {
-        root->left = _AVLTree_leftRotate(root->left);
-        return _AVLTree_rightRotate(root);
+    // 1. Find the node, one comparison per level.
+    while (*link) {
+        int order = _AVLTree_compare(avl, key, (*link)->data);
+        if (order == 0) break;
+        path[depth++] = link;
+        link = order < 0 ? &(*link)->left : &(*link)->right;
     }
+    if (!*link || (*link)->dead) return STATUS_ERR_KEY_NOT_FOUND;
 
-    // case - 2 deletion in left causes heavy right subtree
-    // L0 -> RR L-1 -> RR | L1 -> RL
-    if (balanceFactor < -1 && _AVLTree_getBalanceFactor(root->right) <= 0)
-        return _AVLTree_leftRotate(root);
-    if (balanceFactor < -1 && _AVLTree_getBalanceFactor(root->right) > 0) {
-        root->left = _AVLTree_rightRotate(root->left);
-        return _AVLTree_leftRotate(root);
+    AVLNode* target = *link;
+    if (avl->maxTombstoneRatio > 0.0) {
+        // Lazy mode: leave the node in place as a tombstone; only the live counts change.
+        target->dead = true;
+        target->size--;
+        for (size_t i = 0; i < depth; i++)
+            (*path[i])->size--;
+        avl->tombstones++;
+        if ((double)avl->tombstones > avl->maxTombstoneRatio * (double)(avl->tombstones + avl->root->size))
+            _AVLTree_rebuild(avl, NULL, 0, NULL);
+        return STATUS_OK;
     }
 
-    return root;    
-}
+    if (!target->left || !target->right) {
+        // 2a. Zero or one child: the child takes the node's place.
+        *link = target->left ? target->left : target->right;
+    } else {
+        // 2b. Two children: relink the in-order successor (leftmost of the right
+        // subtree) into the node's position instead of copying its data.
+        size_t targetDepth = depth;
+        path[depth++] = link;
 
-STATUS AVLTree_delete(AVLTree* avl, void* key) {
-    if (!avl || !key) return STATUS_ERR_INVALID_ARGUMENT;
+        AVLNode** successorLink = &target->right;
+        while ((*successorLink)->left) {
+            path[depth++] = successorLink;
+            successorLink = &(*successorLink)->left;
+        }
+        AVLNode* successor = *successorLink;
+        *successorLink = successor->right;
 
-    DeleteStatus status = {0};
+        successor->left = target->left;
+        successor->right = target->right;
+        successor->height = target->height;
+        successor->size = target->size; // Decremented with the rest of the path below.
+        *link = successor;
 
-    avl->root = _AVLTree_deleteNode(avl->root, key, avl->dataSize, avl->cmp, &status);
+        // The link below the target now lives inside the successor.
+        if (depth > targetDepth + 1) path[targetDepth + 1] = &successor->right;
+    }
+    _AVLTree_freeNode(avl, target);
 
-    if (status.isDeleted) return STATUS_OK;
-    if (status.isKeyNotFound) return STATUS_ERR_KEY_NOT_FOUND;
+    // Every node still on the path lost one descendant.
+    for (size_t i = 0; i < depth; i++)
+        (*path[i])->size--;
 
-    return STATUS_ERR_UNKNOWN;
+    // 3. Rebalance the path from the removed position up to the root.
+    _AVLTree_retrace(avl, path, depth);
+    return STATUS_OK;
 }
 
 /* ----------------------------------------------Search Logic---------------------------------------------- */
 
+void* AVLTree_search(AVLTree* avl, void* key)
+{
+    DSA_TRACE("AVLTree", "search", avl);
+    if (!avl || !key) return NULL;
+
+    AVLNode* node = avl->root;
+    while (node) {
+        int order = _AVLTree_compare(avl, key, node->data);
+        if (order == 0) return node->dead ? NULL : node->data;
+        node = order < 0 ? node->left : node->right;
+    }
+    return NULL;
+}
+
+/* ------------------------------------------Order Statistics------------------------------------------ */
+
+size_t AVLTree_size(const AVLTree* avl)
+{
+    if (!avl) return 0;
+    return _AVLTree_getSize(avl->root);
+}
+
 /**
  * @internal
- * @brief Recursively searches for a node with the given key.
+ * @brief Counts the elements ordered before `key`, or also equal to it when `inclusive`.
  */
-static AVLNode* _AVLTree_searchNode(AVLNode* root, void* key, int (*cmp)(const void *, const void *))
+static size_t _AVLTree_countBelow(const AVLTree* avl, const void* key, bool inclusive)
 {
-    if (!root || cmp(key, root->data) == 0)
-        return root;
-    else if (cmp(key, root->data) < 0)
-        return _AVLTree_searchNode(root->left, key, cmp);
-    else
-        return _AVLTree_searchNode(root->right, key, cmp);
+    size_t count = 0;
+    AVLNode* node = avl->root;
+    while (node) {
+        int order = _AVLTree_compare(avl, key, node->data);
+        if (order == 0) // Keys are unique, so nothing further right can match.
+            return count + _AVLTree_getSize(node->left) + (inclusive && !node->dead ? 1 : 0);
+        if (order > 0) {
+            count += _AVLTree_getSize(node->left) + !node->dead;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return count;
 }
 
-void* AVLTree_search(AVLTree* avl, void* key)
+/**
+ * @internal
+ * @brief Finds the node holding the k-th smallest live element, or NULL if there are not that many.
+ */
+static AVLNode* _AVLTree_selectNode(const AVLTree* avl, size_t k)
+{
+    AVLNode* node = avl->root;
+    while (node) {
+        size_t leftSize = _AVLTree_getSize(node->left);
+        if (k < leftSize) {
+            node = node->left;
+        } else if (k == leftSize && !node->dead) {
+            return node;
+        } else {
+            k -= leftSize + !node->dead;
+            node = node->right;
+        }
+    }
+    return NULL; // k is not smaller than the size of the tree.
+}
+
+/**
+ * @internal
+ * @brief Finds the first element not ordered before `key` (`strict` false) or after it (`strict` true).
+ * @details With tombstones present, the bound is found by rank instead, which skips them.
+ */
+static AVLNode* _AVLTree_bound(const AVLTree* avl, const void* key, bool strict)
+{
+    if (avl->tombstones > 0) return _AVLTree_selectNode(avl, _AVLTree_countBelow(avl, key, strict));
+
+    AVLNode* node = avl->root;
+    AVLNode* candidate = NULL;
+    while (node) {
+        int order = _AVLTree_compare(avl, key, node->data);
+        if (order == 0 && !strict) return node; // Keys are unique.
+        if (order < 0) {
+            candidate = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return candidate;
+}
+
+void* AVLTree_lowerBound(const AVLTree* avl, const void* key)
+{
+    if (!avl || !key) return NULL;
+    AVLNode* found = _AVLTree_bound(avl, key, false);
+    return found ? found->data : NULL;
+}
+
+void* AVLTree_upperBound(const AVLTree* avl, const void* key)
 {
     if (!avl || !key) return NULL;
-    AVLNode* found = _AVLTree_searchNode(avl->root, key, avl->cmp);
-    return (found) ? found->data : NULL;
+    AVLNode* found = _AVLTree_bound(avl, key, true);
+    return found ? found->data : NULL;
+}
+
+size_t AVLTree_rank(const AVLTree* avl, const void* key)
+{
+    if (!avl || !key) return 0;
+    return _AVLTree_countBelow(avl, key, false);
+}
+
+void* AVLTree_select(const AVLTree* avl, size_t k)
+{
+    if (!avl) return NULL;
+    AVLNode* found = _AVLTree_selectNode(avl, k);
+    return found ? found->data : NULL;
+}
+
+size_t AVLTree_countRange(const AVLTree* avl, const void* lo, const void* hi)
+{
+    if (!avl || !lo || !hi || _AVLTree_compare(avl, lo, hi) > 0) return 0;
+    return _AVLTree_countBelow(avl, hi, true) - _AVLTree_countBelow(avl, lo, false);
+}
+
+STATUS AVLTree_visitRange(const AVLTree* avl, const void* lo, const void* hi,
+    bool (*visit)(void* element, void* ctx), void* ctx)
+{
+    if (!avl || !visit) return STATUS_ERR_INVALID_ARGUMENT;
+
+    AVLNode* stack[AVLTREE_MAX_DEPTH];
+    size_t depth = 0;
+
+    // Seek: stack every node on the path to lo that is not ordered before it.
+    AVLNode* node = avl->root;
+    while (node) {
+        if (!lo || _AVLTree_compare(avl, lo, node->data) <= 0) {
+            stack[depth++] = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+
+    // The stack now yields the remaining elements in order, like an in-order walk.
+    while (depth > 0) {
+        node = stack[--depth];
+        if (hi && _AVLTree_compare(avl, node->data, hi) > 0) break;
+        if (!node->dead && !visit(node->data, ctx)) break;
+        for (AVLNode* next = node->right; next; next = next->left)
+            stack[depth++] = next;
+    }
+    return STATUS_OK;
 }
 
 /* --------------------------------------------Traversal Logic---------------------------------------------- */
@@ -370,31 +656,662 @@ typedef enum {
 
 /**
  * @internal
- * @brief A single recursive function to handle all three traversal types.
+ * @brief A single iterative function to handle all three traversal types.
+ * @details The stack holds the ancestors of the current position, so it never
+ * grows beyond the height of the tree. Tombstones are walked but not visited.
+ * Stops as soon as `visit` returns false.
  */
-static void _AVLTree_forEachNode(AVLNode* root, void (*callback)(void *), TraversalOrder order) {
-    if (!root || !callback) return;
-    if (order == TRAVERSAL_PREORDER) callback(root->data);
-    _AVLTree_forEachNode(root->left, callback, order);
-    if (order == TRAVERSAL_INORDER) callback(root->data);
-    _AVLTree_forEachNode(root->right, callback, order);
-    if (order == TRAVERSAL_POSTORDER) callback(root->data);
+static void _AVLTree_forEachNode(AVLNode* root, bool (*visit)(void*, void*), void* ctx, TraversalOrder order) {
+    AVLNode* stack[AVLTREE_MAX_DEPTH];
+    size_t depth = 0;
+    AVLNode* node = root;
+    AVLNode* lastVisited = NULL;
+
+    while (node || depth > 0) {
+        // Go down to the leftmost node of the current subtree.
+        if (node) {
+            if (order == TRAVERSAL_PREORDER && !node->dead && !visit(node->data, ctx)) return;
+            stack[depth++] = node;
+            node = node->left;
+            continue;
+        }
+
+        AVLNode* top = stack[depth - 1];
+        if (order != TRAVERSAL_POSTORDER) {
+            depth--;
+            if (order == TRAVERSAL_INORDER && !top->dead && !visit(top->data, ctx)) return;
+            node = top->right;
+        } else if (top->right && top->right != lastVisited) {
+            // Post-order visits a node only after coming back up from its right subtree.
+            node = top->right;
+        } else {
+            depth--;
+            if (!top->dead && !visit(top->data, ctx)) return;
+            lastVisited = top;
+        }
+    }
 }
 
-STATUS AVLTree_traverseInorder(AVLTree* avl, void (*callback)(void *)) {
+/**
+ * @internal
+ * @brief Carries a plain `void (*)(void*)` callback through the `ctx` of `_AVLTree_forEachNode`.
+ */
+typedef struct {
+    void (*callback)(void *);
+} PlainCallback;
+
+/**
+ * @internal
+ * @brief Adapts a plain callback to the early-stopping form; never stops.
+ */
+static bool _AVLTree_callPlain(void* data, void* ctx) {
+    ((PlainCallback*)ctx)->callback(data);
+    return true;
+}
+
+/**
+ * @internal
+ * @brief Runs a plain callback over the whole tree in the given order.
+ */
+static STATUS _AVLTree_traverse(AVLTree* avl, void (*callback)(void *), TraversalOrder order) {
     if (!avl || !callback) return STATUS_ERR_INVALID_ARGUMENT;
-    _AVLTree_forEachNode(avl->root, callback, TRAVERSAL_INORDER);
+    PlainCallback plain = { callback };
+    _AVLTree_forEachNode(avl->root, _AVLTree_callPlain, &plain, order);
     return STATUS_OK;
 }
 
-STATUS AVLTree_traversePreorder(AVLTree* avl, void (*callback)(void *)) {
+/**
+ * @internal
+ * @brief Runs an early-stopping callback with context over the tree in the given order.
+ */
+static STATUS _AVLTree_traverseCtx(AVLTree* avl, bool (*callback)(void*, void*), void* ctx, TraversalOrder order) {
     if (!avl || !callback) return STATUS_ERR_INVALID_ARGUMENT;
-    _AVLTree_forEachNode(avl->root, callback, TRAVERSAL_PREORDER);
+    _AVLTree_forEachNode(avl->root, callback, ctx, order);
     return STATUS_OK;
 }
 
+STATUS AVLTree_traverseInorder(AVLTree* avl, void (*callback)(void *)) {
+    return _AVLTree_traverse(avl, callback, TRAVERSAL_INORDER);
+}
+
+STATUS AVLTree_traversePreorder(AVLTree* avl, void (*callback)(void *)) {
+    return _AVLTree_traverse(avl, callback, TRAVERSAL_PREORDER);
+}
+
 STATUS AVLTree_traversePostorder(AVLTree* avl, void (*callback)(void *)) {
-    if (!avl || !callback) return STATUS_ERR_INVALID_ARGUMENT;
-    _AVLTree_forEachNode(avl->root, callback, TRAVERSAL_POSTORDER);
+    return _AVLTree_traverse(avl, callback, TRAVERSAL_POSTORDER);
+}
+
+STATUS AVLTree_traverseInorderCtx(AVLTree* avl, bool (*callback)(void* element, void* ctx), void* ctx) {
+    return _AVLTree_traverseCtx(avl, callback, ctx, TRAVERSAL_INORDER);
+}
+
+STATUS AVLTree_traversePreorderCtx(AVLTree* avl, bool (*callback)(void* element, void* ctx), void* ctx) {
+    return _AVLTree_traverseCtx(avl, callback, ctx, TRAVERSAL_PREORDER);
+}
+
+STATUS AVLTree_traversePostorderCtx(AVLTree* avl, bool (*callback)(void* element, void* ctx), void* ctx) {
+    return _AVLTree_traverseCtx(avl, callback, ctx, TRAVERSAL_POSTORDER);
+}
+
+/* --------------------------------------------Iterator Logic---------------------------------------------- */
+
+/**
+ * @internal
+ * @brief Returns the element the iterator is positioned on, or NULL once it is exhausted.
+ */
+static void* _AVLTreeIterator_current(const AVLTreeIterator* it) {
+    return it->depth > 0 ? it->path[it->depth - 1]->data : NULL;
+}
+
+/**
+ * @internal
+ * @brief Extends the path from `node` down its leftmost (or rightmost) spine.
+ */
+static void _AVLTreeIterator_descend(AVLTreeIterator* it, AVLNode* node, bool leftmost) {
+    while (node) {
+        it->path[it->depth++] = node;
+        node = leftmost ? node->left : node->right;
+    }
+}
+
+/**
+ * @internal
+ * @brief Moves the iterator to the in-order successor (`forward`) or predecessor of its node.
+ */
+static void _AVLTreeIterator_step(AVLTreeIterator* it, bool forward) {
+    AVLNode* node = it->path[it->depth - 1];
+    AVLNode* child = forward ? node->right : node->left;
+    if (child) {
+        // The successor is the leftmost node of the right subtree (mirrored for the predecessor).
+        _AVLTreeIterator_descend(it, child, forward);
+    } else {
+        // Otherwise climb until we leave a left subtree; its parent is the successor.
+        while (--it->depth > 0 && (forward ? it->path[it->depth - 1]->right : it->path[it->depth - 1]->left) == node)
+            node = it->path[it->depth - 1];
+    }
+}
+
+/**
+ * @internal
+ * @brief Steps past any tombstones in the given direction and returns the element reached.
+ */
+static void* _AVLTreeIterator_skipDead(AVLTreeIterator* it, bool forward) {
+    while (it->depth > 0 && it->path[it->depth - 1]->dead)
+        _AVLTreeIterator_step(it, forward);
+    return _AVLTreeIterator_current(it);
+}
+
+void* AVLTreeIterator_begin(AVLTreeIterator* it, const AVLTree* avl) {
+    if (!it) return NULL;
+    it->tree = avl;
+    it->depth = 0;
+    if (avl) _AVLTreeIterator_descend(it, avl->root, true);
+    return _AVLTreeIterator_skipDead(it, true);
+}
+
+void* AVLTreeIterator_last(AVLTreeIterator* it, const AVLTree* avl) {
+    if (!it) return NULL;
+    it->tree = avl;
+    it->depth = 0;
+    if (avl) _AVLTreeIterator_descend(it, avl->root, false);
+    return _AVLTreeIterator_skipDead(it, false);
+}
+
+void* AVLTreeIterator_seek(AVLTreeIterator* it, const AVLTree* avl, const void* key) {
+    if (!it) return NULL;
+    it->tree = avl;
+    it->depth = 0;
+    if (!avl || !key) return NULL;
+
+    // Record the whole search path, then cut it back to the last node that is
+    // not ordered before the key: that node is the lower bound.
+    size_t boundDepth = 0;
+    AVLNode* node = avl->root;
+    while (node) {
+        int order = _AVLTree_compare(avl, key, node->data);
+        it->path[it->depth++] = node;
+        if (order == 0) return _AVLTreeIterator_skipDead(it, true);
+        if (order < 0) {
+            boundDepth = it->depth;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    it->depth = boundDepth;
+    return _AVLTreeIterator_skipDead(it, true);
+}
+
+void* AVLTreeIterator_get(const AVLTreeIterator* it) {
+    if (!it) return NULL;
+    return _AVLTreeIterator_current(it);
+}
+
+void* AVLTreeIterator_next(AVLTreeIterator* it) {
+    if (!it || it->depth == 0) return NULL;
+    _AVLTreeIterator_step(it, true);
+    return _AVLTreeIterator_skipDead(it, true);
+}
+
+void* AVLTreeIterator_prev(AVLTreeIterator* it) {
+    if (!it || it->depth == 0) return NULL;
+    _AVLTreeIterator_step(it, false);
+    return _AVLTreeIterator_skipDead(it, false);
+}
+
+/* --------------------------------------Bulk Build & Set Operations-------------------------------------- */
+
+/**
+ * @internal
+ * @brief Builds a perfectly balanced subtree from the sorted elements `[lo, hi)`.
+ * @return The subtree root, or NULL when the range is empty or on allocation
+ * failure (`*failed` is set and nothing is leaked).
+ */
+static AVLNode* _AVLTree_buildBalanced(const AVLTree* avl, const char* data, size_t lo, size_t hi, bool* failed)
+{
+    if (lo >= hi) return NULL;
+
+    size_t mid = lo + (hi - lo) / 2;
+    AVLNode* left = _AVLTree_buildBalanced(avl, data, lo, mid, failed);
+    if (*failed) return NULL;
+
+    AVLNode* node = _AVLTree_getNewNode(avl, data + mid * avl->dataSize);
+    if (!node) {
+        _AVLTree_destroyNode(avl, left);
+        *failed = true;
+        return NULL;
+    }
+
+    AVLNode* right = _AVLTree_buildBalanced(avl, data, mid + 1, hi, failed);
+    if (*failed) {
+        _AVLTree_destroyNode(avl, left);
+        _AVLTree_freeNode(avl, node);
+        return NULL;
+    }
+
+    node->left = left;
+    node->right = right;
+    _AVLTree_updateNode(node);
+    return node;
+}
+
+AVLTree* AVLTree_buildFromSorted(const void* data, size_t count, size_t dataSize, int (*cmp)(const void *, const void *))
+{
+    if (!data && count > 0) return NULL;
+
+    AVLTree* avl = AVLTree_init(dataSize, cmp);
+    if (!avl) return NULL;
+
+    // Keys must be strictly increasing for the result to be a valid search tree.
+    const char* bytes = data;
+    for (size_t i = 1; i < count; i++) {
+        if (cmp(bytes + (i - 1) * dataSize, bytes + i * dataSize) >= 0) {
+            AVLTree_destroy(avl);
+            return NULL;
+        }
+    }
+
+    bool failed = false;
+    avl->root = _AVLTree_buildBalanced(avl, bytes, 0, count, &failed);
+    if (failed) {
+        AVLTree_destroy(avl);
+        return NULL;
+    }
+    return avl;
+}
+
+/**
+ * @internal
+ * @brief Joins `left`, the single node `middle`, and `right`, where every element of
+ * `left` is ordered before `middle` and every element of `right` after it.
+ * @details Descends the spine of the taller tree until the heights are within
+ * one, hangs the shorter tree there under `middle`, and rebalances on the way
+ * back up. Costs O(|height(left) - height(right)| + 1).
+ */
+static AVLNode* _AVLTree_join(AVLNode* left, AVLNode* middle, AVLNode* right)
+{
+    int leftHeight = _AVLTree_getHeight(left);
+    int rightHeight = _AVLTree_getHeight(right);
+
+    if (leftHeight > rightHeight + 1) {
+        left->right = _AVLTree_join(left->right, middle, right);
+        return _AVLTree_rebalance(left, NULL);
+    }
+    if (rightHeight > leftHeight + 1) {
+        right->left = _AVLTree_join(left, middle, right->left);
+        return _AVLTree_rebalance(right, NULL);
+    }
+
+    middle->left = left;
+    middle->right = right;
+    _AVLTree_updateNode(middle);
+    return middle;
+}
+
+/**
+ * @internal
+ * @brief Detaches the largest node of a non-empty subtree into `maxOut`.
+ */
+static AVLNode* _AVLTree_detachMax(AVLNode* root, AVLNode** maxOut)
+{
+    if (!root->right) {
+        *maxOut = root;
+        return root->left;
+    }
+    root->right = _AVLTree_detachMax(root->right, maxOut);
+    return _AVLTree_rebalance(root, NULL);
+}
+
+/**
+ * @internal
+ * @brief Joins two subtrees where every element of `left` is ordered before every element of `right`.
+ */
+static AVLNode* _AVLTree_join2(AVLNode* left, AVLNode* right)
+{
+    if (!left) return right;
+    AVLNode* middle;
+    left = _AVLTree_detachMax(left, &middle);
+    return _AVLTree_join(left, middle, right);
+}
+
+/**
+ * @internal
+ * @brief Splits a subtree around `key` into the elements ordered before it
+ * (`*leftOut`), an element equal to it (`*matchOut`, detached, or NULL), and
+ * the elements ordered after it (`*rightOut`).
+ */
+static void _AVLTree_split(AVLNode* root, const void* key, int (*cmp)(const void *, const void *),
+    AVLNode** leftOut, AVLNode** matchOut, AVLNode** rightOut)
+{
+    if (!root) {
+        *leftOut = *matchOut = *rightOut = NULL;
+        return;
+    }
+
+    int order = cmp(key, root->data);
+    if (order == 0) {
+        *leftOut = root->left;
+        *rightOut = root->right;
+        *matchOut = root;
+    } else if (order < 0) {
+        AVLNode* rightPart;
+        _AVLTree_split(root->left, key, cmp, leftOut, matchOut, &rightPart);
+        *rightOut = _AVLTree_join(rightPart, root, root->right);
+    } else {
+        AVLNode* leftPart;
+        _AVLTree_split(root->right, key, cmp, &leftPart, matchOut, rightOut);
+        *leftOut = _AVLTree_join(root->left, root, leftPart);
+    }
+}
+
+/**
+ * @internal
+ * @brief Destructive union; on equal elements, the node from `a` is kept.
+ */
+static AVLNode* _AVLTree_union(const AVLTree* avl, AVLNode* a, AVLNode* b)
+{
+    if (!a) return b;
+    if (!b) return a;
+
+    AVLNode *bLeft, *bMatch, *bRight;
+    _AVLTree_split(b, a->data, avl->cmp, &bLeft, &bMatch, &bRight);
+    if (bMatch) _AVLTree_freeNode(avl, bMatch);
+
+    AVLNode* left = _AVLTree_union(avl, a->left, bLeft);
+    AVLNode* right = _AVLTree_union(avl, a->right, bRight);
+    return _AVLTree_join(left, a, right);
+}
+
+/**
+ * @internal
+ * @brief Destructive intersection; the nodes from `a` are kept, all others freed.
+ */
+static AVLNode* _AVLTree_intersection(const AVLTree* avl, AVLNode* a, AVLNode* b)
+{
+    if (!a || !b) {
+        _AVLTree_destroyNode(avl, a);
+        _AVLTree_destroyNode(avl, b);
+        return NULL;
+    }
+
+    AVLNode *bLeft, *bMatch, *bRight;
+    _AVLTree_split(b, a->data, avl->cmp, &bLeft, &bMatch, &bRight);
+
+    AVLNode* aLeft = a->left;
+    AVLNode* aRight = a->right;
+    AVLNode* left = _AVLTree_intersection(avl, aLeft, bLeft);
+    AVLNode* right = _AVLTree_intersection(avl, aRight, bRight);
+
+    if (bMatch) {
+        _AVLTree_freeNode(avl, bMatch);
+        return _AVLTree_join(left, a, right);
+    }
+    _AVLTree_freeNode(avl, a);
+    return _AVLTree_join2(left, right);
+}
+
+/**
+ * @internal
+ * @brief Destructive difference `a - b`; every node of `b` and every removed node of `a` is freed.
+ */
+static AVLNode* _AVLTree_difference(const AVLTree* avl, AVLNode* a, AVLNode* b)
+{
+    if (!a || !b) {
+        _AVLTree_destroyNode(avl, b);
+        return a;
+    }
+
+    AVLNode *aLeft, *aMatch, *aRight;
+    _AVLTree_split(a, b->data, avl->cmp, &aLeft, &aMatch, &aRight);
+    if (aMatch) _AVLTree_freeNode(avl, aMatch);
+
+    AVLNode* bLeft = b->left;
+    AVLNode* bRight = b->right;
+    _AVLTree_freeNode(avl, b);
+
+    AVLNode* left = _AVLTree_difference(avl, aLeft, bLeft);
+    AVLNode* right = _AVLTree_difference(avl, aRight, bRight);
+    return _AVLTree_join2(left, right);
+}
+
+/**
+ * @internal
+ * @brief Checks whether the nodes of `src` may be moved into `dst`.
+ * @details Both trees must order and size elements identically. Pooled nodes
+ * belong to their tree's private pool, and other nodes to their tree's
+ * allocator, so they cannot change owners.
+ */
+static bool _AVLTree_canRelink(const AVLTree* dst, const AVLTree* src)
+{
+    return dst != src && dst->dataSize == src->dataSize && dst->cmp == src->cmp && !dst->pool && !src->pool &&
+        _Dsa_sameAllocator(&dst->allocator, &src->allocator);
+}
+
+STATUS AVLTree_split(AVLTree* avl, const void* key, AVLTree** rightOut)
+{
+    if (!avl || !key || !rightOut || avl->pool) return STATUS_ERR_INVALID_ARGUMENT;
+
+    AVLTree* right = AVLTree_initWithAllocator(avl->dataSize, avl->cmp, &avl->allocator);
+    if (!right) return STATUS_ERR_ALLOC;
+    right->maxTombstoneRatio = avl->maxTombstoneRatio;
+
+    // The set operations relink whole subtrees, so they work on trees without tombstones.
+    _AVLTree_purge(avl);
+    AVLNode *leftPart, *match, *rightPart;
+    _AVLTree_split(avl->root, key, avl->cmp, &leftPart, &match, &rightPart);
+
+    // An element equal to the key is the smallest element of the right part.
+    avl->root = leftPart;
+    right->root = match ? _AVLTree_join(NULL, match, rightPart) : rightPart;
+    *rightOut = right;
     return STATUS_OK;
-}
\ No newline at end of file
+}
+
+STATUS AVLTree_join(AVLTree* left, AVLTree* right)
+{
+    if (!left || !right || !_AVLTree_canRelink(left, right)) return STATUS_ERR_INVALID_ARGUMENT;
+    _AVLTree_purge(left);
+    _AVLTree_purge(right);
+    if (!right->root) return STATUS_OK;
+
+    if (left->root) {
+        // Every element of `left` must be ordered before every element of `right`.
+        AVLNode* max = left->root;
+        while (max->right) max = max->right;
+        AVLNode* min = right->root;
+        while (min->left) min = min->left;
+        if (left->cmp(max->data, min->data) >= 0) return STATUS_ERR_INVALID_ARGUMENT;
+    }
+
+    left->root = _AVLTree_join2(left->root, right->root);
+    right->root = NULL;
+    return STATUS_OK;
+}
+
+STATUS AVLTree_union(AVLTree* dst, AVLTree* src)
+{
+    if (!dst || !src || !_AVLTree_canRelink(dst, src)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    _AVLTree_purge(dst);
+    _AVLTree_purge(src);
+    dst->root = _AVLTree_union(dst, dst->root, src->root);
+    src->root = NULL;
+    return STATUS_OK;
+}
+
+STATUS AVLTree_intersection(AVLTree* dst, AVLTree* src)
+{
+    if (!dst || !src || !_AVLTree_canRelink(dst, src)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    _AVLTree_purge(dst);
+    _AVLTree_purge(src);
+    dst->root = _AVLTree_intersection(dst, dst->root, src->root);
+    src->root = NULL;
+    return STATUS_OK;
+}
+
+STATUS AVLTree_difference(AVLTree* dst, AVLTree* src)
+{
+    if (!dst || !src || !_AVLTree_canRelink(dst, src)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    _AVLTree_purge(dst);
+    _AVLTree_purge(src);
+    dst->root = _AVLTree_difference(dst, dst->root, src->root);
+    src->root = NULL;
+    return STATUS_OK;
+}
+
+/* -----------------------------------------Batch & Lazy Deletion----------------------------------------- */
+
+/**
+ * @internal
+ * @brief `AVLTree_deleteMany` rebuilds the whole tree for batches of at least 1/this of its nodes.
+ * @details Below that, splitting and joining around each key touches fewer nodes.
+ */
+#define AVLTREE_REBUILD_FRACTION 8
+
+/**
+ * @internal
+ * @brief Removes from the subtree every element equal to one of `count` keys in non-decreasing order.
+ * @details The keys act as the second tree of `_AVLTree_difference`: the
+ * subtree is split around the median key, each half is handled with the keys
+ * on its side, and the halves are joined back together. This costs
+ * O(k log(n/k + 1)) for k keys, without allocating. Tombstones that match are
+ * freed too, but not counted in `*deleted`.
+ */
+static AVLNode* _AVLTree_deleteSorted(AVLTree* avl, AVLNode* root, const char* keys, size_t count, size_t* deleted)
+{
+    if (!root || count == 0) return root;
+
+    size_t mid = count / 2;
+    const char* key = keys + mid * avl->dataSize;
+    AVLNode *left, *match, *right;
+    _AVLTree_split(root, key, avl->cmp, &left, &match, &right);
+
+    // Duplicates of the median among the lower keys find nothing, since it is no longer in `left`.
+    left = _AVLTree_deleteSorted(avl, left, keys, mid, deleted);
+    right = _AVLTree_deleteSorted(avl, right, key + avl->dataSize, count - mid - 1, deleted);
+    if (match) {
+        if (match->dead) avl->tombstones--;
+        else (*deleted)++;
+        _AVLTree_freeNode(avl, match);
+    }
+    return _AVLTree_join2(left, right);
+}
+
+STATUS AVLTree_deleteMany(AVLTree* avl, const void* keys, size_t count, size_t* deletedOut)
+{
+    DSA_TRACE("AVLTree", "deleteMany", avl);
+    if (!avl || (!keys && count > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t deleted = 0;
+    if (deletedOut) *deletedOut = 0;
+    if (count == 0 || !avl->root) return STATUS_OK;
+
+    // Keys given in order are used in place; others are sorted into a copy.
+    const char* sorted = keys;
+    char* copy = NULL;
+    if (count > SIZE_MAX / avl->dataSize) return STATUS_ERR_OVERFLOW;
+    size_t bytes = count * avl->dataSize;
+    for (size_t i = 1; i < count; i++) {
+        if (avl->cmp(sorted + (i - 1) * avl->dataSize, sorted + i * avl->dataSize) > 0) {
+            if (!(copy = _Dsa_alloc(&avl->allocator, bytes))) return STATUS_ERR_ALLOC;
+            memcpy(copy, keys, bytes);
+            qsort(copy, count, avl->dataSize, avl->cmp);
+            sorted = copy;
+            break;
+        }
+    }
+
+    // Batches of a sizeable share of the tree are cheaper to merge against the whole tree.
+    size_t nodes = avl->root->size + avl->tombstones;
+    if (count >= nodes / AVLTREE_REBUILD_FRACTION) _AVLTree_rebuild(avl, sorted, count, &deleted);
+    else avl->root = _AVLTree_deleteSorted(avl, avl->root, sorted, count, &deleted);
+    if (copy) _Dsa_free(&avl->allocator, copy, bytes);
+    if (deletedOut) *deletedOut = deleted;
+    return STATUS_OK;
+}
+
+STATUS AVLTree_setLazyDelete(AVLTree* avl, double maxTombstoneRatio)
+{
+    if (!avl || !(maxTombstoneRatio >= 0.0 && maxTombstoneRatio < 1.0)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    avl->maxTombstoneRatio = maxTombstoneRatio;
+    if (maxTombstoneRatio == 0.0) _AVLTree_purge(avl);
+    return STATUS_OK;
+}
+
+STATUS AVLTree_compact(AVLTree* avl)
+{
+    if (!avl) return STATUS_ERR_INVALID_ARGUMENT;
+    _AVLTree_purge(avl);
+    return STATUS_OK;
+}
+
+/* ---------------------------------------------Instrumentation--------------------------------------------- */
+
+STATUS AVLTree_getStats(const AVLTree* avl, DsaStats* statsOut)
+{
+    if (!avl || !statsOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    DSA_STATS_COPY(statsOut, avl);
+    return STATUS_OK;
+}
+
+/* ------------------------------------------------Snapshots------------------------------------------------ */
+
+/** @internal Bytes of elements gathered before each write while saving a tree. */
+#define AVLTREE_SNAPSHOT_BUFFER (64 * 1024)
+
+STATUS AVLTree_save(const AVLTree* avl, int fd)
+{
+    if (!avl || fd < 0) return STATUS_ERR_INVALID_ARGUMENT;
+
+    SnapshotInfo info = { SNAPSHOT_AVLTREE, 0, avl->dataSize, AVLTree_size(avl) };
+    STATUS status = _Snapshot_writeHeader(fd, &info);
+    if (status != STATUS_OK || info.count == 0) return status;
+
+    // Gather the in-order walk into whole elements so most writes are large.
+    size_t perBuffer = AVLTREE_SNAPSHOT_BUFFER / avl->dataSize;
+    if (perBuffer == 0) perBuffer = 1;
+    char* buffer = malloc(perBuffer * avl->dataSize);
+    if (!buffer) return STATUS_ERR_ALLOC;
+
+    AVLTreeIterator it;
+    size_t filled = 0;
+    for (void* e = AVLTreeIterator_begin(&it, avl); e && status == STATUS_OK; e = AVLTreeIterator_next(&it)) {
+        memcpy(buffer + filled * avl->dataSize, e, avl->dataSize);
+        if (++filled == perBuffer) {
+            status = _Snapshot_write(fd, buffer, filled * avl->dataSize);
+            filled = 0;
+        }
+    }
+    if (status == STATUS_OK && filled > 0) status = _Snapshot_write(fd, buffer, filled * avl->dataSize);
+
+    free(buffer);
+    return status;
+}
+
+AVLTree* AVLTree_load(int fd, int (*cmp)(const void *, const void *))
+{
+    SnapshotInfo info;
+    if (fd < 0 || !cmp || _Snapshot_readHeader(fd, &info) != STATUS_OK || info.kind != SNAPSHOT_AVLTREE)
+        return NULL;
+
+    size_t bytes = (size_t)(info.count * info.dataSize);
+    char* data = NULL;
+    if (bytes > 0) {
+        data = malloc(bytes);
+        if (!data) return NULL;
+        if (_Snapshot_read(fd, data, bytes) != STATUS_OK) {
+            free(data);
+            return NULL;
+        }
+    }
+
+    // Saved in order, so the tree is rebuilt balanced in O(n) without rotations.
+    AVLTree* avl = AVLTree_buildFromSorted(data, (size_t)info.count, (size_t)info.dataSize, cmp);
+    free(data);
+    return avl;
+}
@@ -0,0 +1,566 @@
+#include "../include/btree.h"
+#include "allocator_internal.h"
+
+/**
+ * @internal
+ * @brief Target size in bytes of a node, including one spare slot for overflow.
+ * Four cache lines keep the binary search within a node short while still
+ * giving a fan-out of dozens for small keys.
+ */
+#define BTREE_NODE_BYTES 256
+
+/**
+ * @internal
+ * @brief The smallest number of elements a node can hold, whatever the element size.
+ */
+#define BTREE_MIN_CAPACITY 4
+
+/**
+ * @internal
+ * @brief An upper bound on the number of levels.
+ * Every internal node other than the root has at least
+ * BTREE_MIN_CAPACITY / 2 + 1 = 3 children, so 64 levels exceed any address space.
+ */
+#define BTREE_MAX_DEPTH 64
+
+/**
+ * @internal
+ * @struct BTreeNode
+ * @brief Defines the structure of a single leaf or internal node.
+ * @details A leaf's payload is `leafCapacity + 1` elements. An internal node's
+ * payload is `internalCapacity + 2` child pointers followed by
+ * `internalCapacity + 1` separator elements, where separator `i` is no larger
+ * than any element under child `i + 1` and larger than every element under
+ * child `i`. The extra slot lets a node overflow by one before it is split.
+ */
+typedef struct BTreeNode
+{
+    struct BTreeNode* next; // Leaves only: the next leaf in key order.
+    struct BTreeNode* prev; // Leaves only: the previous leaf in key order.
+    uint32_t count;         // Number of elements (leaf) or separators (internal node).
+    uint32_t isLeaf;        // Non-zero for leaf nodes.
+    unsigned char payload[];
+} BTreeNode;
+
+/**
+ * @internal
+ * @struct BTree
+ * @brief Defines the internal structure of the B+ tree.
+ */
+struct BTree
+{
+    BTreeNode* root;                            // The root node; an empty leaf when the tree is empty.
+    size_t dataSize;                            // The size in bytes of each element.
+    int (*cmp)(const void *, const void *);     // Function to compare two elements.
+    size_t size;                                // The number of elements in the tree.
+    size_t leafCapacity;                        // Maximum number of elements in a leaf.
+    size_t internalCapacity;                    // Maximum number of separators in an internal node.
+    DsaAllocator allocator;                     // Where the struct and its nodes are allocated.
+};
+
+/* ------------------------------------------Private Node Helpers------------------------------------------ */
+
+/**
+ * @internal
+ * @brief Returns the child pointer array of an internal node.
+ */
+static BTreeNode** _BTree_children(BTreeNode* node)
+{
+    return (BTreeNode**)node->payload;
+}
+
+/**
+ * @internal
+ * @brief Returns a pointer to the `i`-th element or separator of a node.
+ */
+static unsigned char* _BTree_key(const BTree* tree, BTreeNode* node, size_t i)
+{
+    if (node->isLeaf) return node->payload + i * tree->dataSize;
+    return node->payload + (tree->internalCapacity + 2) * sizeof(BTreeNode*) + i * tree->dataSize;
+}
+
+/**
+ * @internal
+ * @brief Returns the allocation size of a leaf or internal node.
+ */
+static size_t _BTree_nodeBytes(const BTree* tree, bool isLeaf)
+{
+    size_t payload = isLeaf
+        ? (tree->leafCapacity + 1) * tree->dataSize
+        : (tree->internalCapacity + 2) * sizeof(BTreeNode*) + (tree->internalCapacity + 1) * tree->dataSize;
+    return sizeof(BTreeNode) + payload;
+}
+
+/**
+ * @internal
+ * @brief Allocates an empty leaf or internal node.
+ */
+static BTreeNode* _BTree_newNode(const BTree* tree, bool isLeaf)
+{
+    BTreeNode* node = _Dsa_alloc(&tree->allocator, _BTree_nodeBytes(tree, isLeaf));
+    if (!node) return NULL;
+
+    node->next = NULL;
+    node->prev = NULL;
+    node->count = 0;
+    node->isLeaf = isLeaf;
+    return node;
+}
+
+/**
+ * @internal
+ * @brief Releases a node back to the tree's allocator.
+ */
+static void _BTree_freeNode(const BTree* tree, BTreeNode* node)
+{
+    _Dsa_free(&tree->allocator, node, _BTree_nodeBytes(tree, node->isLeaf));
+}
+
+/**
+ * @internal
+ * @brief Frees a node and all its descendants. Recursion depth is the tree height, O(log_B n).
+ */
+static void _BTree_destroyNode(const BTree* tree, BTreeNode* node)
+{
+    if (!node->isLeaf) {
+        BTreeNode** children = _BTree_children(node);
+        for (size_t i = 0; i <= node->count; i++)
+            _BTree_destroyNode(tree, children[i]);
+    }
+    _BTree_freeNode(tree, node);
+}
+
+/**
+ * @internal
+ * @brief Binary search for the first position whose key is not ordered before `key`.
+ * @param found Set to whether the key at that position equals `key`.
+ */
+static size_t _BTree_lowerIndex(const BTree* tree, BTreeNode* node, const void* key, bool* found)
+{
+    size_t lo = 0, hi = node->count;
+    *found = false;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int order = tree->cmp(_BTree_key(tree, node, mid), key);
+        if (order < 0) {
+            lo = mid + 1;
+        } else {
+            if (order == 0) *found = true;
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @internal
+ * @brief Returns the index of the child of an internal node whose subtree may contain `key`.
+ * @details That is the number of separators not ordered after `key`.
+ */
+static size_t _BTree_childIndex(const BTree* tree, BTreeNode* node, const void* key)
+{
+    size_t lo = 0, hi = node->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (tree->cmp(_BTree_key(tree, node, mid), key) <= 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @internal
+ * @brief Opens a gap of one key (and, for internal nodes, one child after it) at position `i`.
+ */
+static void _BTree_shiftRight(const BTree* tree, BTreeNode* node, size_t i)
+{
+    memmove(_BTree_key(tree, node, i + 1), _BTree_key(tree, node, i), (node->count - i) * tree->dataSize);
+    if (!node->isLeaf) {
+        BTreeNode** children = _BTree_children(node);
+        memmove(&children[i + 2], &children[i + 1], (node->count - i) * sizeof(BTreeNode*));
+    }
+}
+
+/**
+ * @internal
+ * @brief Closes the gap left by removing key `i` (and, for internal nodes, child `i + 1`).
+ */
+static void _BTree_shiftLeft(const BTree* tree, BTreeNode* node, size_t i)
+{
+    memmove(_BTree_key(tree, node, i), _BTree_key(tree, node, i + 1), (node->count - i - 1) * tree->dataSize);
+    if (!node->isLeaf) {
+        BTreeNode** children = _BTree_children(node);
+        memmove(&children[i + 1], &children[i + 2], (node->count - i - 1) * sizeof(BTreeNode*));
+    }
+}
+
+/**
+ * @internal
+ * @brief Returns the fewest keys a non-root node of the given kind may hold.
+ */
+static size_t _BTree_minimum(const BTree* tree, const BTreeNode* node)
+{
+    return (node->isLeaf ? tree->leafCapacity : tree->internalCapacity) / 2;
+}
+
+/* --------------------------------------Creation & Destruction-------------------------------------- */
+
+BTree* BTree_init(size_t dataSize, int (*cmp)(const void *, const void *))
+{
+    return BTree_initWithAllocator(dataSize, cmp, NULL);
+}
+
+BTree* BTree_initWithAllocator(size_t dataSize, int (*cmp)(const void *, const void *), const DsaAllocator* allocator)
+{
+    allocator = _Dsa_resolve(allocator);
+    if (!allocator || !cmp || dataSize == 0 || dataSize > (SIZE_MAX - BTREE_NODE_BYTES) / (BTREE_MIN_CAPACITY + 1))
+        return NULL;
+
+    BTree* tree = _Dsa_alloc(allocator, sizeof(BTree));
+    if (!tree) return NULL;
+
+    const size_t room = BTREE_NODE_BYTES - sizeof(BTreeNode);
+    size_t leafCapacity = room / dataSize;
+    size_t internalCapacity = (room - sizeof(BTreeNode*)) / (dataSize + sizeof(BTreeNode*));
+    // One slot of each node is reserved for overflow.
+    tree->leafCapacity = leafCapacity > BTREE_MIN_CAPACITY ? leafCapacity - 1 : BTREE_MIN_CAPACITY;
+    tree->internalCapacity = internalCapacity > BTREE_MIN_CAPACITY ? internalCapacity - 1 : BTREE_MIN_CAPACITY;
+    tree->dataSize = dataSize;
+    tree->cmp = cmp;
+    tree->size = 0;
+    tree->allocator = *allocator;
+
+    tree->root = _BTree_newNode(tree, true);
+    if (!tree->root) {
+        _Dsa_free(allocator, tree, sizeof(BTree));
+        return NULL;
+    }
+    return tree;
+}
+
+void BTree_destroy(BTree* tree)
+{
+    if (!tree) return;
+
+    // A bulk allocator reclaims the nodes itself; there is nothing to walk.
+    DsaAllocator allocator = tree->allocator;
+    if (_Dsa_freesIndividually(&allocator))
+        _BTree_destroyNode(tree, tree->root);
+    _Dsa_free(&allocator, tree, sizeof(BTree));
+}
+
+/* -------------------------------------------Insertion------------------------------------------- */
+
+STATUS BTree_insert(BTree* tree, const void* element)
+{
+    if (!tree || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    BTreeNode* path[BTREE_MAX_DEPTH];
+    size_t slot[BTREE_MAX_DEPTH];
+    size_t depth = 0;
+
+    BTreeNode* node = tree->root;
+    while (!node->isLeaf) {
+        size_t i = _BTree_childIndex(tree, node, element);
+        path[depth] = node;
+        slot[depth++] = i;
+        node = _BTree_children(node)[i];
+    }
+
+    bool found;
+    size_t index = _BTree_lowerIndex(tree, node, element, &found);
+    if (found) return STATUS_ERR_DUPLICATE_KEY;
+
+    // Allocate every node the splits will need up front, so a failure leaves the tree untouched.
+    BTreeNode* spare[BTREE_MAX_DEPTH + 1];
+    size_t needed = 0;
+    if (node->count == tree->leafCapacity) {
+        needed = 1;
+        size_t d = depth;
+        while (d > 0 && path[d - 1]->count == tree->internalCapacity) {
+            needed++;
+            d--;
+        }
+        if (d == 0) needed++; // The root splits too.
+    }
+    for (size_t s = 0; s < needed; s++) {
+        spare[s] = _BTree_newNode(tree, s == 0);
+        if (!spare[s]) {
+            while (s > 0) _BTree_freeNode(tree, spare[--s]);
+            return STATUS_ERR_ALLOC;
+        }
+    }
+
+    _BTree_shiftRight(tree, node, index);
+    memcpy(_BTree_key(tree, node, index), element, tree->dataSize);
+    node->count++;
+    tree->size++;
+    if (needed == 0) return STATUS_OK;
+
+    // Split the leaf; its right half's first element becomes the separator.
+    size_t used = 0;
+    BTreeNode* right = spare[used++];
+    size_t moved = node->count / 2;
+    memcpy(_BTree_key(tree, right, 0), _BTree_key(tree, node, node->count - moved), moved * tree->dataSize);
+    right->count = moved;
+    node->count -= moved;
+    right->next = node->next;
+    right->prev = node;
+    if (node->next) node->next->prev = right;
+    node->next = right;
+    const unsigned char* separator = _BTree_key(tree, right, 0);
+
+    // Push separators up while parents overflow.
+    while (depth > 0) {
+        BTreeNode* parent = path[--depth];
+        size_t i = slot[depth];
+        _BTree_shiftRight(tree, parent, i);
+        memcpy(_BTree_key(tree, parent, i), separator, tree->dataSize);
+        _BTree_children(parent)[i + 1] = right;
+        parent->count++;
+        if (parent->count <= tree->internalCapacity) return STATUS_OK;
+
+        // The middle separator moves up; the keys and children after it move right.
+        BTreeNode* sibling = spare[used++];
+        size_t middle = parent->count / 2;
+        sibling->count = parent->count - middle - 1;
+        memcpy(_BTree_key(tree, sibling, 0), _BTree_key(tree, parent, middle + 1), sibling->count * tree->dataSize);
+        memcpy(_BTree_children(sibling), &_BTree_children(parent)[middle + 1], (sibling->count + 1) * sizeof(BTreeNode*));
+        parent->count = middle;
+
+        node = parent;
+        right = sibling;
+        separator = _BTree_key(tree, parent, middle);
+    }
+
+    // The root itself split; grow a level.
+    BTreeNode* root = spare[used];
+    memcpy(_BTree_key(tree, root, 0), separator, tree->dataSize);
+    _BTree_children(root)[0] = node;
+    _BTree_children(root)[1] = right;
+    root->count = 1;
+    tree->root = root;
+    return STATUS_OK;
+}
+
+/* --------------------------------------------Deletion-------------------------------------------- */
+
+/**
+ * @internal
+ * @brief Merges child `i + 1` of `parent` into child `i`, dropping separator `i`.
+ */
+static void _BTree_merge(BTree* tree, BTreeNode* parent, size_t i)
+{
+    BTreeNode** children = _BTree_children(parent);
+    BTreeNode* left = children[i];
+    BTreeNode* right = children[i + 1];
+
+    if (left->isLeaf) {
+        memcpy(_BTree_key(tree, left, left->count), _BTree_key(tree, right, 0), right->count * tree->dataSize);
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next) right->next->prev = left;
+    } else {
+        // The separator comes down between the two halves.
+        memcpy(_BTree_key(tree, left, left->count), _BTree_key(tree, parent, i), tree->dataSize);
+        memcpy(_BTree_key(tree, left, left->count + 1), _BTree_key(tree, right, 0), right->count * tree->dataSize);
+        memcpy(&_BTree_children(left)[left->count + 1], _BTree_children(right), (right->count + 1) * sizeof(BTreeNode*));
+        left->count += 1 + right->count;
+    }
+    _BTree_freeNode(tree, right);
+
+    _BTree_shiftLeft(tree, parent, i);
+    parent->count--;
+}
+
+/**
+ * @internal
+ * @brief Restores the minimum fill of child `i` of `parent` by borrowing from
+ * a sibling that can spare a key, or merging with one that cannot.
+ */
+static void _BTree_rebalance(BTree* tree, BTreeNode* parent, size_t i)
+{
+    BTreeNode** children = _BTree_children(parent);
+    BTreeNode* node = children[i];
+    BTreeNode* left = i > 0 ? children[i - 1] : NULL;
+    BTreeNode* right = i < parent->count ? children[i + 1] : NULL;
+    size_t minimum = _BTree_minimum(tree, node);
+
+    if (left && left->count > minimum) {
+        // Rotate the largest key of the left sibling through the parent.
+        _BTree_shiftRight(tree, node, 0);
+        if (node->isLeaf) {
+            memcpy(_BTree_key(tree, node, 0), _BTree_key(tree, left, left->count - 1), tree->dataSize);
+            memcpy(_BTree_key(tree, parent, i - 1), _BTree_key(tree, node, 0), tree->dataSize);
+        } else {
+            BTreeNode** nodeChildren = _BTree_children(node);
+            nodeChildren[1] = nodeChildren[0];
+            nodeChildren[0] = _BTree_children(left)[left->count];
+            memcpy(_BTree_key(tree, node, 0), _BTree_key(tree, parent, i - 1), tree->dataSize);
+            memcpy(_BTree_key(tree, parent, i - 1), _BTree_key(tree, left, left->count - 1), tree->dataSize);
+        }
+        left->count--;
+        node->count++;
+    } else if (right && right->count > minimum) {
+        // Rotate the smallest key of the right sibling through the parent.
+        if (node->isLeaf) {
+            memcpy(_BTree_key(tree, node, node->count), _BTree_key(tree, right, 0), tree->dataSize);
+            memmove(_BTree_key(tree, right, 0), _BTree_key(tree, right, 1), (right->count - 1) * tree->dataSize);
+            memcpy(_BTree_key(tree, parent, i), _BTree_key(tree, right, 0), tree->dataSize);
+        } else {
+            BTreeNode** rightChildren = _BTree_children(right);
+            memcpy(_BTree_key(tree, node, node->count), _BTree_key(tree, parent, i), tree->dataSize);
+            _BTree_children(node)[node->count + 1] = rightChildren[0];
+            memcpy(_BTree_key(tree, parent, i), _BTree_key(tree, right, 0), tree->dataSize);
+            memmove(_BTree_key(tree, right, 0), _BTree_key(tree, right, 1), (right->count - 1) * tree->dataSize);
+            memmove(&rightChildren[0], &rightChildren[1], right->count * sizeof(BTreeNode*));
+        }
+        right->count--;
+        node->count++;
+    } else if (left) {
+        _BTree_merge(tree, parent, i - 1);
+    } else {
+        _BTree_merge(tree, parent, i);
+    }
+}
+
+STATUS BTree_delete(BTree* tree, const void* key)
+{
+    if (!tree || !key) return STATUS_ERR_INVALID_ARGUMENT;
+
+    BTreeNode* path[BTREE_MAX_DEPTH];
+    size_t slot[BTREE_MAX_DEPTH];
+    size_t depth = 0;
+
+    BTreeNode* node = tree->root;
+    while (!node->isLeaf) {
+        size_t i = _BTree_childIndex(tree, node, key);
+        path[depth] = node;
+        slot[depth++] = i;
+        node = _BTree_children(node)[i];
+    }
+
+    bool found;
+    size_t index = _BTree_lowerIndex(tree, node, key, &found);
+    if (!found) return STATUS_ERR_KEY_NOT_FOUND;
+
+    // Separators equal to the removed key may remain above; they still order the subtrees correctly.
+    _BTree_shiftLeft(tree, node, index);
+    node->count--;
+    tree->size--;
+
+    while (depth > 0 && node->count < _BTree_minimum(tree, node)) {
+        node = path[--depth];
+        _BTree_rebalance(tree, node, slot[depth]);
+    }
+
+    // A root left without separators hands over to its only child.
+    BTreeNode* root = tree->root;
+    if (!root->isLeaf && root->count == 0) {
+        tree->root = _BTree_children(root)[0];
+        _BTree_freeNode(tree, root);
+    }
+    return STATUS_OK;
+}
+
+/* ---------------------------------------------Queries--------------------------------------------- */
+
+/**
+ * @internal
+ * @brief Descends to the leaf whose range covers `key`.
+ */
+static BTreeNode* _BTree_findLeaf(const BTree* tree, const void* key)
+{
+    BTreeNode* node = tree->root;
+    while (!node->isLeaf)
+        node = _BTree_children(node)[_BTree_childIndex(tree, node, key)];
+    return node;
+}
+
+void* BTree_search(const BTree* tree, const void* key)
+{
+    if (!tree || !key) return NULL;
+
+    BTreeNode* leaf = _BTree_findLeaf(tree, key);
+    bool found;
+    size_t index = _BTree_lowerIndex(tree, leaf, key, &found);
+    return found ? _BTree_key(tree, leaf, index) : NULL;
+}
+
+size_t BTree_size(const BTree* tree)
+{
+    return tree ? tree->size : 0;
+}
+
+void* BTree_lowerBound(const BTree* tree, const void* key)
+{
+    BTreeIterator it;
+    return BTreeIterator_seek(&it, tree, key);
+}
+
+STATUS BTree_visitRange(const BTree* tree, const void* lo, const void* hi,
+    bool (*visit)(void* element, void* ctx), void* ctx)
+{
+    if (!tree || !visit) return STATUS_ERR_INVALID_ARGUMENT;
+
+    BTreeIterator it;
+    void* element = lo ? BTreeIterator_seek(&it, tree, lo) : BTreeIterator_begin(&it, tree);
+    while (element && (!hi || tree->cmp(element, hi) <= 0)) {
+        if (!visit(element, ctx)) break;
+        element = BTreeIterator_next(&it);
+    }
+    return STATUS_OK;
+}
+
+/* ------------------------------------------------Iterators------------------------------------------------ */
+
+void* BTreeIterator_begin(BTreeIterator* it, const BTree* tree)
+{
+    if (!it) return NULL;
+    it->leaf = NULL;
+    if (!tree) return NULL;
+
+    BTreeNode* node = tree->root;
+    while (!node->isLeaf)
+        node = _BTree_children(node)[0];
+
+    it->leaf = node->count ? node : NULL;
+    it->index = 0;
+    it->dataSize = tree->dataSize;
+    return BTreeIterator_get(it);
+}
+
+void* BTreeIterator_seek(BTreeIterator* it, const BTree* tree, const void* key)
+{
+    if (!it) return NULL;
+    it->leaf = NULL;
+    if (!tree || !key) return NULL;
+
+    BTreeNode* leaf = _BTree_findLeaf(tree, key);
+    bool found;
+    it->leaf = leaf;
+    it->index = _BTree_lowerIndex(tree, leaf, key, &found);
+    it->dataSize = tree->dataSize;
+    if (it->index == leaf->count) {
+        // Every element here is smaller; the answer starts the next leaf.
+        it->leaf = leaf->next;
+        it->index = 0;
+    }
+    return BTreeIterator_get(it);
+}
+
+void* BTreeIterator_get(const BTreeIterator* it)
+{
+    if (!it || !it->leaf) return NULL;
+    return it->leaf->payload + it->index * it->dataSize;
+}
+
+void* BTreeIterator_next(BTreeIterator* it)
+{
+    if (!it || !it->leaf) return NULL;
+    if (++it->index == it->leaf->count) {
+        it->leaf = it->leaf->next;
+        it->index = 0;
+    }
+    return BTreeIterator_get(it);
+}
@@ -0,0 +1,284 @@
+#include "../include/concurrentqueue.h"
+#include <stdatomic.h>
+
+/** @internal Constants */
+
+/**
+ * @brief The assumed size of a cache line. Producer-owned and consumer-owned
+ * indices are kept on separate lines so they do not false-share.
+ */
+#define CQ_CACHE_LINE 64
+
+/**
+ * @internal
+ * @struct SPSCQueue
+ * @brief Defines the internal structure of the single-producer/single-consumer queue.
+ * @details `head` and `tail` are free-running counters; a slot index is obtained
+ * by masking. Each side keeps a private cached copy of the other side's counter
+ * and only reloads it (with acquire) when the cached value says full/empty.
+ */
+struct SPSCQueue {
+    _Alignas(CQ_CACHE_LINE) atomic_size_t head;   // Next position to read. Written by the consumer.
+    size_t cachedTail;                            // Consumer's last observed value of `tail`.
+    _Alignas(CQ_CACHE_LINE) atomic_size_t tail;   // Next position to write. Written by the producer.
+    size_t cachedHead;                            // Producer's last observed value of `head`.
+    _Alignas(CQ_CACHE_LINE) char* data;           // Ring buffer of `capacity * dataSize` bytes.
+    size_t dataSize;                              // The size in bytes of a single element.
+    size_t mask;                                  // `capacity - 1`.
+};
+
+/**
+ * @internal
+ * @struct MPMCQueue
+ * @brief Defines the internal structure of the multi-producer/multi-consumer queue.
+ * @details Every slot has a sequence number. A slot at position `pos` is free for
+ * the producer claiming `pos` when `seq == pos`, and holds data for the consumer
+ * claiming `pos` when `seq == pos + 1`. After consuming, the slot's sequence is
+ * advanced by `capacity` so it becomes free for the next lap.
+ */
+struct MPMCQueue {
+    _Alignas(CQ_CACHE_LINE) atomic_size_t enqueuePos;   // Next position claimed by a producer.
+    _Alignas(CQ_CACHE_LINE) atomic_size_t dequeuePos;   // Next position claimed by a consumer.
+    _Alignas(CQ_CACHE_LINE) atomic_size_t* sequence;    // Per-slot sequence numbers.
+    char* data;                                         // Ring buffer of `capacity * dataSize` bytes.
+    size_t dataSize;                                    // The size in bytes of a single element.
+    size_t mask;                                        // `capacity - 1`.
+};
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+/**
+ * @internal
+ * @brief Rounds `n` up to the next power of two.
+ * @return The rounded value, or 0 if it cannot be represented.
+ */
+static size_t _ConcurrentQueue_roundUpPow2(size_t n)
+{
+    size_t pow2 = 1;
+    while (pow2 < n) {
+        if (pow2 > SIZE_MAX / 2) return 0;
+        pow2 <<= 1;
+    }
+    return pow2;
+}
+
+/**
+ * @internal
+ * @brief Allocates a zeroed, cache-line aligned block for a queue struct.
+ */
+static void* _ConcurrentQueue_allocStruct(size_t size)
+{
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    size_t rounded = (size + CQ_CACHE_LINE - 1) & ~(size_t)(CQ_CACHE_LINE - 1);
+    void* block = aligned_alloc(CQ_CACHE_LINE, rounded);
+    if (block) memset(block, 0, rounded);
+    return block;
+}
+
+/* ----------------------------------- SPSCQueue ----------------------------------- */
+
+SPSCQueue* SPSCQueue_init(size_t capacity, size_t dataSize)
+{
+    if (capacity == 0 || dataSize == 0) return NULL;
+
+    size_t rounded = _ConcurrentQueue_roundUpPow2(capacity);
+    if (rounded == 0 || rounded > SIZE_MAX / dataSize) return NULL;
+
+    SPSCQueue* queue = _ConcurrentQueue_allocStruct(sizeof(SPSCQueue));
+    if (!queue) return NULL;
+
+    queue->data = malloc(rounded * dataSize);
+    if (!queue->data) {
+        free(queue);
+        return NULL;
+    }
+
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+    queue->dataSize = dataSize;
+    queue->mask = rounded - 1;
+    return queue;
+}
+
+void SPSCQueue_destroy(SPSCQueue* queue)
+{
+    if (!queue) return;
+    free(queue->data);
+    queue->data = NULL;
+    free(queue);
+}
+
+STATUS SPSCQueue_enqueue(SPSCQueue* queue, const void* element)
+{
+    if (!queue || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (tail - queue->cachedHead > queue->mask) {
+        // Looks full from our cached view; refresh it from the consumer.
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->cachedHead > queue->mask) return STATUS_ERR_FULL;
+    }
+
+    memcpy(queue->data + (tail & queue->mask) * queue->dataSize, element, queue->dataSize);
+
+    // Publish the element: the consumer's acquire load of `tail` sees the copy above.
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return STATUS_OK;
+}
+
+STATUS SPSCQueue_dequeue(SPSCQueue* queue, void* elementOut)
+{
+    if (!queue || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (head == queue->cachedTail) {
+        // Looks empty from our cached view; refresh it from the producer.
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->cachedTail) return STATUS_ERR_EMPTY;
+    }
+
+    memcpy(elementOut, queue->data + (head & queue->mask) * queue->dataSize, queue->dataSize);
+
+    // Release the slot back to the producer only after the copy is complete.
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return STATUS_OK;
+}
+
+size_t SPSCQueue_size(SPSCQueue* queue)
+{
+    if (!queue) return 0;
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+size_t SPSCQueue_capacity(const SPSCQueue* queue)
+{
+    if (!queue) return 0;
+    return queue->mask + 1;
+}
+
+/* ----------------------------------- MPMCQueue ----------------------------------- */
+
+MPMCQueue* MPMCQueue_init(size_t capacity, size_t dataSize)
+{
+    if (capacity == 0 || dataSize == 0) return NULL;
+
+    // The sequence scheme needs at least two slots to tell "free" from "full".
+    size_t rounded = _ConcurrentQueue_roundUpPow2(capacity < 2 ? 2 : capacity);
+    if (rounded == 0 || rounded > SIZE_MAX / dataSize || rounded > SIZE_MAX / sizeof(atomic_size_t))
+        return NULL;
+
+    MPMCQueue* queue = _ConcurrentQueue_allocStruct(sizeof(MPMCQueue));
+    if (!queue) return NULL;
+
+    queue->sequence = malloc(rounded * sizeof(atomic_size_t));
+    queue->data = malloc(rounded * dataSize);
+    if (!queue->sequence || !queue->data) {
+        free(queue->sequence);
+        free(queue->data);
+        free(queue);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < rounded; i++)
+        atomic_init(&queue->sequence[i], i);
+
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+    queue->dataSize = dataSize;
+    queue->mask = rounded - 1;
+    return queue;
+}
+
+void MPMCQueue_destroy(MPMCQueue* queue)
+{
+    if (!queue) return;
+    free(queue->sequence);
+    free(queue->data);
+    queue->sequence = NULL;
+    queue->data = NULL;
+    free(queue);
+}
+
+STATUS MPMCQueue_enqueue(MPMCQueue* queue, const void* element)
+{
+    if (!queue || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    size_t slot;
+    for (;;) {
+        slot = pos & queue->mask;
+        size_t seq = atomic_load_explicit(&queue->sequence[slot], memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            // The slot is free for this lap; try to claim the position.
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+            // On failure `pos` has been reloaded with the current value.
+        } else if (diff < 0) {
+            // The slot still holds an element from the previous lap.
+            return STATUS_ERR_FULL;
+        } else {
+            // Another producer claimed this position; catch up.
+            pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(queue->data + slot * queue->dataSize, element, queue->dataSize);
+    atomic_store_explicit(&queue->sequence[slot], pos + 1, memory_order_release);
+    return STATUS_OK;
+}
+
+STATUS MPMCQueue_dequeue(MPMCQueue* queue, void* elementOut)
+{
+    if (!queue || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    size_t slot;
+    for (;;) {
+        slot = pos & queue->mask;
+        size_t seq = atomic_load_explicit(&queue->sequence[slot], memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            // The slot holds data for this position; try to claim it.
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // No producer has filled this position yet.
+            return STATUS_ERR_EMPTY;
+        } else {
+            // Another consumer claimed this position; catch up.
+            pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(elementOut, queue->data + slot * queue->dataSize, queue->dataSize);
+    // Mark the slot free for the producer one lap ahead.
+    atomic_store_explicit(&queue->sequence[slot], pos + queue->mask + 1, memory_order_release);
+    return STATUS_OK;
+}
+
+size_t MPMCQueue_size(MPMCQueue* queue)
+{
+    if (!queue) return 0;
+    size_t dequeuePos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    size_t enqueuePos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    // Positions are claimed before the copy completes, so the difference can
+    // transiently exceed the capacity or wrap; clamp to a sensible range.
+    if (enqueuePos < dequeuePos) return 0;
+    size_t size = enqueuePos - dequeuePos;
+    return size > queue->mask + 1 ? queue->mask + 1 : size;
+}
+
+size_t MPMCQueue_capacity(const MPMCQueue* queue)
+{
+    if (!queue) return 0;
+    return queue->mask + 1;
+}
@@ -0,0 +1,494 @@
+#include "../include/concurrentskiplist.h"
+#include <stdatomic.h>
+#include <sched.h>
+
+/** @internal Constants */
+
+/**
+ * @brief The assumed size of a cache line. Each epoch slot gets its own line.
+ */
+#define CSL_CACHE_LINE 64
+
+/**
+ * @brief The highest node level. With a branching factor of 4 this covers 4^20 elements.
+ */
+#define CSL_MAX_LEVEL 20
+
+/**
+ * @brief The number of operations that can be in progress at once; further
+ * threads wait for a free slot. Override when building the library, e.g.
+ * `-DCSL_MAX_THREADS=256`.
+ */
+#ifndef CSL_MAX_THREADS
+#define CSL_MAX_THREADS 128
+#endif
+
+/**
+ * @brief Nodes a slot retires between attempts to advance the global epoch.
+ */
+#define CSL_ADVANCE_INTERVAL 32
+
+/**
+ * @brief Number of retire lists per slot: one for each epoch that may still be in use.
+ */
+#define CSL_LIMBO_LISTS 3
+
+/**
+ * @internal
+ * @struct CSLNode
+ * @brief A skip list node: a tower of `level` links followed by the element.
+ * @details The low bit of a link marks the node holding it as deleted at that
+ * level; marked links are never changed again. Both the inserting and the
+ * deleting thread hold a reference until they are done linking or unlinking
+ * the node, and whichever drops the last reference retires it.
+ */
+typedef struct CSLNode
+{
+    struct CSLNode* retired;                    // Next node in a slot's retire list.
+    atomic_int refs;                            // Threads still working on the node's links.
+    int level;                                  // Number of links in `next`.
+    _Atomic(uintptr_t) next[];                  // Successor at each level, low bit = marked; the element follows.
+} CSLNode;
+
+/**
+ * @internal
+ * @struct CSLSlot
+ * @brief A participant record for epoch-based reclamation.
+ * @details A thread claims a free slot for the duration of each operation,
+ * announcing the global epoch it started in. The retire lists are only
+ * touched by the slot's current holder.
+ */
+typedef struct CSLSlot
+{
+    _Alignas(CSL_CACHE_LINE) atomic_ulong state;    // 0 if free, otherwise `epoch << 1 | 1`.
+    CSLNode* limbo[CSL_LIMBO_LISTS];                // Retired nodes, by epoch modulo 3.
+    unsigned long limboEpoch[CSL_LIMBO_LISTS];      // The epoch each retire list was filled in.
+    unsigned retiredSinceAdvance;                   // Nodes retired since the last advance attempt.
+} CSLSlot;
+
+/**
+ * @internal
+ * @struct ConcurrentSkipList
+ * @brief Defines the internal structure of the concurrent skip list.
+ * @details A node is retired after it has been unlinked, tagged with the
+ * global epoch `e` read at that point, so any thread still holding it
+ * announced an epoch of at most `e`. The global epoch only advances when every
+ * active slot has announced the current one, so once it reaches `e + 2` no
+ * such thread remains and the node can be freed.
+ */
+struct ConcurrentSkipList
+{
+    _Alignas(CSL_CACHE_LINE) atomic_ulong epoch;    // The global epoch.
+    _Alignas(CSL_CACHE_LINE) atomic_size_t size;    // The number of elements.
+    CSLNode* head;                                  // Sentinel of level CSL_MAX_LEVEL, holding no element.
+    size_t dataSize;                                // The size in bytes of a single element.
+    int (*cmp)(const void*, const void*);
+    CSLSlot* slots;                                 // CSL_MAX_THREADS participant records.
+};
+
+/**
+ * @internal
+ * @brief Per-thread state: the slot last claimed, and the level generator.
+ */
+static _Thread_local size_t _CSL_slotHint = 0;
+static _Thread_local uint64_t _CSL_random = 0;
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+static CSLNode* _CSL_pointer(uintptr_t link)
+{
+    return (CSLNode*)(link & ~(uintptr_t)1);
+}
+
+static bool _CSL_isMarked(uintptr_t link)
+{
+    return (link & 1) != 0;
+}
+
+/**
+ * @internal
+ * @brief Returns the offset of the element within a node of `level` links, maximally aligned.
+ */
+static size_t _CSL_dataOffset(int level)
+{
+    size_t offset = sizeof(CSLNode) + (size_t)level * sizeof(uintptr_t);
+    return (offset + _Alignof(max_align_t) - 1) & ~(size_t)(_Alignof(max_align_t) - 1);
+}
+
+static void* _CSL_data(const CSLNode* node)
+{
+    return (char*)node + _CSL_dataOffset(node->level);
+}
+
+/**
+ * @internal
+ * @brief Draws a node level from a geometric distribution with p = 1/4.
+ */
+static int _CSL_randomLevel(void)
+{
+    if (_CSL_random == 0)
+        _CSL_random = ((uint64_t)(uintptr_t)&_CSL_random * 0x9E3779B97F4A7C15ull) | 1;
+
+    // xorshift64
+    _CSL_random ^= _CSL_random << 13;
+    _CSL_random ^= _CSL_random >> 7;
+    _CSL_random ^= _CSL_random << 17;
+
+    int level = 1;
+    uint64_t bits = _CSL_random;
+    while (level < CSL_MAX_LEVEL && (bits & 3) == 0) {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+static void _CSL_freeChain(CSLNode* node)
+{
+    while (node) {
+        CSLNode* next = node->retired;
+        free(node);
+        node = next;
+    }
+}
+
+/**
+ * @internal
+ * @brief Advances the global epoch if every active slot has announced the current one.
+ */
+static void _CSL_tryAdvance(ConcurrentSkipList* list)
+{
+    unsigned long epoch = atomic_load(&list->epoch);
+    for (size_t i = 0; i < CSL_MAX_THREADS; i++) {
+        unsigned long state = atomic_load(&list->slots[i].state);
+        if ((state & 1) && (state >> 1) != epoch) return;
+    }
+    atomic_compare_exchange_strong(&list->epoch, &epoch, epoch + 1);
+}
+
+/**
+ * @internal
+ * @brief Starts an operation: claims a slot announcing the current epoch, and
+ * frees the slot's retire lists from two or more epochs ago.
+ */
+static CSLSlot* _CSL_enter(ConcurrentSkipList* list)
+{
+    unsigned long epoch = atomic_load(&list->epoch);
+    size_t i = _CSL_slotHint;
+    for (;;) {
+        unsigned long expected = 0;
+        if (atomic_load_explicit(&list->slots[i].state, memory_order_relaxed) == 0
+            && atomic_compare_exchange_strong(&list->slots[i].state, &expected, epoch << 1 | 1))
+            break;
+        if (++i == CSL_MAX_THREADS) {
+            i = 0;
+            sched_yield();
+            epoch = atomic_load(&list->epoch);
+        }
+    }
+    _CSL_slotHint = i;
+
+    CSLSlot* slot = &list->slots[i];
+    for (int b = 0; b < CSL_LIMBO_LISTS; b++) {
+        if (slot->limbo[b] && slot->limboEpoch[b] + 2 <= epoch) {
+            _CSL_freeChain(slot->limbo[b]);
+            slot->limbo[b] = NULL;
+        }
+    }
+    return slot;
+}
+
+/**
+ * @internal
+ * @brief Ends an operation, releasing its slot.
+ */
+static void _CSL_leave(CSLSlot* slot)
+{
+    atomic_store(&slot->state, 0);
+}
+
+/**
+ * @internal
+ * @brief Schedules an unlinked node to be freed once no operation can still be reading it.
+ */
+static void _CSL_retire(ConcurrentSkipList* list, CSLSlot* slot, CSLNode* node)
+{
+    // The global epoch, not the announced one: it may already be one ahead,
+    // and a reader that entered in it can still hold the node.
+    unsigned long epoch = atomic_load(&list->epoch);
+    int b = (int)(epoch % CSL_LIMBO_LISTS);
+    if (slot->limbo[b] && slot->limboEpoch[b] != epoch) {
+        // Filled three or more epochs ago, so already safe.
+        _CSL_freeChain(slot->limbo[b]);
+        slot->limbo[b] = NULL;
+    }
+    node->retired = slot->limbo[b];
+    slot->limbo[b] = node;
+    slot->limboEpoch[b] = epoch;
+
+    if (++slot->retiredSinceAdvance >= CSL_ADVANCE_INTERVAL) {
+        slot->retiredSinceAdvance = 0;
+        _CSL_tryAdvance(list);
+    }
+}
+
+/**
+ * @internal
+ * @brief Drops a reference to a node, retiring it if it was the last.
+ */
+static void _CSL_release(ConcurrentSkipList* list, CSLSlot* slot, CSLNode* node)
+{
+    if (atomic_fetch_sub(&node->refs, 1) == 1)
+        _CSL_retire(list, slot, node);
+}
+
+/**
+ * @internal
+ * @brief Locates `key` at every level, unlinking marked nodes on the way.
+ * @details On return `preds[i]` is the last node ordered before `key` at level
+ * `i` and `succs[i]` the node after it, each unmarked when it was read, and no
+ * marked node lies between them.
+ * @return `true` if `succs[0]` holds `key`.
+ */
+static bool _CSL_find(ConcurrentSkipList* list, const void* key, CSLNode** preds, CSLNode** succs)
+{
+retry:;
+    CSLNode* pred = list->head;
+    for (int level = CSL_MAX_LEVEL - 1; level >= 0; level--) {
+        CSLNode* curr = _CSL_pointer(atomic_load(&pred->next[level]));
+        while (curr) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            if (_CSL_isMarked(succ)) {
+                // `curr` is being deleted: swing `pred` past it, or start over if `pred` changed.
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->next[level], &expected, succ & ~(uintptr_t)1))
+                    goto retry;
+                curr = _CSL_pointer(succ);
+                continue;
+            }
+            if (list->cmp(_CSL_data(curr), key) >= 0) break;
+            pred = curr;
+            curr = _CSL_pointer(succ);
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return succs[0] && list->cmp(_CSL_data(succs[0]), key) == 0;
+}
+
+/**
+ * @internal
+ * @brief Finds the first unmarked node not ordered before `key` without writing anything.
+ * @param exact If true, stop at `NULL` unless the node found holds `key`.
+ */
+static CSLNode* _CSL_seek(const ConcurrentSkipList* list, const void* key, bool exact)
+{
+    CSLNode* pred = list->head;
+    CSLNode* curr = NULL;
+    for (int level = CSL_MAX_LEVEL - 1; level >= 0; level--) {
+        curr = _CSL_pointer(atomic_load(&pred->next[level]));
+        while (curr) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            if (_CSL_isMarked(succ)) {
+                curr = _CSL_pointer(succ);
+                continue;
+            }
+            if (list->cmp(_CSL_data(curr), key) >= 0) break;
+            pred = curr;
+            curr = _CSL_pointer(succ);
+        }
+    }
+    if (exact && curr && list->cmp(_CSL_data(curr), key) != 0) return NULL;
+    return curr;
+}
+
+/* --------------------------- Public API Functions --------------------------- */
+
+ConcurrentSkipList* ConcurrentSkipList_init(size_t dataSize, int (*cmp)(const void *, const void *))
+{
+    if (!cmp || dataSize == 0 || dataSize > SIZE_MAX - _CSL_dataOffset(CSL_MAX_LEVEL)) return NULL;
+
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    size_t listBytes = (sizeof(ConcurrentSkipList) + CSL_CACHE_LINE - 1) & ~(size_t)(CSL_CACHE_LINE - 1);
+    ConcurrentSkipList* list = aligned_alloc(CSL_CACHE_LINE, listBytes);
+    if (!list) return NULL;
+
+    list->head = malloc(_CSL_dataOffset(CSL_MAX_LEVEL));
+    list->slots = aligned_alloc(CSL_CACHE_LINE, CSL_MAX_THREADS * sizeof(CSLSlot));
+    if (!list->head || !list->slots) {
+        free(list->head);
+        free(list->slots);
+        free(list);
+        return NULL;
+    }
+
+    list->head->retired = NULL;
+    list->head->level = CSL_MAX_LEVEL;
+    atomic_init(&list->head->refs, 0);
+    for (int i = 0; i < CSL_MAX_LEVEL; i++)
+        atomic_init(&list->head->next[i], (uintptr_t)0);
+
+    memset(list->slots, 0, CSL_MAX_THREADS * sizeof(CSLSlot));
+    for (size_t i = 0; i < CSL_MAX_THREADS; i++)
+        atomic_init(&list->slots[i].state, 0);
+
+    atomic_init(&list->epoch, 0);
+    atomic_init(&list->size, 0);
+    list->dataSize = dataSize;
+    list->cmp = cmp;
+    return list;
+}
+
+void ConcurrentSkipList_destroy(ConcurrentSkipList* list)
+{
+    if (!list) return;
+
+    CSLNode* node = _CSL_pointer(atomic_load(&list->head->next[0]));
+    while (node) {
+        CSLNode* next = _CSL_pointer(atomic_load(&node->next[0]));
+        free(node);
+        node = next;
+    }
+    for (size_t i = 0; i < CSL_MAX_THREADS; i++)
+        for (int b = 0; b < CSL_LIMBO_LISTS; b++)
+            _CSL_freeChain(list->slots[i].limbo[b]);
+
+    free(list->slots);
+    free(list->head);
+    free(list);
+}
+
+STATUS ConcurrentSkipList_insert(ConcurrentSkipList* list, const void* element)
+{
+    if (!list || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    int level = _CSL_randomLevel();
+    CSLNode* node = malloc(_CSL_dataOffset(level) + list->dataSize);
+    if (!node) return STATUS_ERR_ALLOC;
+    node->retired = NULL;
+    node->level = level;
+    atomic_init(&node->refs, 2);
+    memcpy(_CSL_data(node), element, list->dataSize);
+
+    CSLNode* preds[CSL_MAX_LEVEL];
+    CSLNode* succs[CSL_MAX_LEVEL];
+    CSLSlot* slot = _CSL_enter(list);
+
+    // Linking the bottom level makes the element present.
+    for (;;) {
+        if (_CSL_find(list, element, preds, succs)) {
+            _CSL_leave(slot);
+            free(node);
+            return STATUS_ERR_DUPLICATE_KEY;
+        }
+        for (int i = 0; i < level; i++)
+            atomic_store_explicit(&node->next[i], (uintptr_t)succs[i], memory_order_relaxed);
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node)) break;
+    }
+    atomic_fetch_add(&list->size, 1);
+
+    // Link the upper levels, giving up as soon as a deleter has marked the node.
+    for (int i = 1; i < level; i++) {
+        for (;;) {
+            uintptr_t link = atomic_load(&node->next[i]);
+            if (_CSL_isMarked(link)) goto linked;
+            if (link != (uintptr_t)succs[i]
+                && !atomic_compare_exchange_strong(&node->next[i], &link, (uintptr_t)succs[i]))
+                goto linked;
+
+            uintptr_t expected = (uintptr_t)succs[i];
+            if (atomic_compare_exchange_strong(&preds[i]->next[i], &expected, (uintptr_t)node)) break;
+            _CSL_find(list, element, preds, succs);
+            if (_CSL_isMarked(atomic_load(&node->next[0]))) goto linked;
+        }
+    }
+
+linked:
+    // A deleter may have run its unlinking search before a level was linked
+    // above; search again so the node is unreachable before it is retired.
+    if (_CSL_isMarked(atomic_load(&node->next[0])))
+        _CSL_find(list, element, preds, succs);
+    _CSL_release(list, slot, node);
+    _CSL_leave(slot);
+    return STATUS_OK;
+}
+
+STATUS ConcurrentSkipList_delete(ConcurrentSkipList* list, const void* key)
+{
+    if (!list || !key) return STATUS_ERR_INVALID_ARGUMENT;
+
+    CSLNode* preds[CSL_MAX_LEVEL];
+    CSLNode* succs[CSL_MAX_LEVEL];
+    CSLSlot* slot = _CSL_enter(list);
+
+    if (!_CSL_find(list, key, preds, succs)) {
+        _CSL_leave(slot);
+        return STATUS_ERR_KEY_NOT_FOUND;
+    }
+    CSLNode* node = succs[0];
+
+    // Mark the upper levels top-down, then the bottom level, which decides the winner.
+    for (int i = node->level - 1; i >= 1; i--) {
+        uintptr_t link = atomic_load(&node->next[i]);
+        while (!_CSL_isMarked(link) && !atomic_compare_exchange_weak(&node->next[i], &link, link | 1)) {}
+    }
+    uintptr_t link = atomic_load(&node->next[0]);
+    for (;;) {
+        if (_CSL_isMarked(link)) {
+            _CSL_leave(slot);
+            return STATUS_ERR_KEY_NOT_FOUND;
+        }
+        if (atomic_compare_exchange_weak(&node->next[0], &link, link | 1)) break;
+    }
+    atomic_fetch_sub(&list->size, 1);
+
+    _CSL_find(list, key, preds, succs);
+    _CSL_release(list, slot, node);
+    _CSL_leave(slot);
+    return STATUS_OK;
+}
+
+STATUS ConcurrentSkipList_search(ConcurrentSkipList* list, const void* key, void* elementOut)
+{
+    if (!list || !key) return STATUS_ERR_INVALID_ARGUMENT;
+
+    CSLSlot* slot = _CSL_enter(list);
+    CSLNode* node = _CSL_seek(list, key, true);
+    if (node && elementOut) memcpy(elementOut, _CSL_data(node), list->dataSize);
+    _CSL_leave(slot);
+    return node ? STATUS_OK : STATUS_ERR_KEY_NOT_FOUND;
+}
+
+STATUS ConcurrentSkipList_lowerBound(ConcurrentSkipList* list, const void* key, void* elementOut)
+{
+    if (!list || !key || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    CSLSlot* slot = _CSL_enter(list);
+    CSLNode* node = _CSL_seek(list, key, false);
+    if (node) memcpy(elementOut, _CSL_data(node), list->dataSize);
+    _CSL_leave(slot);
+    return node ? STATUS_OK : STATUS_ERR_KEY_NOT_FOUND;
+}
+
+STATUS ConcurrentSkipList_forEach(ConcurrentSkipList* list, bool (*callback)(const void* element, void* ctx), void* ctx)
+{
+    if (!list || !callback) return STATUS_ERR_INVALID_ARGUMENT;
+
+    CSLSlot* slot = _CSL_enter(list);
+    CSLNode* node = _CSL_pointer(atomic_load(&list->head->next[0]));
+    while (node) {
+        uintptr_t next = atomic_load(&node->next[0]);
+        if (!_CSL_isMarked(next) && !callback(_CSL_data(node), ctx)) break;
+        node = _CSL_pointer(next);
+    }
+    _CSL_leave(slot);
+    return STATUS_OK;
+}
+
+size_t ConcurrentSkipList_size(ConcurrentSkipList* list)
+{
+    if (!list) return 0;
+    return atomic_load(&list->size);
+}
@@ -0,0 +1,549 @@
+#include "../include/hashmap.h"
+#include "allocator_internal.h"
+#include "stats_internal.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @internal
+ * @brief Number of control bytes examined at once by a lookup.
+ */
+#define HASHMAP_GROUP 16
+
+/**
+ * @internal
+ * @brief Control byte of an empty slot. Full slots hold 7 bits of the hash,
+ * so this is the only control value with its high bit set.
+ */
+#define HASHMAP_EMPTY 0x80
+
+/**
+ * @internal
+ * @brief Longest probe distance a slot can record.
+ */
+#define HASHMAP_MAX_DISTANCE UINT16_MAX
+
+/**
+ * @internal
+ * @brief Sentinel slot index meaning "not found".
+ */
+#define HASHMAP_NOT_FOUND SIZE_MAX
+
+/**
+ * @internal
+ * @struct HashMap
+ * @brief Defines the internal structure of the hash map.
+ * @details The table is a single allocation holding `capacity` entries, then
+ * `capacity` probe distances, then `capacity + HASHMAP_GROUP` control bytes.
+ * The first `HASHMAP_GROUP - 1` control bytes are mirrored past the end, so a
+ * group can be loaded at any slot without wrapping. Entries with a larger
+ * probe distance than their successor never exist (the Robin Hood invariant),
+ * so the entries of a cluster are ordered by home slot.
+ */
+struct HashMap
+{
+    unsigned char* entries;                         // Key/value pairs, `stride` bytes apart.
+    uint16_t* distances;                            // Distance of each full slot from its home slot.
+    uint8_t* control;                               // HASHMAP_EMPTY or 7 bits of the entry's hash.
+    size_t capacity;                                // Number of slots; 0 or a power of two >= HASHMAP_GROUP.
+    size_t size;                                    // The number of entries.
+    size_t maxDistance;                             // Upper bound on every slot's probe distance.
+    unsigned shift;                                 // 64 - log2(capacity), to take a home slot from the hash.
+    size_t keySize;                                 // The size in bytes of each key.
+    size_t valueSize;                               // The size in bytes of each value; 0 for a set.
+    size_t valueOffset;                             // Offset of the value within an entry.
+    size_t stride;                                  // The size in bytes of one entry, including padding.
+    size_t (*hash)(const void* key);                // User hash function, or NULL for HashMap_hashBytes.
+    bool (*equals)(const void* a, const void* b);   // User equality function, or NULL for memcmp.
+    DsaAllocator allocator;                         // Where the struct and its table are allocated.
+    DSA_STATS_MEMBER                                // Work counters, present only when built with DSA_STATS.
+};
+
+/* ----------------------------------------Private Helper Functions---------------------------------------- */
+
+/**
+ * @internal
+ * @brief Returns the alignment an object of `size` bytes can rely on: its largest
+ * power-of-two divisor, capped at 16.
+ */
+static size_t _HashMap_alignmentOf(size_t size)
+{
+    size_t alignment = size & (~size + 1);
+    return (alignment == 0 || alignment > 16) ? 16 : alignment;
+}
+
+/**
+ * @internal
+ * @brief Rounds `size` up to a multiple of the power of two `alignment`.
+ */
+static size_t _HashMap_roundUp(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @internal
+ * @brief Hashes a key with the user's function and mixes the bits, so that
+ * weak hashes such as the identity still spread over the table.
+ */
+static uint64_t _HashMap_hash(const HashMap* map, const void* key)
+{
+    uint64_t h = map->hash ? map->hash(key) : HashMap_hashBytes(key, map->keySize);
+    h *= 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+}
+
+/**
+ * @internal
+ * @brief Returns the home slot of a mixed hash, taken from its top bits.
+ */
+static size_t _HashMap_home(const HashMap* map, uint64_t h)
+{
+    return (size_t)(h >> map->shift);
+}
+
+/**
+ * @internal
+ * @brief Returns the 7-bit control tag of a mixed hash, taken from its low bits.
+ */
+static uint8_t _HashMap_tag(uint64_t h)
+{
+    return (uint8_t)(h & 0x7F);
+}
+
+static bool _HashMap_equals(const HashMap* map, const void* a, const void* b)
+{
+    DSA_STAT_ADD(map, comparisons, 1);
+    return map->equals ? map->equals(a, b) : memcmp(a, b, map->keySize) == 0;
+}
+
+static unsigned char* _HashMap_entry(const HashMap* map, size_t slot)
+{
+    return map->entries + slot * map->stride;
+}
+
+/**
+ * @internal
+ * @brief Writes a control byte, keeping the mirrored copy past the end in sync.
+ */
+static void _HashMap_setControl(HashMap* map, size_t slot, uint8_t value)
+{
+    map->control[slot] = value;
+    if (slot < HASHMAP_GROUP - 1)
+        map->control[map->capacity + slot] = value;
+}
+
+/**
+ * @internal
+ * @brief Matches the `HASHMAP_GROUP` control bytes starting at `group` against `tag`.
+ * @param emptyOut Receives a bitmask of the empty slots in the group.
+ * @return A bitmask of the slots whose tag equals `tag`; bit `j` is slot `group + j`.
+ */
+static uint32_t _HashMap_matchGroup(const uint8_t* group, uint8_t tag, uint32_t* emptyOut)
+{
+#if defined(__SSE2__)
+    __m128i bytes = _mm_loadu_si128((const __m128i*)group);
+    *emptyOut = (uint32_t)_mm_movemask_epi8(bytes);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)tag)));
+#else
+    uint32_t match = 0, empty = 0;
+    for (unsigned j = 0; j < HASHMAP_GROUP; j++) {
+        if (group[j] == tag) match |= 1u << j;
+        if (group[j] == HASHMAP_EMPTY) empty |= 1u << j;
+    }
+    *emptyOut = empty;
+    return match;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ */
+static unsigned _HashMap_lowestBit(uint32_t mask)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned j = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        j++;
+    }
+    return j;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Finds the slot holding `key`.
+ * @details Probes a group of slots per step. Only matches before the group's
+ * first empty slot are candidates, since no entry lies past an empty slot
+ * from its home; and no entry lies farther than `maxDistance` from it.
+ * In stats builds the slots from the home slot to the key, or to the first
+ * empty slot for a missing key, count as its probe sequence.
+ * @return The slot index, or `HASHMAP_NOT_FOUND`.
+ */
+static size_t _HashMap_find(const HashMap* map, const void* key, uint64_t h)
+{
+    if (map->size == 0) return HASHMAP_NOT_FOUND;
+
+    size_t mask = map->capacity - 1;
+    size_t home = _HashMap_home(map, h);
+    uint8_t tag = _HashMap_tag(h);
+
+    for (size_t offset = 0; offset <= map->maxDistance; offset += HASHMAP_GROUP) {
+        size_t position = (home + offset) & mask;
+        uint32_t empty;
+        uint32_t match = _HashMap_matchGroup(&map->control[position], tag, &empty);
+        if (empty) match &= (empty & (~empty + 1)) - 1;
+
+        while (match) {
+            size_t slot = (position + _HashMap_lowestBit(match)) & mask;
+            if (_HashMap_equals(map, _HashMap_entry(map, slot), key)) {
+                DSA_STAT_ADD(map, probes, (size_t)map->distances[slot] + 1);
+                DSA_STAT_MAX(map, maxProbe, (size_t)map->distances[slot] + 1);
+                return slot;
+            }
+            match &= match - 1;
+        }
+        if (empty) {
+            DSA_STAT_ADD(map, probes, offset + _HashMap_lowestBit(empty) + 1);
+            DSA_STAT_MAX(map, maxProbe, offset + _HashMap_lowestBit(empty) + 1);
+            break;
+        }
+    }
+    return HASHMAP_NOT_FOUND;
+}
+
+/**
+ * @internal
+ * @brief Moves the entry in slot `from` to the empty slot `to`, recording its new probe distance.
+ */
+static void _HashMap_moveSlot(HashMap* map, size_t from, size_t to, size_t distance)
+{
+    memcpy(_HashMap_entry(map, to), _HashMap_entry(map, from), map->stride);
+    DSA_STAT_ADD(map, bytesMoved, map->stride);
+    _HashMap_setControl(map, to, map->control[from]);
+    map->distances[to] = (uint16_t)distance;
+}
+
+/**
+ * @internal
+ * @brief Inserts a key known to be absent into a table with room for it.
+ * @details The new entry goes before the first entry of its probe sequence
+ * whose home slot is later than its own, and the rest of the cluster shifts
+ * one slot right, which is what Robin Hood displacement amounts to.
+ * @return `STATUS_OK`, or `STATUS_ERR_OVERFLOW` (with nothing changed) if a
+ * probe distance would exceed `HASHMAP_MAX_DISTANCE`.
+ */
+static STATUS _HashMap_insertNew(HashMap* map, uint64_t h, const void* key, const void* value)
+{
+    size_t mask = map->capacity - 1;
+    size_t position = _HashMap_home(map, h);
+    size_t distance = 0;
+    while (map->control[position] != HASHMAP_EMPTY && map->distances[position] >= distance) {
+        position = (position + 1) & mask;
+        distance++;
+    }
+
+    // Find the end of the cluster, and the longest distance the shift will produce.
+    size_t end = position;
+    size_t longest = distance;
+    while (map->control[end] != HASHMAP_EMPTY) {
+        if ((size_t)map->distances[end] + 1 > longest) longest = (size_t)map->distances[end] + 1;
+        end = (end + 1) & mask;
+    }
+    if (longest > HASHMAP_MAX_DISTANCE) return STATUS_ERR_OVERFLOW;
+
+    for (size_t slot = end; slot != position; ) {
+        size_t previous = (slot - 1) & mask;
+        _HashMap_moveSlot(map, previous, slot, (size_t)map->distances[previous] + 1);
+        slot = previous;
+    }
+
+    unsigned char* entry = _HashMap_entry(map, position);
+    memcpy(entry, key, map->keySize);
+    if (map->valueSize) memcpy(entry + map->valueOffset, value, map->valueSize);
+    _HashMap_setControl(map, position, _HashMap_tag(h));
+    map->distances[position] = (uint16_t)distance;
+
+    if (longest > map->maxDistance) map->maxDistance = longest;
+    map->size++;
+    return STATUS_OK;
+}
+
+/**
+ * @internal
+ * @brief Empties slot `slot`, shifting the rest of its cluster back one slot.
+ */
+static void _HashMap_removeSlot(HashMap* map, size_t slot)
+{
+    size_t mask = map->capacity - 1;
+    size_t next = (slot + 1) & mask;
+    while (map->control[next] != HASHMAP_EMPTY && map->distances[next] > 0) {
+        _HashMap_moveSlot(map, next, slot, (size_t)map->distances[next] - 1);
+        slot = next;
+        next = (next + 1) & mask;
+    }
+    _HashMap_setControl(map, slot, HASHMAP_EMPTY);
+    map->size--;
+}
+
+/**
+ * @internal
+ * @brief Returns the largest number of entries a table of `capacity` slots may hold.
+ */
+static size_t _HashMap_maxLoad(size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+/**
+ * @internal
+ * @brief Returns the size of the single allocation holding a table of `capacity` slots.
+ * @param entryBytesOut Receives the offset of the distance array.
+ * @param distanceBytesOut Receives the size of the distance array, padded.
+ */
+static size_t _HashMap_tableBytes(const HashMap* map, size_t capacity, size_t* entryBytesOut, size_t* distanceBytesOut)
+{
+    size_t entryBytes = _HashMap_roundUp(capacity * map->stride, 16);
+    size_t distanceBytes = _HashMap_roundUp(capacity * sizeof(uint16_t), 16);
+    if (entryBytesOut) *entryBytesOut = entryBytes;
+    if (distanceBytesOut) *distanceBytesOut = distanceBytes;
+    return entryBytes + distanceBytes + capacity + HASHMAP_GROUP;
+}
+
+/**
+ * @internal
+ * @brief Releases the table, if there is one.
+ */
+static void _HashMap_freeTable(const HashMap* map)
+{
+    if (map->entries)
+        _Dsa_free(&map->allocator, map->entries, _HashMap_tableBytes(map, map->capacity, NULL, NULL));
+}
+
+/**
+ * @internal
+ * @brief Moves every entry into a new table of `capacity` slots.
+ * @return `STATUS_OK`, or an error with the map unchanged.
+ */
+static STATUS _HashMap_rehash(HashMap* map, size_t capacity)
+{
+    size_t entryBytes, distanceBytes;
+    size_t tableBytes = _HashMap_tableBytes(map, capacity, &entryBytes, &distanceBytes);
+    unsigned char* block = _Dsa_alloc(&map->allocator, tableBytes);
+    if (!block) return STATUS_ERR_ALLOC;
+
+    HashMap old = *map;
+    map->entries = block;
+    map->distances = (uint16_t*)(block + entryBytes);
+    map->control = block + entryBytes + distanceBytes;
+    map->capacity = capacity;
+    map->size = 0;
+    map->maxDistance = 0;
+    map->shift = 64;
+    for (size_t c = capacity; c > 1; c >>= 1) map->shift--;
+    memset(map->control, HASHMAP_EMPTY, capacity + HASHMAP_GROUP);
+
+    for (size_t slot = 0; slot < old.capacity; slot++) {
+        if (old.control[slot] == HASHMAP_EMPTY) continue;
+        unsigned char* entry = _HashMap_entry(&old, slot);
+        if (_HashMap_insertNew(map, _HashMap_hash(map, entry), entry, entry + map->valueOffset) != STATUS_OK) {
+            _HashMap_freeTable(map);
+            *map = old;
+            return STATUS_ERR_OVERFLOW;
+        }
+    }
+
+    _HashMap_freeTable(&old);
+    DSA_STAT_ADD(map, reallocs, 1);
+    DSA_STAT_ADD(map, bytesMoved, old.size * map->stride);
+    return STATUS_OK;
+}
+
+/**
+ * @internal
+ * @brief Ensures there is room for `count` entries, rehashing into the smallest
+ * sufficient power-of-two table when there is not.
+ */
+static STATUS _HashMap_ensureRoom(HashMap* map, size_t count)
+{
+    if (count <= _HashMap_maxLoad(map->capacity)) return STATUS_OK;
+
+    size_t capacity = map->capacity ? map->capacity : HASHMAP_GROUP;
+    size_t limit = (SIZE_MAX / 2 - HASHMAP_GROUP) / (map->stride + sizeof(uint16_t) + 1);
+    while (count > _HashMap_maxLoad(capacity)) {
+        if (capacity > limit / 2) return STATUS_ERR_OVERFLOW;
+        capacity *= 2;
+    }
+    return _HashMap_rehash(map, capacity);
+}
+
+/**
+ * @internal
+ * @brief Shared body of `HashMap_insert` and `HashMap_put`.
+ */
+static STATUS _HashMap_store(HashMap* map, const void* key, const void* value, bool replace)
+{
+    if (!map || !key || (map->valueSize && !value)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    uint64_t h = _HashMap_hash(map, key);
+    size_t slot = _HashMap_find(map, key, h);
+    if (slot != HASHMAP_NOT_FOUND) {
+        if (!replace) return STATUS_ERR_DUPLICATE_KEY;
+        if (map->valueSize) memcpy(_HashMap_entry(map, slot) + map->valueOffset, value, map->valueSize);
+        return STATUS_OK;
+    }
+
+    if (map->size == SIZE_MAX) return STATUS_ERR_OVERFLOW;
+    STATUS status = _HashMap_ensureRoom(map, map->size + 1);
+    if (status != STATUS_OK) return status;
+    return _HashMap_insertNew(map, h, key, value);
+}
+
+/* -------------------------------------------Public API Functions------------------------------------------- */
+
+HashMap* HashMap_init(size_t keySize, size_t valueSize,
+    size_t (*hash)(const void* key), bool (*equals)(const void* a, const void* b))
+{
+    return HashMap_initWithAllocator(keySize, valueSize, hash, equals, NULL);
+}
+
+HashMap* HashMap_initWithAllocator(size_t keySize, size_t valueSize,
+    size_t (*hash)(const void* key), bool (*equals)(const void* a, const void* b), const DsaAllocator* allocator)
+{
+    allocator = _Dsa_resolve(allocator);
+    if (!allocator || keySize == 0 || keySize > SIZE_MAX / 8 || valueSize > SIZE_MAX / 8) return NULL;
+
+    HashMap* map = _Dsa_alloc(allocator, sizeof(HashMap));
+    if (!map) return NULL;
+
+    map->entries = NULL;
+    map->distances = NULL;
+    map->control = NULL;
+    map->capacity = 0;
+    map->size = 0;
+    map->maxDistance = 0;
+    map->shift = 64;
+    map->keySize = keySize;
+    map->valueSize = valueSize;
+    map->valueOffset = valueSize ? _HashMap_roundUp(keySize, _HashMap_alignmentOf(valueSize)) : keySize;
+    size_t keyAlignment = _HashMap_alignmentOf(keySize);
+    size_t valueAlignment = valueSize ? _HashMap_alignmentOf(valueSize) : 1;
+    map->stride = _HashMap_roundUp(map->valueOffset + valueSize, keyAlignment > valueAlignment ? keyAlignment : valueAlignment);
+    map->hash = hash;
+    map->equals = equals;
+    map->allocator = *allocator;
+    DSA_STATS_INIT(map);
+    return map;
+}
+
+void HashMap_destroy(HashMap* map)
+{
+    if (!map) return;
+    DsaAllocator allocator = map->allocator;
+    _HashMap_freeTable(map);
+    _Dsa_free(&allocator, map, sizeof(HashMap));
+}
+
+STATUS HashMap_reserve(HashMap* map, size_t count)
+{
+    if (!map) return STATUS_ERR_INVALID_ARGUMENT;
+    return _HashMap_ensureRoom(map, count);
+}
+
+STATUS HashMap_insert(HashMap* map, const void* key, const void* value)
+{
+    DSA_TRACE("HashMap", "insert", map);
+    return _HashMap_store(map, key, value, false);
+}
+
+STATUS HashMap_put(HashMap* map, const void* key, const void* value)
+{
+    DSA_TRACE("HashMap", "put", map);
+    return _HashMap_store(map, key, value, true);
+}
+
+void* HashMap_get(const HashMap* map, const void* key)
+{
+    DSA_TRACE("HashMap", "get", map);
+    if (!map || !key) return NULL;
+
+    size_t slot = _HashMap_find(map, key, _HashMap_hash(map, key));
+    if (slot == HASHMAP_NOT_FOUND) return NULL;
+    return _HashMap_entry(map, slot) + (map->valueSize ? map->valueOffset : 0);
+}
+
+bool HashMap_contains(const HashMap* map, const void* key)
+{
+    return HashMap_get(map, key) != NULL;
+}
+
+STATUS HashMap_remove(HashMap* map, const void* key, void* valueOut)
+{
+    DSA_TRACE("HashMap", "remove", map);
+    if (!map || !key) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t slot = _HashMap_find(map, key, _HashMap_hash(map, key));
+    if (slot == HASHMAP_NOT_FOUND) return STATUS_ERR_KEY_NOT_FOUND;
+
+    if (valueOut && map->valueSize)
+        memcpy(valueOut, _HashMap_entry(map, slot) + map->valueOffset, map->valueSize);
+    _HashMap_removeSlot(map, slot);
+    return STATUS_OK;
+}
+
+STATUS HashMap_clear(HashMap* map)
+{
+    if (!map) return STATUS_ERR_INVALID_ARGUMENT;
+    if (map->control) memset(map->control, HASHMAP_EMPTY, map->capacity + HASHMAP_GROUP);
+    map->size = 0;
+    map->maxDistance = 0;
+    return STATUS_OK;
+}
+
+size_t HashMap_size(const HashMap* map)
+{
+    return map ? map->size : 0;
+}
+
+size_t HashMap_capacity(const HashMap* map)
+{
+    return map ? map->capacity : 0;
+}
+
+STATUS HashMap_forEach(const HashMap* map, bool (*callback)(const void* key, void* value, void* ctx), void* ctx)
+{
+    if (!map || !callback) return STATUS_ERR_INVALID_ARGUMENT;
+
+    for (size_t slot = 0; slot < map->capacity; slot++) {
+        if (map->control[slot] == HASHMAP_EMPTY) continue;
+        unsigned char* entry = _HashMap_entry(map, slot);
+        if (!callback(entry, map->valueSize ? entry + map->valueOffset : NULL, ctx))
+            break;
+    }
+    return STATUS_OK;
+}
+
+STATUS HashMap_getStats(const HashMap* map, DsaStats* statsOut)
+{
+    if (!map || !statsOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    DSA_STATS_COPY(statsOut, map);
+    return STATUS_OK;
+}
+
+size_t HashMap_hashBytes(const void* data, size_t length)
+{
+    const unsigned char* bytes = data;
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < length; i++) {
+        h ^= bytes[i];
+        h *= 0x100000001B3ull;
+    }
+    return (size_t)h;
+}
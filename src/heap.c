@@ -1,4 +1,5 @@
 #include "../include/heap.h"
+#include "arraylist_internal.h"
 
 /**
  * @struct Heap
@@ -10,151 +11,256 @@ struct Heap{
     ArrayList* arr;                             // A pointer to the underlying ArrayList that stores heap elements.
     size_t dataSize;                            // The size in bytes of a single element in the heap (e.g., sizeof(int)).
     int (*cmp)(const void* a, const void* b);   // A function pointer to compare two elements, defining the heap order.
+    void* scratch;                              // One element of scratch space used by the sift routines.
+    size_t arity;                               // The number of children per node (2, 4 or 8).
+    unsigned int arityShift;                    // log2(arity), used for index arithmetic.
+    size_t bound;                               // The most elements the heap may hold, or 0 if unbounded.
+    DSA_STATS_MEMBER                            // Comparisons and sift moves, present only when built with DSA_STATS.
 };
 
-/** @internal Macros for calculating parent and child indices in the heap array. */
-#define PARENT(i) (((i) - 1) / 2)
-#define LEFT_CHILD(i) (2 * (i) + 1)
-#define RIGHT_CHILD(i) (2 * (i) + 2)
+/**
+ * @internal Macros for calculating parent and child indices in a d-ary heap array.
+ * The arity is a power of two, so `shift` is log2(d) and the divisions become shifts.
+ */
+#define PARENT(i, shift) (((i) - 1) >> (shift))
+#define FIRST_CHILD(i, shift) (((i) << (shift)) + 1)
 
 /* --------------------------- Private Helper Functions --------------------------- */
 
 /**
  * @internal
- * @brief Swaps two elements within the heap's underlying array.
- * @param heap The heap instance.
- * @param i The index of the first element.
- * @param j The index of the second element.
- * @return `STATUS_OK` on success, or `STATUS_ERR_ALLOC` on memory allocation failure.
+ * @brief Copies one element, letting the compiler inline fixed-size copies.
+ * @details For the common small element sizes the `memcpy` length is a
+ * compile-time constant, which compiles down to one or two register moves
+ * instead of a call into the variable-length `memcpy`.
  */
-static STATUS _Heap_swap(Heap* heap, size_t i, size_t j) {
-    void* elem1 = malloc(heap->dataSize);
-    void* elem2 = malloc(heap->dataSize);
-    if (!elem1 || !elem2) {
-        free(elem1);
-        free(elem2);
-        return STATUS_ERR_ALLOC;
+static inline void _Heap_copy(void* dst, const void* src, size_t dataSize) {
+    switch (dataSize) {
+        case 4:  memcpy(dst, src, 4);  break;
+        case 8:  memcpy(dst, src, 8);  break;
+        case 16: memcpy(dst, src, 16); break;
+        default: memcpy(dst, src, dataSize); break;
     }
+}
 
-    ArrayList_get(heap->arr, i, elem1);
-    ArrayList_get(heap->arr, j, elem2);
-
-    ArrayList_set(heap->arr, i, elem2);
-    ArrayList_set(heap->arr, j, elem1);
-
-    free(elem1);
-    free(elem2);
-    return STATUS_OK;
+/**
+ * @internal
+ * @brief Calls the comparator, counting the call in stats builds.
+ */
+static inline int _Heap_compare(const Heap* heap, const void* a, const void* b) {
+    DSA_STAT_ADD(heap, comparisons, 1);
+    return heap->cmp(a, b);
 }
 
 /**
  * @internal
- * @brief Restores the heap property by sifting an element upwards from a given index.
- * @details This is a recursive function that compares an element with its parent and
- * swaps them if they are in the wrong order, continuing until the heap property is
- * satisfied or the root is reached. Typically used after a push operation.
+ * @brief Restores the heap property by sifting the element at `index` upwards.
+ * @details The element is lifted into the scratch slot, leaving a "hole". Each
+ * parent that should sit below it is moved down into the hole, and the element
+ * is written once into its final position. Typically used after a push operation.
  * @param heap The heap instance.
  * @param index The index of the element to sift up.
- * @return `STATUS_OK` on success, or `STATUS_ERR_ALLOC` on memory allocation failure.
  */
-static STATUS _Heap_heapify_up(Heap* heap, size_t index) {
-    STATUS status = STATUS_OK;
+static void _Heap_siftUp(Heap* heap, size_t index) {
+    if (index == 0) return;
+
+    ArrayList* arr = heap->arr;
+    size_t dataSize = heap->dataSize;
+    void* item = heap->scratch;
+
+    _Heap_copy(item, _ArrayList_at(arr, index), dataSize);
+    while (index > 0) {
+        size_t parentIndex = PARENT(index, heap->arityShift);
+        void* parent = _ArrayList_at(arr, parentIndex);
+        if (_Heap_compare(heap, item, parent) >= 0) break;
+        _Heap_copy(_ArrayList_at(arr, index), parent, dataSize);
+        DSA_STAT_ADD(heap, bytesMoved, dataSize);
+        index = parentIndex;
+    }
+    _Heap_copy(_ArrayList_at(arr, index), item, dataSize);
+}
 
-    if (index == 0) return status;
+/**
+ * @internal
+ * @brief Returns whichever of the elements at `a` and `b` orders first (ties keep `a`).
+ */
+static inline size_t _Heap_best(const Heap* heap, size_t a, size_t b) {
+    return _Heap_compare(heap, _ArrayList_at(heap->arr, b), _ArrayList_at(heap->arr, a)) < 0 ? b : a;
+}
 
-    size_t parentIndex = PARENT(index);
-    void* parent = malloc(heap->dataSize);
-    void* child = malloc(heap->dataSize);
+/**
+ * @internal
+ * @brief Returns the best child among the `count` children starting at `first`.
+ */
+static inline size_t _Heap_bestOf(const Heap* heap, size_t first, size_t count) {
+    size_t best = first;
+    for (size_t c = first + 1; c < first + count; c++)
+        best = _Heap_best(heap, best, c);
+    return best;
+}
 
-    if (!parent || !child) {
-        status = STATUS_ERR_ALLOC;
-    } else {
-        ArrayList_get(heap->arr, parentIndex, parent);
-        ArrayList_get(heap->arr, index, child);
-        if (heap->cmp(child, parent) < 0) {
-            if ((status = _Heap_swap(heap, parentIndex, index)) == STATUS_OK)
-                status = _Heap_heapify_up(heap, parentIndex);
+/**
+ * @internal
+ * @brief Sifts the element held in the scratch slot down from the hole at `index`.
+ * @details At each level the smaller/larger child (as per the cmp function) is
+ * moved up into the hole until the scratch element is in order with all of its
+ * children, then the scratch element is written into the hole. Typically used
+ * after a pop operation.
+ *
+ * Binary heaps compare the two children directly. For 4-ary and 8-ary heaps a
+ * node's children are contiguous (and for small elements share a cache line),
+ * and a full set of children is reduced as a balanced tournament so the
+ * comparisons at each round are independent of each other.
+ * @param heap The heap instance. `heap->scratch` holds the element to place.
+ * @param index The index of the hole to start from.
+ */
+static void _Heap_siftDown(Heap* heap, size_t index) {
+    ArrayList* arr = heap->arr;
+    size_t dataSize = heap->dataSize;
+    size_t size = arr->size;
+    unsigned int shift = heap->arityShift;
+    void* item = heap->scratch;
+
+    size_t child;
+    while ((child = FIRST_CHILD(index, shift)) < size) {
+        size_t remaining = size - child;
+        switch (heap->arity) {
+            case 2:
+                if (remaining >= 2) child = _Heap_best(heap, child, child + 1);
+                break;
+            case 4:
+                if (remaining >= 4)
+                    child = _Heap_best(heap, _Heap_best(heap, child, child + 1),
+                                             _Heap_best(heap, child + 2, child + 3));
+                else
+                    child = _Heap_bestOf(heap, child, remaining);
+                break;
+            case 8:
+                if (remaining >= 8)
+                    child = _Heap_best(heap,
+                        _Heap_best(heap, _Heap_best(heap, child, child + 1),
+                                         _Heap_best(heap, child + 2, child + 3)),
+                        _Heap_best(heap, _Heap_best(heap, child + 4, child + 5),
+                                         _Heap_best(heap, child + 6, child + 7)));
+                else
+                    child = _Heap_bestOf(heap, child, remaining);
+                break;
         }
+
+        void* best = _ArrayList_at(arr, child);
+        if (_Heap_compare(heap, best, item) >= 0) break;
+        _Heap_copy(_ArrayList_at(arr, index), best, dataSize);
+        DSA_STAT_ADD(heap, bytesMoved, dataSize);
+        index = child;
     }
-    
-    free(parent);
-    free(child);
-    return status;
+    _Heap_copy(_ArrayList_at(arr, index), item, dataSize);
 }
 
 /**
  * @internal
- * @brief Restores the heap property by sifting an element downwards from a given index.
- * @details This is a recursive function that compares an element with its children,
- * swapping it with the smallest/largest child (as per the cmp function) if they are
- * in the wrong order. This continues until the element is in its correct place.
- * Typically used after a pop operation.
- * @param heap The heap instance.
- * @param index The index of the element to sift down.
- * @return `STATUS_OK` on success, or `STATUS_ERR_ALLOC` on memory allocation failure.
+ * @brief Builds the heap property over the whole array bottom-up (Floyd's method).
+ * @details Sifts down every internal node, starting from the last parent. The
+ * total work is bounded by the sum of node heights, which is O(n).
  */
-static STATUS _Heap_heapify_down(Heap* heap, size_t index) {
-    STATUS status = STATUS_OK;
+static void _Heap_heapify(Heap* heap) {
+    size_t size = heap->arr->size;
+    if (size < 2) return;
 
-    size_t left = LEFT_CHILD(index);
-    size_t right = RIGHT_CHILD(index);
-    size_t target = index;
+    for (size_t i = PARENT(size - 1, heap->arityShift) + 1; i-- > 0; ) {
+        _Heap_copy(heap->scratch, _ArrayList_at(heap->arr, i), heap->dataSize);
+        _Heap_siftDown(heap, i);
+    }
+}
 
-    void* targetElem = malloc(heap->dataSize);
-    void* leftElem = malloc(heap->dataSize);
-    void* rightElem = malloc(heap->dataSize);
+/**
+ * @internal
+ * @brief Removes the root into `elementOut`. The heap must not be empty.
+ */
+static STATUS _Heap_popRoot(Heap* heap, void* elementOut) {
+    size_t size = heap->arr->size;
 
-    if (!targetElem || !leftElem || !rightElem) {
-        status = STATUS_ERR_ALLOC;
-    } else {
-        ArrayList_get(heap->arr, target, targetElem);
-
-        // Find the "smallest" or "largest" among the parent and its children.
-        if (left < Heap_size(heap)) {
-            ArrayList_get(heap->arr, left, leftElem);
-            if (heap->cmp(leftElem, targetElem) < 0) {
-                target = left;
-                memcpy(targetElem, leftElem, heap->dataSize);
-            }
-        }
-        if (right < Heap_size(heap)) {
-            ArrayList_get(heap->arr, right, rightElem);
-            if (heap->cmp(rightElem, targetElem) < 0) {
-                target = right;
-            }
-        }
-        // If the target is not the original element, swap and recurse down.
-        if (target != index) {
-            if ((status = _Heap_swap(heap, index, target)) == STATUS_OK) {
-                status = _Heap_heapify_down(heap, target);
-            }
-        }
-    }
+    _Heap_copy(elementOut, _ArrayList_at(heap->arr, 0), heap->dataSize);
+
+    // The last element is lifted out and sifted down from the root's hole.
+    _Heap_copy(heap->scratch, _ArrayList_at(heap->arr, size - 1), heap->dataSize);
+    STATUS status = ArrayList_delete(heap->arr, size - 1);
+    if (status != STATUS_OK) return status;
 
-    free(targetElem);
-    free(leftElem);
-    free(rightElem);
-    return status;
+    if (size > 1) _Heap_siftDown(heap, 0);
+    return STATUS_OK;
 }
 
 
 /* ----------------------------- Public API Functions ----------------------------- */
 
 Heap* Heap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b)) {
+    return Heap_initWithArity(capacity, dataSize, cmp, 2);
+}
+
+Heap* Heap_initWithArity(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b), size_t arity) {
     if (dataSize == 0 || !cmp) return NULL;
 
+    unsigned int arityShift;
+    switch (arity) {
+        case 2: arityShift = 1; break;
+        case 4: arityShift = 2; break;
+        case 8: arityShift = 3; break;
+        default: return NULL;
+    }
+
     Heap* heap = (Heap*)malloc(sizeof(Heap));
     if (!heap) return NULL;
 
     ArrayList* arr = ArrayList_init(capacity, dataSize);
-    if (!arr) {
+    void* scratch = malloc(dataSize);
+    if (!arr || !scratch) {
+        ArrayList_destroy(arr);
+        free(scratch);
         free(heap);
         return NULL;
     }
 
     heap->arr = arr;
+    heap->scratch = scratch;
+    heap->arity = arity;
+    heap->arityShift = arityShift;
     heap->dataSize = dataSize;
     heap->cmp = cmp;
+    heap->bound = 0;
+    DSA_STATS_INIT(heap);
+    return heap;
+}
+
+Heap* Heap_initBounded(size_t k, size_t dataSize, int (*cmp)(const void* a, const void* b)) {
+    if (k == 0) return NULL;
+
+    Heap* heap = Heap_initWithArity(k, dataSize, cmp, 2);
+    if (!heap) return NULL;
+
+    // The storage is sized for k elements once and never shrinks, so offers never allocate.
+    ArrayListPolicy policy;
+    ArrayList_getPolicy(heap->arr, &policy);
+    policy.shrinkOnDelete = false;
+    ArrayList_setPolicy(heap->arr, &policy);
+    heap->bound = k;
+    return heap;
+}
+
+Heap* Heap_initFromArray(const void* data, size_t count, size_t dataSize, int (*cmp)(const void* a, const void* b)) {
+    return Heap_initFromArrayWithArity(data, count, dataSize, cmp, 2);
+}
+
+Heap* Heap_initFromArrayWithArity(const void* data, size_t count, size_t dataSize, int (*cmp)(const void* a, const void* b), size_t arity) {
+    if (!data && count > 0) return NULL;
+
+    Heap* heap = Heap_initWithArity(count, dataSize, cmp, arity);
+    if (!heap) return NULL;
+
+    if (count > 0) {
+        memcpy(heap->arr->data, data, count * dataSize);
+        heap->arr->size = count;
+        _Heap_heapify(heap);
+    }
     return heap;
 }
 
@@ -162,36 +268,110 @@ void Heap_destroy(Heap* heap) {
     if (!heap) return;
     ArrayList_destroy(heap->arr); 
     heap->arr = NULL;
+    free(heap->scratch);
+    heap->scratch = NULL;
     free(heap);
 }
 
 STATUS Heap_push(Heap* heap, void* element) {
+    DSA_TRACE("Heap", "push", heap);
     if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    if (heap->bound && Heap_size(heap) >= heap->bound) return STATUS_ERR_FULL;
 
     STATUS status = ArrayList_insert(heap->arr, element);
     if (status != STATUS_OK) return status;
 
-    return _Heap_heapify_up(heap, Heap_size(heap) - 1);
+    _Heap_siftUp(heap, Heap_size(heap) - 1);
+    return STATUS_OK;
 }
 
 STATUS Heap_pop(Heap* heap, void* elementOut) {
+    DSA_TRACE("Heap", "pop", heap);
     if (!heap || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+    if (Heap_size(heap) == 0) return STATUS_ERR_UNDERFLOW;
 
-    size_t size = Heap_size(heap);
-    if (size == 0) return STATUS_ERR_UNDERFLOW;
+    return _Heap_popRoot(heap, elementOut);
+}
 
-    STATUS status = ArrayList_get(heap->arr, 0, elementOut);
+STATUS Heap_pushMany(Heap* heap, const void* elements, size_t count) {
+    if (!heap || (!elements && count > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+    if (count == 0) return STATUS_OK;
+
+    ArrayList* arr = heap->arr;
+    size_t oldSize = arr->size;
+    if (count > SIZE_MAX - oldSize) return STATUS_ERR_OVERFLOW;
+    if (heap->bound && count > heap->bound - oldSize) return STATUS_ERR_FULL;
+
+    STATUS status = _ArrayList_reserve(arr, oldSize + count);
     if (status != STATUS_OK) return status;
 
-    if (size == 1) {
-        return ArrayList_delete(heap->arr, 0);
+    memcpy(_ArrayList_at(arr, oldSize), elements, count * heap->dataSize);
+    arr->size = oldSize + count;
+
+    // Sifting each new element up costs O(count log n); rebuilding the whole
+    // heap costs O(n). Rebuild once the batch is at least as large as the heap.
+    if (count >= oldSize) {
+        _Heap_heapify(heap);
+    } else {
+        for (size_t i = oldSize; i < arr->size; i++)
+            _Heap_siftUp(heap, i);
+    }
+    return STATUS_OK;
+}
+
+STATUS Heap_popMany(Heap* heap, void* elementsOut, size_t count) {
+    if (!heap || (!elementsOut && count > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+    if (count > Heap_size(heap)) return STATUS_ERR_UNDERFLOW;
+
+    char* out = (char*)elementsOut;
+    for (size_t i = 0; i < count; i++) {
+        STATUS status = _Heap_popRoot(heap, out + i * heap->dataSize);
+        if (status != STATUS_OK) return status;
+    }
+    return STATUS_OK;
+}
+
+STATUS Heap_offer(Heap* heap, const void* element) {
+    DSA_TRACE("Heap", "offer", heap);
+    if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    ArrayList* arr = heap->arr;
+    size_t size = arr->size;
+    if (!heap->bound) {
+        STATUS status = ArrayList_insert(arr, (void*)element);
+        if (status != STATUS_OK) return status;
+        _Heap_siftUp(heap, size);
+        return STATUS_OK;
+    }
+    if (size < heap->bound) {
+        // Bounded storage always has room for `bound` elements.
+        _Heap_copy(_ArrayList_at(arr, size), element, heap->dataSize);
+        arr->size = size + 1;
+        _Heap_siftUp(heap, size);
+        return STATUS_OK;
     }
-    
-    // The root is replaced by the last element, which is then sifted down.
-    if ((status = _Heap_swap(heap, 0, size - 1)) != STATUS_OK) return status;
-    if ((status = ArrayList_delete(heap->arr, size - 1)) != STATUS_OK) return status;
 
-    return _Heap_heapify_down(heap, 0);
+    // A full heap keeps the element only if it orders after the root, which it then replaces.
+    if (_Heap_compare(heap, element, _ArrayList_at(arr, 0)) <= 0) return STATUS_ERR_FULL;
+    _Heap_copy(heap->scratch, element, heap->dataSize);
+    _Heap_siftDown(heap, 0);
+    return STATUS_OK;
+}
+
+STATUS Heap_drainSorted(Heap* heap, void* out) {
+    if (!heap || (!out && Heap_size(heap) > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    // Pops in place: the storage is neither shrunk nor reallocated, so it is ready to refill.
+    ArrayList* arr = heap->arr;
+    char* dst = (char*)out;
+    size_t dataSize = heap->dataSize;
+    for (size_t size = arr->size; size > 0; size--, dst += dataSize) {
+        _Heap_copy(dst, _ArrayList_at(arr, 0), dataSize);
+        _Heap_copy(heap->scratch, _ArrayList_at(arr, size - 1), dataSize);
+        arr->size = size - 1;
+        if (size > 1) _Heap_siftDown(heap, 0);
+    }
+    return STATUS_OK;
 }
 
 STATUS Heap_peek(const Heap* heap, void* elementOut) {
@@ -201,6 +381,75 @@ STATUS Heap_peek(const Heap* heap, void* elementOut) {
     return ArrayList_get(heap->arr, 0, elementOut);
 }
 
+const void* Heap_top(const Heap* heap) {
+    if (!heap || Heap_size(heap) == 0) return NULL;
+    return _ArrayList_at(heap->arr, 0);
+}
+
+size_t Heap_arity(const Heap* heap) {
+    if (!heap) return 0;
+    return heap->arity;
+}
+
+size_t Heap_bound(const Heap* heap) {
+    if (!heap) return 0;
+    return heap->bound;
+}
+
 size_t Heap_size(const Heap* heap) {
     return ArrayList_size(heap->arr);
-}
\ No newline at end of file
+}
+
+STATUS Heap_getStats(const Heap* heap, DsaStats* statsOut) {
+    if (!heap || !statsOut) return STATUS_ERR_INVALID_ARGUMENT;
+
+    // Growth happens in the underlying list, so its reallocations count as the heap's.
+    DsaStats storage;
+    DSA_STATS_COPY(statsOut, heap);
+    DSA_STATS_COPY(&storage, heap->arr);
+    statsOut->reallocs += storage.reallocs;
+    statsOut->bytesMoved += storage.bytesMoved;
+    return STATUS_OK;
+}
+
+/* --------------------------------- Snapshots --------------------------------- */
+
+/**
+ * @internal
+ * @brief Wraps a list holding a heap's elements into a heap with the given arity.
+ * @details Takes ownership of `arr`, which must not be NULL, destroying it on failure.
+ */
+static Heap* _Heap_adopt(ArrayList* arr, int (*cmp)(const void* a, const void* b), uint32_t arity) {
+    Heap* heap = Heap_initWithArity(0, arr->dataSize, cmp, arity);
+    if (!heap) {
+        ArrayList_destroy(arr);
+        return NULL;
+    }
+    ArrayList_destroy(heap->arr);
+    heap->arr = arr;
+    return heap;
+}
+
+STATUS Heap_save(const Heap* heap, int fd) {
+    if (!heap || fd < 0) return STATUS_ERR_INVALID_ARGUMENT;
+
+    SnapshotInfo info = { SNAPSHOT_HEAP, (uint32_t)heap->arity, heap->dataSize, Heap_size(heap) };
+    STATUS status = _Snapshot_writeHeader(fd, &info);
+    if (status != STATUS_OK) return status;
+    return _Snapshot_write(fd, heap->arr->data, Heap_size(heap) * heap->dataSize);
+}
+
+Heap* Heap_load(int fd, int (*cmp)(const void* a, const void* b)) {
+    SnapshotInfo info;
+    if (fd < 0 || !cmp || _Snapshot_readHeader(fd, &info) != STATUS_OK || info.kind != SNAPSHOT_HEAP)
+        return NULL;
+    ArrayList* arr = _ArrayList_readSnapshot(fd, &info);
+    return arr ? _Heap_adopt(arr, cmp, info.param) : NULL;
+}
+
+Heap* Heap_mapFile(const char* path, size_t dataSize, int (*cmp)(const void* a, const void* b)) {
+    SnapshotInfo info;
+    if (!path || dataSize == 0 || !cmp) return NULL;
+    ArrayList* arr = _ArrayList_mapSnapshot(path, dataSize, SNAPSHOT_HEAP, &info);
+    return arr ? _Heap_adopt(arr, cmp, info.param) : NULL;
+}
@@ -0,0 +1,332 @@
+#include "../include/indexedheap.h"
+
+/**
+ * @struct IndexedHeap
+ * @brief Defines the internal structure of the indexed heap.
+ * @details Elements live in `slots`, addressed by handle, and never move while
+ * they are in the heap. The binary heap itself (`order`) only permutes handles,
+ * and `position` maps each handle back to its index in `order`. Released
+ * handles are kept on a stack in `freeHandles` for reuse.
+ */
+struct IndexedHeap {
+    char* slots;                                // Element storage, indexed by handle (capacity * dataSize bytes).
+    size_t* order;                              // The heap array of handles.
+    size_t* position;                           // position[handle] = index in `order`, or INDEXEDHEAP_FREE.
+    size_t* freeHandles;                        // Stack of released handles.
+    size_t size;                                // The number of elements in the heap.
+    size_t handleCount;                         // The number of distinct handles ever issued.
+    size_t freeCount;                           // The number of handles on the free stack.
+    size_t capacity;                            // The number of handles the arrays can hold.
+    size_t dataSize;                            // The size in bytes of a single element.
+    int (*cmp)(const void* a, const void* b);   // A function pointer to compare two elements, defining the heap order.
+};
+
+/** @internal Constants */
+
+/**
+ * @brief Position map marker for a handle that is not in the heap.
+ */
+#define INDEXEDHEAP_FREE SIZE_MAX
+
+/**
+ * @brief The capacity allocated on the first push into a heap created without one.
+ */
+#define INDEXEDHEAP_DEFAULT_CAPACITY 8
+
+/** @internal Macros for calculating parent and child indices in the heap array. */
+#define IH_PARENT(i) (((i) - 1) / 2)
+#define IH_LEFT_CHILD(i) (2 * (i) + 1)
+#define IH_RIGHT_CHILD(i) (2 * (i) + 2)
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+/**
+ * @internal
+ * @brief Returns the address of the element stored under `handle`.
+ */
+static inline void* _IndexedHeap_slot(const IndexedHeap* heap, size_t handle)
+{
+    return heap->slots + handle * heap->dataSize;
+}
+
+/**
+ * @internal
+ * @brief Checks whether `handle` refers to an element currently in the heap.
+ */
+static inline bool _IndexedHeap_isLive(const IndexedHeap* heap, size_t handle)
+{
+    return handle < heap->handleCount && heap->position[handle] != INDEXEDHEAP_FREE;
+}
+
+/**
+ * @internal
+ * @brief Grows all internal arrays to `newCapacity` handles.
+ * @details Each array is reallocated independently; if one fails, the ones that
+ * already grew stay valid and `capacity` is left unchanged.
+ * @return `true` on success, `false` on allocation failure.
+ */
+static bool _IndexedHeap_realloc(IndexedHeap* heap, size_t newCapacity)
+{
+    char* slots = realloc(heap->slots, newCapacity * heap->dataSize);
+    if (!slots) return false;
+    heap->slots = slots;
+
+    size_t* order = realloc(heap->order, newCapacity * sizeof(size_t));
+    if (!order) return false;
+    heap->order = order;
+
+    size_t* position = realloc(heap->position, newCapacity * sizeof(size_t));
+    if (!position) return false;
+    heap->position = position;
+
+    size_t* freeHandles = realloc(heap->freeHandles, newCapacity * sizeof(size_t));
+    if (!freeHandles) return false;
+    heap->freeHandles = freeHandles;
+
+    heap->capacity = newCapacity;
+    return true;
+}
+
+/**
+ * @internal
+ * @brief Moves the handle at heap index `index` towards the root.
+ * @details Parents that order after it are shifted down into the hole and the
+ * position map is updated for every handle that moves.
+ */
+static void _IndexedHeap_siftUp(IndexedHeap* heap, size_t index)
+{
+    size_t handle = heap->order[index];
+    const void* item = _IndexedHeap_slot(heap, handle);
+
+    while (index > 0) {
+        size_t parentIndex = IH_PARENT(index);
+        size_t parentHandle = heap->order[parentIndex];
+        if (heap->cmp(item, _IndexedHeap_slot(heap, parentHandle)) >= 0) break;
+        heap->order[index] = parentHandle;
+        heap->position[parentHandle] = index;
+        index = parentIndex;
+    }
+    heap->order[index] = handle;
+    heap->position[handle] = index;
+}
+
+/**
+ * @internal
+ * @brief Moves the handle at heap index `index` away from the root.
+ */
+static void _IndexedHeap_siftDown(IndexedHeap* heap, size_t index)
+{
+    size_t handle = heap->order[index];
+    const void* item = _IndexedHeap_slot(heap, handle);
+
+    size_t child;
+    while ((child = IH_LEFT_CHILD(index)) < heap->size) {
+        size_t childHandle = heap->order[child];
+        size_t right = IH_RIGHT_CHILD(index);
+        if (right < heap->size) {
+            size_t rightHandle = heap->order[right];
+            if (heap->cmp(_IndexedHeap_slot(heap, rightHandle), _IndexedHeap_slot(heap, childHandle)) < 0) {
+                child = right;
+                childHandle = rightHandle;
+            }
+        }
+        if (heap->cmp(_IndexedHeap_slot(heap, childHandle), item) >= 0) break;
+        heap->order[index] = childHandle;
+        heap->position[childHandle] = index;
+        index = child;
+    }
+    heap->order[index] = handle;
+    heap->position[handle] = index;
+}
+
+/**
+ * @internal
+ * @brief Restores heap order for a handle whose element changed in either direction.
+ */
+static void _IndexedHeap_fix(IndexedHeap* heap, size_t index)
+{
+    if (index > 0) {
+        const void* item = _IndexedHeap_slot(heap, heap->order[index]);
+        const void* parent = _IndexedHeap_slot(heap, heap->order[IH_PARENT(index)]);
+        if (heap->cmp(item, parent) < 0) {
+            _IndexedHeap_siftUp(heap, index);
+            return;
+        }
+    }
+    _IndexedHeap_siftDown(heap, index);
+}
+
+/**
+ * @internal
+ * @brief Unlinks the element at heap index `index` and releases its handle.
+ */
+static void _IndexedHeap_removeAt(IndexedHeap* heap, size_t index, void* elementOut)
+{
+    size_t handle = heap->order[index];
+    if (elementOut) memcpy(elementOut, _IndexedHeap_slot(heap, handle), heap->dataSize);
+
+    // Fill the hole with the last handle and re-establish its position.
+    heap->size--;
+    if (index != heap->size) {
+        heap->order[index] = heap->order[heap->size];
+        heap->position[heap->order[index]] = index;
+        _IndexedHeap_fix(heap, index);
+    }
+
+    heap->position[handle] = INDEXEDHEAP_FREE;
+    heap->freeHandles[heap->freeCount++] = handle;
+}
+
+/* ----------------------------- Public API Functions ----------------------------- */
+
+IndexedHeap* IndexedHeap_init(size_t capacity, size_t dataSize, int (*cmp)(const void* a, const void* b))
+{
+    if (dataSize == 0 || !cmp) return NULL;
+
+    IndexedHeap* heap = malloc(sizeof(IndexedHeap));
+    if (!heap) return NULL;
+
+    heap->slots = NULL;
+    heap->order = NULL;
+    heap->position = NULL;
+    heap->freeHandles = NULL;
+    heap->size = 0;
+    heap->handleCount = 0;
+    heap->freeCount = 0;
+    heap->capacity = 0;
+    heap->dataSize = dataSize;
+    heap->cmp = cmp;
+
+    if (capacity > 0) {
+        if (capacity > SIZE_MAX / dataSize || capacity > SIZE_MAX / sizeof(size_t)
+                || !_IndexedHeap_realloc(heap, capacity)) {
+            IndexedHeap_destroy(heap);
+            return NULL;
+        }
+    }
+    return heap;
+}
+
+void IndexedHeap_destroy(IndexedHeap* heap)
+{
+    if (!heap) return;
+    free(heap->slots);
+    free(heap->order);
+    free(heap->position);
+    free(heap->freeHandles);
+    free(heap);
+}
+
+STATUS IndexedHeap_push(IndexedHeap* heap, const void* element, size_t* handleOut)
+{
+    if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+
+    size_t handle;
+    if (heap->freeCount > 0) {
+        handle = heap->freeHandles[--heap->freeCount];
+    } else {
+        if (heap->handleCount == heap->capacity) {
+            if (heap->capacity > SIZE_MAX / 2) return STATUS_ERR_OVERFLOW;
+            size_t newCapacity = heap->capacity == 0 ? INDEXEDHEAP_DEFAULT_CAPACITY : heap->capacity * 2;
+            if (newCapacity > SIZE_MAX / heap->dataSize || newCapacity > SIZE_MAX / sizeof(size_t))
+                return STATUS_ERR_OVERFLOW;
+            if (!_IndexedHeap_realloc(heap, newCapacity)) return STATUS_ERR_ALLOC;
+        }
+        handle = heap->handleCount++;
+    }
+
+    memcpy(_IndexedHeap_slot(heap, handle), element, heap->dataSize);
+    heap->order[heap->size] = handle;
+    heap->position[handle] = heap->size;
+    heap->size++;
+    _IndexedHeap_siftUp(heap, heap->size - 1);
+
+    if (handleOut) *handleOut = handle;
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_pop(IndexedHeap* heap, void* elementOut, size_t* handleOut)
+{
+    if (!heap || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+    if (heap->size == 0) return STATUS_ERR_UNDERFLOW;
+
+    if (handleOut) *handleOut = heap->order[0];
+    _IndexedHeap_removeAt(heap, 0, elementOut);
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_peek(const IndexedHeap* heap, void* elementOut, size_t* handleOut)
+{
+    if (!heap || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+    if (heap->size == 0) return STATUS_ERR_EMPTY;
+
+    memcpy(elementOut, _IndexedHeap_slot(heap, heap->order[0]), heap->dataSize);
+    if (handleOut) *handleOut = heap->order[0];
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_get(const IndexedHeap* heap, size_t handle, void* elementOut)
+{
+    if (!heap || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+    if (!_IndexedHeap_isLive(heap, handle)) return STATUS_ERR_KEY_NOT_FOUND;
+
+    memcpy(elementOut, _IndexedHeap_slot(heap, handle), heap->dataSize);
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_decreaseKey(IndexedHeap* heap, size_t handle, const void* element)
+{
+    if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    if (!_IndexedHeap_isLive(heap, handle)) return STATUS_ERR_KEY_NOT_FOUND;
+
+    void* slot = _IndexedHeap_slot(heap, handle);
+    if (heap->cmp(element, slot) > 0) return STATUS_ERR_INVALID_ARGUMENT;
+
+    memcpy(slot, element, heap->dataSize);
+    _IndexedHeap_siftUp(heap, heap->position[handle]);
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_increaseKey(IndexedHeap* heap, size_t handle, const void* element)
+{
+    if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    if (!_IndexedHeap_isLive(heap, handle)) return STATUS_ERR_KEY_NOT_FOUND;
+
+    void* slot = _IndexedHeap_slot(heap, handle);
+    if (heap->cmp(element, slot) < 0) return STATUS_ERR_INVALID_ARGUMENT;
+
+    memcpy(slot, element, heap->dataSize);
+    _IndexedHeap_siftDown(heap, heap->position[handle]);
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_update(IndexedHeap* heap, size_t handle, const void* element)
+{
+    if (!heap || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    if (!_IndexedHeap_isLive(heap, handle)) return STATUS_ERR_KEY_NOT_FOUND;
+
+    memcpy(_IndexedHeap_slot(heap, handle), element, heap->dataSize);
+    _IndexedHeap_fix(heap, heap->position[handle]);
+    return STATUS_OK;
+}
+
+STATUS IndexedHeap_remove(IndexedHeap* heap, size_t handle, void* elementOut)
+{
+    if (!heap) return STATUS_ERR_INVALID_ARGUMENT;
+    if (!_IndexedHeap_isLive(heap, handle)) return STATUS_ERR_KEY_NOT_FOUND;
+
+    _IndexedHeap_removeAt(heap, heap->position[handle], elementOut);
+    return STATUS_OK;
+}
+
+bool IndexedHeap_contains(const IndexedHeap* heap, size_t handle)
+{
+    if (!heap) return false;
+    return _IndexedHeap_isLive(heap, handle);
+}
+
+size_t IndexedHeap_size(const IndexedHeap* heap)
+{
+    if (!heap) return 0;
+    return heap->size;
+}
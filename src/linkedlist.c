@@ -1,4 +1,6 @@
 #include "../include/linkedlist.h"
+#include "../include/pool.h"
+#include "allocator_internal.h"
 
 /**
  * @internal
@@ -7,8 +9,9 @@
  */
 typedef struct ListNode
 {
-    void* data;             // Pointer to the stored data, which is heap-allocated.
     struct ListNode* next;  // Pointer to the next node in the list.
+    struct ListNode* prev;  // Pointer to the previous node in the list.
+    unsigned char data[];   // The stored element, inline in the same allocation as the node.
 } ListNode;
 
 /**
@@ -19,8 +22,11 @@ typedef struct ListNode
 struct LinkedList
 {
     ListNode* head;     // Pointer to the first node in the list.
+    ListNode* tail;     // Pointer to the last node in the list.
     size_t dataSize;    // The size in bytes of the data stored in each node.
     size_t size;        // The current number of nodes in the list.
+    Pool* pool;         // Node allocator when the list is pooled, otherwise `NULL`.
+    DsaAllocator allocator; // Where the struct and (unless pooled) the nodes are allocated.
 };
 
 /* --------------------------- Private Helper Functions --------------------------- */
@@ -28,41 +34,143 @@ struct LinkedList
 /**
  * @internal
  * @brief Creates and allocates a new linked list node.
- * @details This function allocates memory for the node structure itself and for
- * the data it contains, then copies the provided element data into the new node.
+ * @details The node and its element are a single block, taken from the list's
+ * pool when it has one and from its allocator otherwise, and the provided
+ * element data is copied into it.
  * @param list The list instance, used to determine the data size.
  * @param element A pointer to the element data to be copied.
  * @return A pointer to the newly created ListNode on success, or `NULL` on memory allocation failure.
  */
-static ListNode* _LinkedList_getNewNode(LinkedList* list, void* element)
+static ListNode* _LinkedList_getNewNode(LinkedList* list, const void* element)
 {
-    ListNode* newNode = (ListNode* )malloc(sizeof(ListNode));
+    ListNode* newNode = list->pool
+        ? Pool_alloc(list->pool)
+        : _Dsa_alloc(&list->allocator, sizeof(ListNode) + list->dataSize);
     if (!newNode) return NULL;
 
-    newNode->data = malloc(list->dataSize);
-    if (!newNode->data)
-    {
-        free(newNode);
-        return NULL;
-    }
-
     memcpy(newNode->data, element, list->dataSize);
     newNode->next = NULL;
+    newNode->prev = NULL;
     return newNode;
 }
 
+/**
+ * @internal
+ * @brief Releases a node back to wherever it was allocated from.
+ */
+static void _LinkedList_freeNode(LinkedList* list, ListNode* node)
+{
+    if (list->pool) Pool_free(list->pool, node);
+    else _Dsa_free(&list->allocator, node, sizeof(ListNode) + list->dataSize);
+}
+
+/**
+ * @internal
+ * @brief Returns the node at a 1-based index, walking from whichever end is closer.
+ * @details The index must already be validated against the list size.
+ */
+static ListNode* _LinkedList_nodeAt(const LinkedList* list, size_t index)
+{
+    ListNode* node;
+    if (index <= list->size / 2 + 1) {
+        node = list->head;
+        for (size_t i = 1; i < index; i++)
+            node = node->next;
+    } else {
+        node = list->tail;
+        for (size_t i = list->size; i > index; i--)
+            node = node->prev;
+    }
+    return node;
+}
+
+/**
+ * @internal
+ * @brief Allocates a node for `element` and links it in front of `next`
+ * (at the tail when `next` is NULL).
+ */
+static STATUS _LinkedList_insertBefore(LinkedList* list, ListNode* next, const void* element)
+{
+    if (list->size > SIZE_MAX / 2)
+        return STATUS_ERR_OVERFLOW; // Cannot grow further.
+
+    ListNode* newNode = _LinkedList_getNewNode(list, element);
+    if (!newNode) return STATUS_ERR_ALLOC;
+
+    ListNode* prev = next ? next->prev : list->tail;
+    newNode->next = next;
+    newNode->prev = prev;
+    if (prev) prev->next = newNode;
+    else list->head = newNode;
+    if (next) next->prev = newNode;
+    else list->tail = newNode;
+
+    list->size++;
+    return STATUS_OK;
+}
+
+/**
+ * @internal
+ * @brief Unlinks `node`, optionally copies its element out, and frees it.
+ */
+static void _LinkedList_unlink(LinkedList* list, ListNode* node, void* elementOut)
+{
+    if (node->prev) node->prev->next = node->next;
+    else list->head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else list->tail = node->prev;
+
+    if (elementOut) memcpy(elementOut, node->data, list->dataSize);
+    _LinkedList_freeNode(list, node);
+    list->size--;
+}
+
+/**
+ * @internal
+ * @brief Checks whether all nodes of `src` may be relinked into `dst`.
+ * @details Pooled nodes belong to their list's private pool, and other nodes
+ * to their list's allocator, so they cannot change owners without being copied.
+ */
+static bool _LinkedList_canRelink(const LinkedList* dst, const LinkedList* src)
+{
+    return dst != src && dst->dataSize == src->dataSize && !dst->pool && !src->pool &&
+        _Dsa_sameAllocator(&dst->allocator, &src->allocator);
+}
+
 /* ----------------------------- Public API Functions ----------------------------- */
 
 LinkedList* LinkedList_init(size_t dataSize)
 {
-    if (dataSize == 0) return NULL;
+    return LinkedList_initWithAllocator(dataSize, NULL);
+}
+
+LinkedList* LinkedList_initWithAllocator(size_t dataSize, const DsaAllocator* allocator)
+{
+    allocator = _Dsa_resolve(allocator);
+    if (!allocator || dataSize == 0 || dataSize > SIZE_MAX - sizeof(ListNode)) return NULL;
 
-    LinkedList* list = (LinkedList*)malloc(sizeof(LinkedList));
+    LinkedList* list = _Dsa_alloc(allocator, sizeof(LinkedList));
     if (!list) return NULL;
 
     list->head = NULL;
+    list->tail = NULL;
     list->dataSize = dataSize;
     list->size = 0;
+    list->pool = NULL;
+    list->allocator = *allocator;
+    return list;
+}
+
+LinkedList* LinkedList_initPooled(size_t dataSize, size_t nodesPerChunk)
+{
+    LinkedList* list = LinkedList_init(dataSize);
+    if (!list) return NULL;
+
+    list->pool = Pool_init(sizeof(ListNode) + dataSize, nodesPerChunk);
+    if (!list->pool) {
+        _Dsa_free(&list->allocator, list, sizeof(LinkedList));
+        return NULL;
+    }
     return list;
 }
 
@@ -70,33 +178,63 @@ void LinkedList_destroy(LinkedList* list)
 {
     if (!list) return;
 
+    DsaAllocator allocator = list->allocator;
+    if (list->pool) {
+        // Every node lives in the pool's chunks; release them wholesale.
+        Pool_destroy(list->pool);
+        list->pool = NULL;
+        _Dsa_free(&allocator, list, sizeof(LinkedList));
+        return;
+    }
+
+    // A bulk allocator reclaims the nodes itself; there is nothing to walk.
     ListNode* current;
-    while (list->head != NULL)
+    while (_Dsa_freesIndividually(&allocator) && list->head != NULL)
     {
         current = list->head;
         list->head = list->head->next;
-        free(current->data);
-        current->data = NULL;
-        free(current);
+        _Dsa_free(&allocator, current, sizeof(ListNode) + list->dataSize);
         current = NULL;
     }
-    free(list);
+    _Dsa_free(&allocator, list, sizeof(LinkedList));
 }
 
 STATUS LinkedList_insert(LinkedList* list, void* element)
+{
+    return LinkedList_pushFront(list, element);
+}
+
+STATUS LinkedList_pushFront(LinkedList* list, const void* element)
 {
     if (!list || !element) return STATUS_ERR_INVALID_ARGUMENT;
 
-    if (list->size > SIZE_MAX / 2)
-        return STATUS_ERR_OVERFLOW; // Cannot grow further.
+    // New node becomes the new head.
+    return _LinkedList_insertBefore(list, list->head, element);
+}
 
-    ListNode* newNode = _LinkedList_getNewNode(list, element);
-    if (!newNode) return STATUS_ERR_ALLOC;
+STATUS LinkedList_pushBack(LinkedList* list, const void* element)
+{
+    if (!list || !element) return STATUS_ERR_INVALID_ARGUMENT;
 
-    // New node becomes the new head.
-    newNode->next = list->head;
-    list->head = newNode;
-    list->size++;
+    // New node becomes the new tail.
+    return _LinkedList_insertBefore(list, NULL, element);
+}
+
+STATUS LinkedList_popFront(LinkedList* list, void* elementOut)
+{
+    if (!list) return STATUS_ERR_INVALID_ARGUMENT;
+    if (list->size == 0) return STATUS_ERR_UNDERFLOW;
+
+    _LinkedList_unlink(list, list->head, elementOut);
+    return STATUS_OK;
+}
+
+STATUS LinkedList_popBack(LinkedList* list, void* elementOut)
+{
+    if (!list) return STATUS_ERR_INVALID_ARGUMENT;
+    if (list->size == 0) return STATUS_ERR_UNDERFLOW;
+
+    _LinkedList_unlink(list, list->tail, elementOut);
     return STATUS_OK;
 }
 
@@ -104,36 +242,14 @@ STATUS LinkedList_delete(LinkedList* list, size_t index)
 {
     if (!list)
         return STATUS_ERR_INVALID_ARGUMENT;
-    
+
     if (list->size == 0)
         return STATUS_ERR_UNDERFLOW;
 
     if (index < 1 || index > list->size)
         return STATUS_ERR_INVALID_ARGUMENT;
 
-    ListNode* temp1 = list->head;
-    ListNode* temp2 = NULL;
-
-    // Case for deleting the head node.
-    if (index == 1)
-    {
-        list->head = temp1->next;
-        free(temp1->data);
-        free(temp1);
-        list->size--;
-        return STATUS_OK;
-    }
-
-    // Traverse to the node just before the one to be deleted.
-    for (size_t i = 1; i < index - 1; i++)
-        temp1 = temp1->next;
-
-    // temp2 is the node to be deleted.
-    temp2 = temp1->next;
-    temp1->next = temp2->next;
-    free(temp2->data);
-    free(temp2);
-    list->size--;
+    _LinkedList_unlink(list, _LinkedList_nodeAt(list, index), NULL);
     return STATUS_OK;
 }
 
@@ -161,11 +277,7 @@ STATUS LinkedList_get(LinkedList* list, size_t index, void* elementOut)
     if (!list || !elementOut || index < 1 || index > list->size)
         return STATUS_ERR_INVALID_ARGUMENT;
 
-    ListNode* temp = list->head;
-    for (size_t i = 1; i < index; i++)
-        temp = temp->next;
-
-    memcpy(elementOut, temp->data, list->dataSize);
+    memcpy(elementOut, _LinkedList_nodeAt(list, index)->data, list->dataSize);
     return STATUS_OK;
 }
 
@@ -174,11 +286,7 @@ STATUS LinkedList_set(LinkedList* list, size_t index, void* element)
     if (!list || !element || index < 1 || index > list->size)
         return STATUS_ERR_INVALID_ARGUMENT;
 
-    ListNode* temp = list->head;
-    for (size_t i = 1; i < index; i++)
-        temp = temp->next;
-
-    memcpy(temp->data, element, list->dataSize);
+    memcpy(_LinkedList_nodeAt(list, index)->data, element, list->dataSize);
     return STATUS_OK;
 }
 
@@ -196,10 +304,106 @@ STATUS LinkedList_forEach(LinkedList* list, void (*callback)(void*))
     return STATUS_OK;
 }
 
+STATUS LinkedList_forEachCtx(LinkedList* list, bool (*callback)(void*, void*), void* ctx)
+{
+    if (!list || !callback) return STATUS_ERR_INVALID_ARGUMENT;
+
+    for (ListNode* current = list->head; current != NULL; current = current->next)
+    {
+        if (!callback(current->data, ctx))
+            break;
+    }
+
+    return STATUS_OK;
+}
+
 size_t LinkedList_size(const LinkedList* list)
 {
     if (!list) {
         return 0;
     }
     return list->size;
-}
\ No newline at end of file
+}
+
+/* --------------------------------- Splicing --------------------------------- */
+
+STATUS LinkedList_concat(LinkedList* dst, LinkedList* src)
+{
+    return LinkedList_splice(dst, NULL, src);
+}
+
+STATUS LinkedList_splice(LinkedList* dst, LinkedListNode* position, LinkedList* src)
+{
+    if (!dst || !src || !_LinkedList_canRelink(dst, src))
+        return STATUS_ERR_INVALID_ARGUMENT;
+    if (src->size == 0) return STATUS_OK;
+    if (dst->size > SIZE_MAX / 2 - src->size) return STATUS_ERR_OVERFLOW;
+
+    ListNode* next = position;
+    ListNode* prev = next ? next->prev : dst->tail;
+
+    src->head->prev = prev;
+    src->tail->next = next;
+    if (prev) prev->next = src->head;
+    else dst->head = src->head;
+    if (next) next->prev = src->tail;
+    else dst->tail = src->tail;
+
+    dst->size += src->size;
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+    return STATUS_OK;
+}
+
+/* --------------------------------- Cursors --------------------------------- */
+
+LinkedListNode* LinkedList_first(const LinkedList* list)
+{
+    return list ? list->head : NULL;
+}
+
+LinkedListNode* LinkedList_last(const LinkedList* list)
+{
+    return list ? list->tail : NULL;
+}
+
+LinkedListNode* LinkedList_nodeAt(const LinkedList* list, size_t index)
+{
+    if (!list || index < 1 || index > list->size) return NULL;
+    return _LinkedList_nodeAt(list, index);
+}
+
+LinkedListNode* LinkedList_next(const LinkedListNode* node)
+{
+    return node ? node->next : NULL;
+}
+
+LinkedListNode* LinkedList_prev(const LinkedListNode* node)
+{
+    return node ? node->prev : NULL;
+}
+
+void* LinkedList_nodeData(LinkedListNode* node)
+{
+    return node ? node->data : NULL;
+}
+
+STATUS LinkedList_insertBefore(LinkedList* list, LinkedListNode* node, const void* element)
+{
+    if (!list || !node || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    return _LinkedList_insertBefore(list, node, element);
+}
+
+STATUS LinkedList_insertAfter(LinkedList* list, LinkedListNode* node, const void* element)
+{
+    if (!list || !node || !element) return STATUS_ERR_INVALID_ARGUMENT;
+    return _LinkedList_insertBefore(list, node->next, element);
+}
+
+STATUS LinkedList_removeNode(LinkedList* list, LinkedListNode* node, void* elementOut)
+{
+    if (!list || !node) return STATUS_ERR_INVALID_ARGUMENT;
+    _LinkedList_unlink(list, node, elementOut);
+    return STATUS_OK;
+}
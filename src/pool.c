@@ -0,0 +1,144 @@
+#include "../include/pool.h"
+
+/**
+ * @internal
+ * @struct PoolChunk
+ * @brief Header of one large allocation from which blocks are carved.
+ * @details The blocks follow the header directly; the union pads the header so
+ * the first block is aligned like `max_align_t`.
+ */
+typedef union PoolChunk
+{
+    union PoolChunk* next;  // The previously allocated chunk.
+    max_align_t align;      // Forces the blocks that follow to be maximally aligned.
+} PoolChunk;
+
+/**
+ * @internal
+ * @struct PoolFreeBlock
+ * @brief Overlay for a block that is on the free list.
+ */
+typedef struct PoolFreeBlock
+{
+    struct PoolFreeBlock* next; // The next free block.
+} PoolFreeBlock;
+
+/**
+ * @internal
+ * @struct Pool
+ * @brief Defines the internal structure of the Pool.
+ * @details Blocks are handed out from the free list first. When it is empty,
+ * the next untouched block of the newest chunk is used, so a chunk's pages are
+ * only touched as they are needed.
+ */
+struct Pool
+{
+    PoolChunk* chunks;          // Singly-linked list of all chunks, newest first.
+    PoolFreeBlock* freeList;    // Blocks returned with Pool_free.
+    char* bumpNext;             // The next never-used block in the newest chunk.
+    char* bumpEnd;              // One past the last block in the newest chunk.
+    size_t blockSize;           // The aligned size of a single block.
+    size_t blocksPerChunk;      // The number of blocks carved from each chunk.
+};
+
+/** @internal Constants */
+
+/**
+ * @brief The approximate chunk size used when the caller does not choose one.
+ */
+#define POOL_DEFAULT_CHUNK_BYTES (64 * 1024)
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+/**
+ * @internal
+ * @brief Allocates a new chunk and makes it the bump region.
+ * @return `true` on success, `false` on allocation failure.
+ */
+static bool _Pool_addChunk(Pool* pool)
+{
+    PoolChunk* chunk = malloc(sizeof(PoolChunk) + pool->blockSize * pool->blocksPerChunk);
+    if (!chunk) return false;
+
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+    pool->bumpNext = (char*)(chunk + 1);
+    pool->bumpEnd = pool->bumpNext + pool->blockSize * pool->blocksPerChunk;
+    return true;
+}
+
+/* ----------------------------- Public API Functions ----------------------------- */
+
+Pool* Pool_init(size_t blockSize, size_t blocksPerChunk)
+{
+    if (blockSize == 0) return NULL;
+
+    // Every block must be able to hold a free-list link and keep the next block aligned.
+    size_t align = _Alignof(max_align_t);
+    if (blockSize < sizeof(PoolFreeBlock)) blockSize = sizeof(PoolFreeBlock);
+    if (blockSize > SIZE_MAX - align) return NULL;
+    blockSize = (blockSize + align - 1) / align * align;
+
+    if (blocksPerChunk == 0) {
+        blocksPerChunk = POOL_DEFAULT_CHUNK_BYTES / blockSize;
+        if (blocksPerChunk < 8) blocksPerChunk = 8;
+    }
+    if (blocksPerChunk > (SIZE_MAX - sizeof(PoolChunk)) / blockSize) return NULL;
+
+    Pool* pool = malloc(sizeof(Pool));
+    if (!pool) return NULL;
+
+    pool->chunks = NULL;
+    pool->freeList = NULL;
+    pool->bumpNext = NULL;
+    pool->bumpEnd = NULL;
+    pool->blockSize = blockSize;
+    pool->blocksPerChunk = blocksPerChunk;
+    return pool;
+}
+
+void Pool_destroy(Pool* pool)
+{
+    if (!pool) return;
+
+    PoolChunk* chunk = pool->chunks;
+    while (chunk) {
+        PoolChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(pool);
+}
+
+void* Pool_alloc(Pool* pool)
+{
+    if (!pool) return NULL;
+
+    if (pool->freeList) {
+        PoolFreeBlock* block = pool->freeList;
+        pool->freeList = block->next;
+        return block;
+    }
+
+    if (pool->bumpNext == pool->bumpEnd && !_Pool_addChunk(pool))
+        return NULL;
+
+    void* block = pool->bumpNext;
+    pool->bumpNext += pool->blockSize;
+    return block;
+}
+
+void Pool_free(Pool* pool, void* block)
+{
+    if (!pool || !block) return;
+
+    PoolFreeBlock* freeBlock = block;
+    freeBlock->next = pool->freeList;
+    pool->freeList = freeBlock;
+}
+
+size_t Pool_blockSize(const Pool* pool)
+{
+    if (!pool) return 0;
+    return pool->blockSize;
+}
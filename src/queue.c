@@ -4,62 +4,204 @@
  * @internal
  * @struct Queue
  * @brief Defines the internal structure of the Queue.
+ * @details Elements are stored inline in a contiguous circular buffer whose
+ * capacity is always a power of two, so a logical position maps to a slot
+ * with a single mask instead of a modulo.
  */
 struct Queue{
-    LinkedList* list;   // A pointer to the underlying LinkedList used for storage.
+    void* data;         // Contiguous ring buffer of `capacity * dataSize` bytes.
+    size_t dataSize;    // The size in bytes of a single element.
+    size_t capacity;    // The number of slots in the ring (0 or a power of two).
+    size_t head;        // The slot index of the front element.
+    size_t size;        // The current number of elements in the queue.
 };
 
-Queue* Queue_init(size_t dataSize) 
+/** @internal Constants */
+
+/**
+ * @brief The capacity allocated on the first enqueue into a queue created without one.
+ */
+#define QUEUE_DEFAULT_CAPACITY 8
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+/**
+ * @internal
+ * @brief Returns the address of the slot at logical position `pos` from the front.
+ */
+static inline void* _Queue_slot(const Queue* queue, size_t pos)
+{
+    return (char*)queue->data + ((queue->head + pos) & (queue->capacity - 1)) * queue->dataSize;
+}
+
+/**
+ * @internal
+ * @brief Rounds `n` up to the next power of two.
+ * @return The rounded value, or 0 if it cannot be represented.
+ */
+static size_t _Queue_roundUpPow2(size_t n)
 {
+    size_t pow2 = 1;
+    while (pow2 < n) {
+        if (pow2 > SIZE_MAX / 2) return 0;
+        pow2 <<= 1;
+    }
+    return pow2;
+}
+
+/**
+ * @internal
+ * @brief Doubles the capacity of the ring and relinks the wrapped region.
+ * @details After `realloc`, the elements that wrapped around to the start of the
+ * old buffer are no longer contiguous with the front segment. Whichever of the
+ * two segments is shorter is moved so the ring is contiguous modulo the new capacity.
+ * @return `STATUS_OK`, `STATUS_ERR_OVERFLOW` or `STATUS_ERR_ALLOC`.
+ */
+static STATUS _Queue_grow(Queue* queue)
+{
+    size_t oldCapacity = queue->capacity;
+    size_t newCapacity = oldCapacity == 0 ? QUEUE_DEFAULT_CAPACITY : oldCapacity * 2;
+
+    if (oldCapacity > SIZE_MAX / 2 || newCapacity > SIZE_MAX / queue->dataSize)
+        return STATUS_ERR_OVERFLOW;
+
+    void* newData = realloc(queue->data, newCapacity * queue->dataSize);
+    if (!newData) return STATUS_ERR_ALLOC;
+
+    queue->data = newData;
+    queue->capacity = newCapacity;
+
+    // The ring was full, so the front segment is [head, oldCapacity) and the
+    // wrapped segment is [0, head).
+    size_t frontCount = oldCapacity - queue->head;
+    size_t wrappedCount = queue->head;
+    if (wrappedCount == 0) return STATUS_OK;
+
+    char* base = (char*)queue->data;
+    if (wrappedCount <= frontCount) {
+        // Move the wrapped prefix right after the old end.
+        memcpy(base + oldCapacity * queue->dataSize, base, wrappedCount * queue->dataSize);
+    } else {
+        // Move the front segment to the end of the new buffer.
+        size_t newHead = newCapacity - frontCount;
+        memcpy(base + newHead * queue->dataSize,
+               base + queue->head * queue->dataSize,
+               frontCount * queue->dataSize);
+        queue->head = newHead;
+    }
+    return STATUS_OK;
+}
+
+/* ----------------------------- Public API Functions ----------------------------- */
+
+Queue* Queue_init(size_t dataSize)
+{
+    return Queue_initWithCapacity(0, dataSize);
+}
+
+Queue* Queue_initWithCapacity(size_t capacity, size_t dataSize)
+{
+    if (dataSize == 0) return NULL;
+
     Queue* queue = malloc(sizeof(Queue));
     if (!queue) return NULL;
 
-    queue->list = LinkedList_init(dataSize);
-    if (!queue->list) {
-        free(queue);
-        return NULL;
+    queue->data = NULL;
+    queue->dataSize = dataSize;
+    queue->capacity = 0;
+    queue->head = 0;
+    queue->size = 0;
+
+    // Allocation is deferred until the first enqueue when no capacity is requested.
+    if (capacity > 0) {
+        size_t rounded = _Queue_roundUpPow2(capacity);
+        if (rounded == 0 || rounded > SIZE_MAX / dataSize) {
+            free(queue);
+            return NULL;
+        }
+        queue->data = malloc(rounded * dataSize);
+        if (!queue->data) {
+            free(queue);
+            return NULL;
+        }
+        queue->capacity = rounded;
     }
 
     return queue;
 }
 
-void Queue_destroy(Queue* queue) 
+void Queue_destroy(Queue* queue)
 {
     if (!queue) return;
-    LinkedList_destroy(queue->list);
-    queue->list = NULL;
+    free(queue->data);
+    queue->data = NULL;
     free(queue);
 }
 
-bool Queue_isEmpty(Queue* queue) 
+bool Queue_isEmpty(Queue* queue)
 {
     if (!queue) return true;
-    return LinkedList_size(queue->list) == 0;
+    return queue->size == 0;
+}
+
+size_t Queue_size(const Queue* queue)
+{
+    if (!queue) return 0;
+    return queue->size;
+}
+
+size_t Queue_capacity(const Queue* queue)
+{
+    if (!queue) return 0;
+    return queue->capacity;
 }
 
-STATUS Queue_enqueue(Queue* queue, void* element) 
+STATUS Queue_enqueue(Queue* queue, void* element)
 {
     if (!queue || !element) return STATUS_ERR_INVALID_ARGUMENT;
-    return LinkedList_insert(queue->list, element);
+
+    if (queue->size == queue->capacity) {
+        STATUS status = _Queue_grow(queue);
+        if (status != STATUS_OK) return status;
+    }
+
+    memcpy(_Queue_slot(queue, queue->size), element, queue->dataSize);
+    queue->size++;
+    return STATUS_OK;
 }
 
-STATUS Queue_dequeue(Queue* queue) 
+STATUS Queue_dequeue(Queue* queue)
 {
     if (!queue) return STATUS_ERR_INVALID_ARGUMENT;
-    if (Queue_isEmpty(queue)) return STATUS_ERR_UNDERFLOW;
+    if (queue->size == 0) return STATUS_ERR_UNDERFLOW;
 
-    // PERFORMANCE NOTE: Dequeue removes from the tail of the list.
-    // In a singly-linked list without a tail pointer, this is an O(n) operation
-    // as it requires traversing the entire list to find the last element.
-    return LinkedList_delete(queue->list, LinkedList_size(queue->list));
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+    return STATUS_OK;
 }
 
-STATUS Queue_peek(Queue* queue, void* elementOut) 
+STATUS Queue_dequeueInto(Queue* queue, void* elementOut)
 {
     if (!queue || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
-    if (Queue_isEmpty(queue)) return STATUS_ERR_EMPTY;
+    if (queue->size == 0) return STATUS_ERR_UNDERFLOW;
+
+    memcpy(elementOut, _Queue_slot(queue, 0), queue->dataSize);
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+    return STATUS_OK;
+}
 
-    // PERFORMANCE NOTE: Peeking the front of the queue requires getting the tail
-    // of the list. This is an O(n) operation in this implementation.
-    return LinkedList_get(queue->list, LinkedList_size(queue->list), elementOut);
+STATUS Queue_peek(Queue* queue, void* elementOut)
+{
+    if (!queue || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
+    if (queue->size == 0) return STATUS_ERR_EMPTY;
+
+    memcpy(elementOut, _Queue_slot(queue, 0), queue->dataSize);
+    return STATUS_OK;
+}
+
+void* Queue_front(const Queue* queue)
+{
+    if (!queue || queue->size == 0) return NULL;
+    return _Queue_slot(queue, 0);
 }
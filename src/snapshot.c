@@ -0,0 +1,122 @@
+#include "snapshot_internal.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** @internal Constants */
+
+static const char SNAPSHOT_MAGIC[8] = { 'D', 'S', 'A', 'S', 'N', 'A', 'P', '\0' };
+#define SNAPSHOT_VERSION 1u
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+/* --------------------------- Private Helper Functions --------------------------- */
+
+/**
+ * @internal
+ * @brief Decodes and validates a header held in memory.
+ */
+static STATUS _Snapshot_parseHeader(const unsigned char* bytes, SnapshotInfo* info)
+{
+    uint32_t version, byteOrder;
+    memcpy(&version, bytes + 8, 4);
+    memcpy(&byteOrder, bytes + 12, 4);
+    memcpy(&info->kind, bytes + 16, 4);
+    memcpy(&info->param, bytes + 20, 4);
+    memcpy(&info->dataSize, bytes + 24, 8);
+    memcpy(&info->count, bytes + 32, 8);
+
+    if (memcmp(bytes, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || version != SNAPSHOT_VERSION
+        || byteOrder != SNAPSHOT_BYTE_ORDER || info->dataSize == 0 || info->dataSize > SIZE_MAX
+        || info->count > (SIZE_MAX - SNAPSHOT_HEADER_SIZE) / info->dataSize)
+        return STATUS_ERR_INVALID_ARGUMENT;
+    return STATUS_OK;
+}
+
+/* ----------------------------- Shared Definitions ----------------------------- */
+
+STATUS _Snapshot_write(int fd, const void* data, size_t length)
+{
+    const unsigned char* bytes = data;
+    while (length > 0) {
+        ssize_t written = write(fd, bytes, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return STATUS_ERR_IO;
+        }
+        bytes += written;
+        length -= (size_t)written;
+    }
+    return STATUS_OK;
+}
+
+STATUS _Snapshot_read(int fd, void* data, size_t length)
+{
+    unsigned char* bytes = data;
+    while (length > 0) {
+        ssize_t got = read(fd, bytes, length);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return STATUS_ERR_IO;
+        }
+        if (got == 0) return STATUS_ERR_IO;
+        bytes += got;
+        length -= (size_t)got;
+    }
+    return STATUS_OK;
+}
+
+STATUS _Snapshot_writeHeader(int fd, const SnapshotInfo* info)
+{
+    unsigned char bytes[SNAPSHOT_HEADER_SIZE] = {0};
+    uint32_t version = SNAPSHOT_VERSION, byteOrder = SNAPSHOT_BYTE_ORDER;
+    memcpy(bytes, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    memcpy(bytes + 8, &version, 4);
+    memcpy(bytes + 12, &byteOrder, 4);
+    memcpy(bytes + 16, &info->kind, 4);
+    memcpy(bytes + 20, &info->param, 4);
+    memcpy(bytes + 24, &info->dataSize, 8);
+    memcpy(bytes + 32, &info->count, 8);
+    return _Snapshot_write(fd, bytes, sizeof(bytes));
+}
+
+STATUS _Snapshot_readHeader(int fd, SnapshotInfo* info)
+{
+    unsigned char bytes[SNAPSHOT_HEADER_SIZE];
+    STATUS status = _Snapshot_read(fd, bytes, sizeof(bytes));
+    if (status != STATUS_OK) return status;
+    return _Snapshot_parseHeader(bytes, info);
+}
+
+STATUS _Snapshot_map(const char* path, SnapshotInfo* info, void** baseOut, size_t* lengthOut)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return STATUS_ERR_IO;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return STATUS_ERR_IO;
+    }
+    if (st.st_size < SNAPSHOT_HEADER_SIZE || (uintmax_t)st.st_size > SIZE_MAX) {
+        close(fd);
+        return STATUS_ERR_INVALID_ARGUMENT;
+    }
+    size_t length = (size_t)st.st_size;
+
+    void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return STATUS_ERR_IO;
+
+    STATUS status = _Snapshot_parseHeader(base, info);
+    if (status == STATUS_OK && SNAPSHOT_HEADER_SIZE + info->count * info->dataSize > length)
+        status = STATUS_ERR_INVALID_ARGUMENT;
+    if (status != STATUS_OK || info->count == 0) {
+        munmap(base, length);
+        base = NULL;
+    }
+    *baseOut = base;
+    *lengthOut = base ? length : 0;
+    return status;
+}
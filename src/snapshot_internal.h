@@ -0,0 +1,102 @@
+/**
+ * @file snapshot_internal.h
+ * @internal
+ * @brief The binary snapshot format shared by the containers' save, load and mapFile functions.
+ *
+ * This header is not installed. A snapshot is a 64-byte header followed by
+ * `count` elements of `dataSize` bytes, back to back:
+ *
+ * | Offset | Size | Field                                              |
+ * |--------|------|----------------------------------------------------|
+ * | 0      | 8    | Magic `"DSASNAP\0"`                                |
+ * | 8      | 4    | Format version (1)                                 |
+ * | 12     | 4    | Byte order mark `0x01020304`, in the writer's order |
+ * | 16     | 4    | Container kind (`SnapshotKind`)                    |
+ * | 20     | 4    | Kind-specific parameter (the Heap's arity, else 0) |
+ * | 24     | 8    | `dataSize`                                         |
+ * | 32     | 8    | `count`                                            |
+ * | 40     | 24   | Zero                                               |
+ *
+ * Fields and elements are stored in the writer's native representation; a
+ * reader with the other byte order rejects the snapshot. Starting the payload
+ * at 64 bytes keeps it aligned for any element type when the file is mapped.
+ */
+#ifndef SNAPSHOT_INTERNAL_H
+#define SNAPSHOT_INTERNAL_H
+
+#include "../include/common.h"
+
+/**
+ * @internal
+ * @brief The size of the header, and the offset of the first element.
+ */
+#define SNAPSHOT_HEADER_SIZE 64
+
+/**
+ * @internal
+ * @brief The container a snapshot was saved from.
+ */
+typedef enum {
+    SNAPSHOT_ARRAYLIST = 1,
+    SNAPSHOT_HEAP = 2,
+    SNAPSHOT_AVLTREE = 3
+} SnapshotKind;
+
+/**
+ * @internal
+ * @brief The decoded fields of a snapshot header.
+ */
+typedef struct {
+    uint32_t kind;
+    uint32_t param;
+    uint64_t dataSize;
+    uint64_t count;
+} SnapshotInfo;
+
+/**
+ * @internal
+ * @brief Writes all `length` bytes, retrying short writes and interrupted calls.
+ * @return `STATUS_OK`, or `STATUS_ERR_IO`.
+ */
+STATUS _Snapshot_write(int fd, const void* data, size_t length);
+
+/**
+ * @internal
+ * @brief Reads exactly `length` bytes, retrying short reads and interrupted calls.
+ * @return `STATUS_OK`, or `STATUS_ERR_IO` on error or end of file.
+ */
+STATUS _Snapshot_read(int fd, void* data, size_t length);
+
+/**
+ * @internal
+ * @brief Writes a header for `info`.
+ * @return `STATUS_OK`, or `STATUS_ERR_IO`.
+ */
+STATUS _Snapshot_writeHeader(int fd, const SnapshotInfo* info);
+
+/**
+ * @internal
+ * @brief Reads and validates a header.
+ * @details Checks the magic, version and byte order, that `dataSize` is not 0
+ * and that the payload size does not overflow.
+ * @return `STATUS_OK`, `STATUS_ERR_IO` if it cannot be read, or
+ * `STATUS_ERR_INVALID_ARGUMENT` if it is not a valid header.
+ */
+STATUS _Snapshot_readHeader(int fd, SnapshotInfo* info);
+
+/**
+ * @internal
+ * @brief Maps a whole snapshot file privately and validates its header and length.
+ * @details The mapping is readable and writable; writes stay private to the
+ * process and never reach the file. The file descriptor is closed before returning.
+ * @param path The file to map.
+ * @param info Receives the header fields.
+ * @param baseOut Receives the start of the mapping (the header), or NULL if the
+ * snapshot holds no elements, in which case nothing stays mapped.
+ * @param lengthOut Receives the length of the mapping, for `munmap`.
+ * @return `STATUS_OK`, `STATUS_ERR_IO` if the file cannot be opened or mapped,
+ * or `STATUS_ERR_INVALID_ARGUMENT` if it is not a valid snapshot.
+ */
+STATUS _Snapshot_map(const char* path, SnapshotInfo* info, void** baseOut, size_t* lengthOut);
+
+#endif // SNAPSHOT_INTERNAL_H
@@ -1,21 +1,28 @@
 #include "../include/stack.h"
+#include "arraylist_internal.h"
 
 /**
  * @internal
  * @struct Stack
  * @brief Defines the internal structure of the Stack.
+ * @details The elements live in an ArrayList whose buffer is sized to
+ * `stackSize` at initialization, so pushes and pops never allocate. The top of
+ * the stack is the last element of the list.
  */
 struct Stack {
-    LinkedList* list;   // A pointer to the underlying LinkedList used for storage.   
+    ArrayList* list;    // A pointer to the underlying ArrayList used for storage.
     size_t stackSize;   // The maximum capacity of the stack.
 };
 
 Stack* Stack_init(size_t dataSize, size_t stackSize) 
 {
+    if (dataSize == 0 || stackSize > SIZE_MAX / dataSize) return NULL;
+
     Stack* stack = (Stack*)malloc(sizeof(Stack));
     if (!stack) return NULL;
 
-    stack->list = LinkedList_init(dataSize);
+    // Preallocate the whole bound so the buffer never moves.
+    stack->list = ArrayList_init(stackSize, dataSize);
     if (!stack->list) {
         free(stack);
         return NULL;
@@ -27,7 +34,7 @@ Stack* Stack_init(size_t dataSize, size_t stackSize)
 void Stack_destroy(Stack* stack) 
 {
     if (!stack) return;
-    LinkedList_destroy(stack->list);
+    ArrayList_destroy(stack->list);
     stack->list = NULL;
     free(stack);
 }
@@ -35,13 +42,19 @@ void Stack_destroy(Stack* stack)
 bool Stack_isEmpty(Stack* stack) 
 {
     if (!stack) return true;
-    return LinkedList_size(stack->list) ==  0;
+    return stack->list->size == 0;
 }
 
 bool Stack_isFull(Stack* stack) 
 {
     if (!stack) return false;
-    return LinkedList_size(stack->list) == stack->stackSize;
+    return stack->list->size == stack->stackSize;
+}
+
+size_t Stack_size(const Stack* stack)
+{
+    if (!stack) return 0;
+    return stack->list->size;
 }
 
 STATUS Stack_push(Stack* stack, void* element) 
@@ -49,17 +62,27 @@ STATUS Stack_push(Stack* stack, void* element)
     if (!stack || !element) return STATUS_ERR_INVALID_ARGUMENT;
     if (Stack_isFull(stack)) return STATUS_ERR_OVERFLOW;
 
-    // Pushing onto the stack is equivalent to inserting at the head of the list.
-    return LinkedList_insert(stack->list, element);
+    ArrayList* list = stack->list;
+    memcpy(_ArrayList_at(list, list->size), element, list->dataSize);
+    list->size++;
+    return STATUS_OK;
 }
 
 STATUS Stack_pop(Stack* stack) 
+{
+    return Stack_popInto(stack, NULL);
+}
+
+STATUS Stack_popInto(Stack* stack, void* elementOut)
 {
     if (!stack) return STATUS_ERR_INVALID_ARGUMENT;
     if (Stack_isEmpty(stack)) return STATUS_ERR_UNDERFLOW;
 
-    // Popping from the stack is equivalent to deleting the head of the list (index 1).
-    return LinkedList_delete(stack->list, 1);
+    // Only the size changes; the buffer is never shrunk below the bound.
+    ArrayList* list = stack->list;
+    list->size--;
+    if (elementOut) memcpy(elementOut, _ArrayList_at(list, list->size), list->dataSize);
+    return STATUS_OK;
 }
 
 STATUS Stack_peek(Stack* stack, void* elementOut) 
@@ -67,6 +90,44 @@ STATUS Stack_peek(Stack* stack, void* elementOut)
     if (!stack || !elementOut) return STATUS_ERR_INVALID_ARGUMENT;
     if (Stack_isEmpty(stack)) return STATUS_ERR_EMPTY;
 
-    // Peeking the stack is equivalent to getting the head of the list (index 1).
-    return LinkedList_get(stack->list, 1, elementOut);
-}
\ No newline at end of file
+    ArrayList* list = stack->list;
+    memcpy(elementOut, _ArrayList_at(list, list->size - 1), list->dataSize);
+    return STATUS_OK;
+}
+
+void* Stack_top(const Stack* stack)
+{
+    if (!stack || stack->list->size == 0) return NULL;
+    return _ArrayList_at(stack->list, stack->list->size - 1);
+}
+
+STATUS Stack_pushMany(Stack* stack, const void* elements, size_t count)
+{
+    if (!stack || (!elements && count > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    ArrayList* list = stack->list;
+    if (count > stack->stackSize - list->size) return STATUS_ERR_OVERFLOW;
+    if (count == 0) return STATUS_OK;
+
+    // The array order is the push order, which is also the buffer order.
+    memcpy(_ArrayList_at(list, list->size), elements, count * list->dataSize);
+    list->size += count;
+    return STATUS_OK;
+}
+
+STATUS Stack_popMany(Stack* stack, void* out, size_t count)
+{
+    if (!stack || (!out && count > 0)) return STATUS_ERR_INVALID_ARGUMENT;
+
+    ArrayList* list = stack->list;
+    if (count > list->size) return STATUS_ERR_UNDERFLOW;
+
+    // Pop order is the reverse of buffer order: the top goes to out[0].
+    char* dst = out;
+    for (size_t i = 0; i < count; i++) {
+        list->size--;
+        memcpy(dst, _ArrayList_at(list, list->size), list->dataSize);
+        dst += list->dataSize;
+    }
+    return STATUS_OK;
+}
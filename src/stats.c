@@ -0,0 +1,42 @@
+#include "stats_internal.h"
+
+/* ----------------------------- Shared Definitions ----------------------------- */
+
+static DsaTraceHook _Dsa_traceHook = NULL;
+static void* _Dsa_traceContext = NULL;
+
+/* ------------------------------- Public Functions ------------------------------- */
+
+bool Dsa_statsEnabled(void)
+{
+#ifdef DSA_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Dsa_setTraceHook(DsaTraceHook hook, void* ctx)
+{
+    _Dsa_traceHook = hook;
+    _Dsa_traceContext = ctx;
+}
+
+/* ------------------------------ Internal Functions ------------------------------ */
+
+#ifdef DSA_STATS
+
+DsaTraceEvent _Dsa_traceEnter(const char* container, const char* operation, const void* instance)
+{
+    DsaTraceEvent event = { container, operation, instance, DSA_TRACE_ENTER };
+    if (_Dsa_traceHook) _Dsa_traceHook(&event, _Dsa_traceContext);
+    return event;
+}
+
+void _Dsa_traceExit(DsaTraceEvent* event)
+{
+    event->phase = DSA_TRACE_EXIT;
+    if (_Dsa_traceHook) _Dsa_traceHook(event, _Dsa_traceContext);
+}
+
+#endif // DSA_STATS
@@ -0,0 +1,62 @@
+/**
+ * @file stats_internal.h
+ * @internal
+ * @brief Macros through which containers update their DsaStats and fire trace hooks.
+ *
+ * Every macro compiles to nothing unless `DSA_STATS` is defined, and their
+ * arguments are then not evaluated, so they must not have side effects.
+ * Counters may be bumped through a pointer to a const container: the
+ * containers themselves are never defined const.
+ *
+ * This header is not installed.
+ */
+#ifndef STATS_INTERNAL_H
+#define STATS_INTERNAL_H
+
+#include "../include/stats.h"
+
+#ifdef DSA_STATS
+
+/** @internal Declares the counters inside a container struct. */
+#define DSA_STATS_MEMBER DsaStats stats;
+
+/** @internal Adds `n` to counter `field` of `obj`. */
+#define DSA_STAT_ADD(obj, field, n) ((void)(((DsaStats*)&(obj)->stats)->field += (uint64_t)(n)))
+
+/** @internal Raises counter `field` of `obj` to `value` if it is larger. */
+#define DSA_STAT_MAX(obj, field, value) do {                    \
+        DsaStats* _dsa_stats = (DsaStats*)&(obj)->stats;        \
+        uint64_t _dsa_value = (uint64_t)(value);                \
+        if (_dsa_value > _dsa_stats->field) _dsa_stats->field = _dsa_value; \
+    } while (0)
+
+/** @internal Copies the counters of `obj` to `out`. */
+#define DSA_STATS_COPY(out, obj) (*(out) = (obj)->stats)
+
+/** @internal Zeroes the counters of a new container. */
+#define DSA_STATS_INIT(obj) memset(&(obj)->stats, 0, sizeof(DsaStats))
+
+DsaTraceEvent _Dsa_traceEnter(const char* container, const char* operation, const void* instance);
+void _Dsa_traceExit(DsaTraceEvent* event);
+
+/**
+ * @internal
+ * @brief Fires the trace hook now and again when the enclosing function returns.
+ * @details Uses the GCC/Clang `cleanup` attribute, so every return path is covered.
+ */
+#define DSA_TRACE(container, operation, instance) \
+    __attribute__((cleanup(_Dsa_traceExit))) DsaTraceEvent _dsa_trace = _Dsa_traceEnter(container, operation, instance)
+
+#else
+
+// `sizeof` keeps the arguments referenced, so they raise no unused warnings, without evaluating them.
+#define DSA_STATS_MEMBER
+#define DSA_STAT_ADD(obj, field, n) ((void)sizeof(obj), (void)sizeof(n))
+#define DSA_STAT_MAX(obj, field, value) ((void)sizeof(obj), (void)sizeof(value))
+#define DSA_STATS_COPY(out, obj) ((void)sizeof(obj), (void)memset((out), 0, sizeof(DsaStats)))
+#define DSA_STATS_INIT(obj) ((void)sizeof(obj))
+#define DSA_TRACE(container, operation, instance) ((void)sizeof(instance))
+
+#endif // DSA_STATS
+
+#endif // STATS_INTERNAL_H
@@ -0,0 +1,334 @@
+#include "../include/threadpool.h"
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @internal
+ * @brief The assumed size of a cache line. Each thread's range is kept on its
+ * own line so that taking a grain does not false-share with its neighbours.
+ */
+#define TP_CACHE_LINE 64
+
+/**
+ * @internal
+ * @brief Number of subranges per thread aimed for when the caller passes a grain of 0.
+ */
+#define TP_CHUNKS_PER_THREAD 8
+
+/**
+ * @internal
+ * @struct ThreadPoolSlot
+ * @brief The part of the current loop's range still owned by one thread.
+ * @details The owner takes grains from `begin`; thieves take the back half by lowering `end`.
+ */
+typedef struct ThreadPoolSlot
+{
+    _Alignas(TP_CACHE_LINE) pthread_mutex_t lock;
+    size_t begin;                               // First index not yet handed out.
+    size_t end;                                 // One past the last index owned.
+} ThreadPoolSlot;
+
+/**
+ * @internal
+ * @struct ThreadPoolWorker
+ * @brief Arguments of a worker thread.
+ */
+typedef struct ThreadPoolWorker
+{
+    ThreadPool* pool;
+    size_t index;                               // The worker's slot; slot 0 belongs to the calling thread.
+} ThreadPoolWorker;
+
+/**
+ * @internal
+ * @struct ThreadPool
+ * @brief Defines the internal structure of the thread pool.
+ * @details Each loop bumps `generation` and wakes the workers, which run it
+ * and decrement `active`; the caller returns once `active` is back to 0.
+ */
+struct ThreadPool
+{
+    pthread_mutex_t submit;                     // Serializes loops started from different threads.
+    pthread_mutex_t lock;                       // Protects the fields below and the job description.
+    pthread_cond_t wake;                        // Signalled when a loop starts or the pool shuts down.
+    pthread_cond_t done;                        // Signalled when the last worker finishes a loop.
+    unsigned long generation;                   // Number of loops started so far.
+    size_t active;                              // Workers still running the current loop.
+    bool shutdown;                              // Set by ThreadPool_destroy.
+
+    void (*body)(size_t begin, size_t end, void* ctx);  // The current loop's body.
+    void* ctx;                                  // The current loop's context.
+    size_t grain;                               // The current loop's grain.
+
+    size_t threads;                             // Threads running a loop, the caller included.
+    ThreadPoolSlot* slots;                      // One range per thread.
+    pthread_t* handles;                         // The `threads - 1` workers.
+    ThreadPoolWorker* workers;                  // Their arguments.
+};
+
+/**
+ * @internal
+ * @brief The pool whose loop the current thread is running, to detect nested loops.
+ */
+static _Thread_local ThreadPool* _ThreadPool_current = NULL;
+
+static pthread_once_t _ThreadPool_defaultOnce = PTHREAD_ONCE_INIT;
+static ThreadPool* _ThreadPool_defaultPool = NULL;
+
+/* ----------------------------------------Private Helper Functions---------------------------------------- */
+
+/**
+ * @internal
+ * @brief Takes up to one grain from the front of a slot.
+ * @return `true` and the subrange in `begin`/`end`, or `false` if the slot is empty.
+ */
+static bool _ThreadPool_take(ThreadPoolSlot* slot, size_t grain, size_t* begin, size_t* end)
+{
+    pthread_mutex_lock(&slot->lock);
+    bool found = slot->begin < slot->end;
+    if (found) {
+        *begin = slot->begin;
+        *end = slot->end - slot->begin > grain ? slot->begin + grain : slot->end;
+        slot->begin = *end;
+    }
+    pthread_mutex_unlock(&slot->lock);
+    return found;
+}
+
+/**
+ * @internal
+ * @brief Steals the back half of another thread's remaining range into slot `self`.
+ * @details A remainder of at most one grain is taken whole instead and returned
+ * in `begin`/`end` to be run directly.
+ * @return `true` if anything was stolen; `false` once every other slot is empty.
+ */
+static bool _ThreadPool_steal(ThreadPool* pool, size_t self, size_t* begin, size_t* end)
+{
+    for (size_t k = 1; k < pool->threads; k++) {
+        ThreadPoolSlot* victim = &pool->slots[(self + k) % pool->threads];
+
+        pthread_mutex_lock(&victim->lock);
+        size_t remaining = victim->end - victim->begin;
+        if (remaining == 0) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        size_t stolen = remaining > pool->grain ? remaining / 2 : remaining;
+        *end = victim->end;
+        *begin = victim->end - stolen;
+        victim->end = *begin;
+        pthread_mutex_unlock(&victim->lock);
+
+        if (stolen > pool->grain) {
+            ThreadPoolSlot* own = &pool->slots[self];
+            pthread_mutex_lock(&own->lock);
+            own->begin = *begin;
+            own->end = *end;
+            pthread_mutex_unlock(&own->lock);
+            // Another thief may empty the slot first; the caller then just looks again.
+            if (!_ThreadPool_take(own, pool->grain, begin, end))
+                *begin = *end;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @internal
+ * @brief Runs the current loop from slot `self` until no thread has any work left.
+ */
+static void _ThreadPool_participate(ThreadPool* pool, size_t self)
+{
+    ThreadPool* outer = _ThreadPool_current;
+    _ThreadPool_current = pool;
+
+    size_t begin, end;
+    for (;;) {
+        if (!_ThreadPool_take(&pool->slots[self], pool->grain, &begin, &end)
+            && !_ThreadPool_steal(pool, self, &begin, &end))
+            break;
+        if (begin < end) pool->body(begin, end, pool->ctx);
+    }
+
+    _ThreadPool_current = outer;
+}
+
+/**
+ * @internal
+ * @brief Main loop of a worker thread: sleep until a loop starts, run it, report back.
+ */
+static void* _ThreadPool_workerMain(void* arg)
+{
+    ThreadPoolWorker* worker = arg;
+    ThreadPool* pool = worker->pool;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->shutdown) break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        _ThreadPool_participate(pool, worker->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0)
+            pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/**
+ * @internal
+ * @brief Stops and joins the first `started` workers.
+ */
+static void _ThreadPool_stopWorkers(ThreadPool* pool, size_t started)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < started; i++)
+        pthread_join(pool->handles[i], NULL);
+}
+
+/**
+ * @internal
+ * @brief Frees the pool's memory and synchronization objects.
+ */
+static void _ThreadPool_free(ThreadPool* pool)
+{
+    for (size_t i = 0; i < pool->threads; i++)
+        pthread_mutex_destroy(&pool->slots[i].lock);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->submit);
+    free(pool->workers);
+    free(pool->handles);
+    free(pool->slots);
+    free(pool);
+}
+
+static void _ThreadPool_createDefault(void)
+{
+    _ThreadPool_defaultPool = ThreadPool_init(0);
+}
+
+/* ----------------------------------------Public API Functions---------------------------------------- */
+
+ThreadPool* ThreadPool_init(size_t threads)
+{
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (size_t)online : 1;
+    }
+    if (threads > SIZE_MAX / sizeof(ThreadPoolSlot)) return NULL;
+
+    ThreadPool* pool = calloc(1, sizeof(ThreadPool));
+    if (!pool) return NULL;
+
+    pool->slots = aligned_alloc(TP_CACHE_LINE, threads * sizeof(ThreadPoolSlot));
+    pool->handles = malloc(threads * sizeof(pthread_t));
+    pool->workers = malloc(threads * sizeof(ThreadPoolWorker));
+    if (!pool->slots || !pool->handles || !pool->workers) {
+        free(pool->workers);
+        free(pool->handles);
+        free(pool->slots);
+        free(pool);
+        return NULL;
+    }
+
+    pool->threads = threads;
+    pthread_mutex_init(&pool->submit, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (size_t i = 0; i < threads; i++) {
+        pthread_mutex_init(&pool->slots[i].lock, NULL);
+        pool->slots[i].begin = pool->slots[i].end = 0;
+    }
+
+    for (size_t i = 0; i + 1 < threads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i + 1;
+        if (pthread_create(&pool->handles[i], NULL, _ThreadPool_workerMain, &pool->workers[i]) != 0) {
+            _ThreadPool_stopWorkers(pool, i);
+            _ThreadPool_free(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+void ThreadPool_destroy(ThreadPool* pool)
+{
+    if (!pool) return;
+    _ThreadPool_stopWorkers(pool, pool->threads - 1);
+    _ThreadPool_free(pool);
+}
+
+ThreadPool* ThreadPool_default(void)
+{
+    pthread_once(&_ThreadPool_defaultOnce, _ThreadPool_createDefault);
+    return _ThreadPool_defaultPool;
+}
+
+size_t ThreadPool_threadCount(const ThreadPool* pool)
+{
+    return pool ? pool->threads : 0;
+}
+
+STATUS ThreadPool_parallelFor(ThreadPool* pool, size_t count, size_t grain,
+    void (*body)(size_t begin, size_t end, void* ctx), void* ctx)
+{
+    if (!pool || !body)
+        return STATUS_ERR_INVALID_ARGUMENT;
+    if (count == 0)
+        return STATUS_OK;
+
+    if (grain == 0) {
+        grain = count / (pool->threads * TP_CHUNKS_PER_THREAD);
+        if (grain == 0) grain = 1;
+    }
+
+    // Nested loops and single-threaded pools run on the calling thread.
+    if (_ThreadPool_current == pool || pool->threads == 1 || count <= grain) {
+        for (size_t begin = 0; begin < count; begin += grain)
+            body(begin, count - begin > grain ? begin + grain : count, ctx);
+        return STATUS_OK;
+    }
+
+    pthread_mutex_lock(&pool->submit);
+
+    // Every worker is parked, so the slots can be set up without their locks.
+    pthread_mutex_lock(&pool->lock);
+    pool->body = body;
+    pool->ctx = ctx;
+    pool->grain = grain;
+    size_t share = count / pool->threads, extra = count % pool->threads, next = 0;
+    for (size_t i = 0; i < pool->threads; i++) {
+        pool->slots[i].begin = next;
+        next += share + (i < extra ? 1 : 0);
+        pool->slots[i].end = next;
+    }
+    pool->active = pool->threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    _ThreadPool_participate(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->submit);
+    return STATUS_OK;
+}
@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <dsa-lib/arena.h>
+#include <dsa-lib/arraylist.h>
+#include <dsa-lib/linkedlist.h>
+#include <dsa-lib/avltree.h>
+#include <dsa-lib/btree.h>
+#include <dsa-lib/hashmap.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// A malloc-backed allocator that counts live blocks and bytes, to check that
+// containers return exactly what they take and pass back the right sizes.
+typedef struct {
+    long blocks;
+    long bytes;
+    long allocs;
+} Counter;
+
+void* counting_alloc(void* ctx, size_t size) {
+    Counter* counter = ctx;
+    void* ptr = malloc(size);
+    if (ptr) {
+        counter->blocks++;
+        counter->bytes += (long)size;
+        counter->allocs++;
+    }
+    return ptr;
+}
+
+void counting_free(void* ctx, void* ptr, size_t size) {
+    Counter* counter = ctx;
+    counter->blocks--;
+    counter->bytes -= (long)size;
+    free(ptr);
+}
+
+// An allocator that always fails.
+void* failing_alloc(void* ctx, size_t size) {
+    (void)ctx;
+    (void)size;
+    return NULL;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests the arena's own allocation, alignment, reset and in-place growth.
+ */
+void test_arena_basics() {
+    printf("\n--- Testing Arena Basics ---\n");
+    Arena* arena = Arena_init(256);
+    ASSERT_TRUE(arena != NULL, "Arena initializes");
+    ASSERT_EQUAL_INT(0, Arena_bytesUsed(arena), "A new arena has used nothing");
+
+    bool aligned = true;
+    unsigned char* blocks[64];
+    for (int i = 0; i < 64; i++) {
+        blocks[i] = Arena_alloc(arena, (size_t)(i % 7) + 1);
+        if (!blocks[i] || (uintptr_t)blocks[i] % _Alignof(max_align_t) != 0) aligned = false;
+        else memset(blocks[i], i, (size_t)(i % 7) + 1);
+    }
+    ASSERT_TRUE(aligned, "Every block is maximally aligned");
+    bool intact = true;
+    for (int i = 0; i < 64; i++)
+        if (blocks[i][0] != (unsigned char)i) intact = false;
+    ASSERT_TRUE(intact, "Blocks spanning several chunks do not overlap");
+
+    void* big = Arena_alloc(arena, 10000);
+    ASSERT_TRUE(big != NULL, "A request larger than the chunk size gets its own chunk");
+    memset(big, 0xAB, 10000);
+
+    size_t used = Arena_bytesUsed(arena);
+    ASSERT_TRUE(used >= 64 + 10000, "bytesUsed counts every block");
+
+    Arena_reset(arena);
+    ASSERT_EQUAL_INT(0, Arena_bytesUsed(arena), "reset releases everything");
+    ASSERT_TRUE(Arena_alloc(arena, 1) == (void*)blocks[0], "Allocation after reset reuses the first chunk");
+
+    DsaAllocator allocator = Arena_allocator(arena);
+    ASSERT_TRUE(allocator.free == NULL, "The arena allocator does not free individually");
+    Arena_reset(arena);
+    int* grown = allocator.alloc(allocator.ctx, 4 * sizeof(int));
+    for (int i = 0; i < 4; i++) grown[i] = i;
+    int* again = allocator.realloc(allocator.ctx, grown, 4 * sizeof(int), 32 * sizeof(int));
+    ASSERT_TRUE(again == grown, "realloc of the last block grows in place");
+    void* other = allocator.alloc(allocator.ctx, 8);
+    int* moved = allocator.realloc(allocator.ctx, again, 32 * sizeof(int), 40 * sizeof(int));
+    ASSERT_TRUE(moved != again && other != NULL, "realloc of an older block moves it");
+    ASSERT_TRUE(moved[0] == 0 && moved[3] == 3, "realloc preserves the contents");
+
+    ASSERT_TRUE(Arena_alloc(NULL, 8) == NULL, "alloc rejects a NULL arena");
+    ASSERT_TRUE(Arena_alloc(arena, SIZE_MAX) == NULL, "alloc rejects an impossible size");
+    ASSERT_EQUAL_INT(0, Arena_bytesUsed(NULL), "bytesUsed of NULL is 0");
+    Arena_reset(NULL);
+    Arena_destroy(arena);
+    Arena_destroy(NULL);
+    ASSERT_TRUE(true, "reset and destroy handle NULL");
+}
+
+/**
+ * @brief Tests containers built on an arena, torn down together with one reset.
+ */
+void test_containers_on_arena() {
+    printf("\n--- Testing Containers on an Arena ---\n");
+    Arena* arena = Arena_init(0);
+    DsaAllocator allocator = Arena_allocator(arena);
+
+    for (int round = 0; round < 3; round++) {
+        ArrayList* list = ArrayList_initWithAllocator(2, sizeof(int), &allocator);
+        LinkedList* linked = LinkedList_initWithAllocator(sizeof(int), &allocator);
+        AVLTree* tree = AVLTree_initWithAllocator(sizeof(int), compare_int, &allocator);
+        BTree* btree = BTree_initWithAllocator(sizeof(int), compare_int, &allocator);
+        HashMap* map = HashMap_initWithAllocator(sizeof(int), sizeof(int), NULL, NULL, &allocator);
+        if (!list || !linked || !tree || !btree || !map) {
+            ASSERT_TRUE(false, "Containers initialize on the arena");
+            break;
+        }
+
+        bool ok = true;
+        for (int i = 0; i < 2000; i++) {
+            int key = (i * 7919) % 2000;
+            int value = key * 2;
+            if (ArrayList_insert(list, &key) != STATUS_OK) ok = false;
+            if (LinkedList_pushBack(linked, &key) != STATUS_OK) ok = false;
+            if (AVLTree_insert(tree, &key) != STATUS_OK) ok = false;
+            if (BTree_insert(btree, &key) != STATUS_OK) ok = false;
+            if (HashMap_insert(map, &key, &value) != STATUS_OK) ok = false;
+        }
+        for (int i = 0; i < 2000; i += 3) {
+            if (AVLTree_delete(tree, &i) != STATUS_OK) ok = false;
+            if (BTree_delete(btree, &i) != STATUS_OK) ok = false;
+            if (HashMap_remove(map, &i, NULL) != STATUS_OK) ok = false;
+        }
+        ASSERT_TRUE(ok, "Inserts and deletes succeed on arena-backed containers");
+        ASSERT_EQUAL_INT(2000, ArrayList_size(list), "ArrayList holds every element");
+        ASSERT_EQUAL_INT(2000, LinkedList_size(linked), "LinkedList holds every element");
+        ASSERT_EQUAL_INT(1333, AVLTree_size(tree), "AVLTree holds the survivors");
+        ASSERT_EQUAL_INT(1333, BTree_size(btree), "BTree holds the survivors");
+        ASSERT_EQUAL_INT(1333, HashMap_size(map), "HashMap holds the survivors");
+        int key = 1000;
+        int* value = HashMap_get(map, &key);
+        ASSERT_TRUE(value && *value == 2000, "HashMap lookups work on the arena");
+        ASSERT_TRUE(BTree_search(btree, &key) && AVLTree_search(tree, &key), "Tree lookups work on the arena");
+
+        ArrayList_destroy(list);
+        LinkedList_destroy(linked);
+        AVLTree_destroy(tree);
+        BTree_destroy(btree);
+        HashMap_destroy(map);
+        ASSERT_TRUE(Arena_bytesUsed(arena) > 0, "destroy leaves reclamation to the arena");
+        Arena_reset(arena);
+        ASSERT_EQUAL_INT(0, Arena_bytesUsed(arena), "One reset tears every container down");
+    }
+
+    AVLTree* left = AVLTree_initWithAllocator(sizeof(int), compare_int, &allocator);
+    AVLTree* right = AVLTree_init(sizeof(int), compare_int);
+    int one = 1, two = 2;
+    AVLTree_insert(left, &one);
+    AVLTree_insert(right, &two);
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, AVLTree_join(left, right), "join refuses trees with different allocators");
+    AVLTree_destroy(right);
+    AVLTree_destroy(left);
+    Arena_destroy(arena);
+}
+
+/**
+ * @brief Tests that containers release everything they take through a custom allocator.
+ */
+void test_custom_allocator() {
+    printf("\n--- Testing a Custom Allocator ---\n");
+    Counter counter = {0, 0, 0};
+    DsaAllocator allocator = { counting_alloc, NULL, counting_free, &counter };
+
+    ArrayList* list = ArrayList_initWithAllocator(1, sizeof(int), &allocator);
+    LinkedList* linked = LinkedList_initWithAllocator(sizeof(int), &allocator);
+    AVLTree* tree = AVLTree_initWithAllocator(sizeof(int), compare_int, &allocator);
+    BTree* btree = BTree_initWithAllocator(sizeof(int), compare_int, &allocator);
+    HashMap* map = HashMap_initWithAllocator(sizeof(int), 0, NULL, NULL, &allocator);
+    ASSERT_TRUE(list && linked && tree && btree && map, "Containers initialize with a custom allocator");
+    for (int i = 0; i < 500; i++) {
+        ArrayList_insert(list, &i);
+        LinkedList_pushFront(linked, &i);
+        AVLTree_insert(tree, &i);
+        BTree_insert(btree, &i);
+        HashMap_insert(map, &i, NULL);
+    }
+    for (int i = 0; i < 500; i += 2) {
+        AVLTree_delete(tree, &i);
+        BTree_delete(btree, &i);
+        LinkedList_popBack(linked, NULL);
+    }
+    ArrayList_shrinkToFit(list);
+    ASSERT_TRUE(counter.allocs > 500, "Every container allocates through the callbacks");
+
+    ArrayList_destroy(list);
+    LinkedList_destroy(linked);
+    AVLTree_destroy(tree);
+    BTree_destroy(btree);
+    HashMap_destroy(map);
+    ASSERT_EQUAL_INT(0, counter.blocks, "Every block is freed");
+    ASSERT_EQUAL_INT(0, counter.bytes, "free is passed each block's allocation size");
+
+    DsaAllocator failing = { failing_alloc, NULL, NULL, NULL };
+    DsaAllocator missing = { NULL, NULL, NULL, NULL };
+    ASSERT_TRUE(ArrayList_initWithAllocator(4, sizeof(int), &failing) == NULL, "init fails cleanly when the allocator fails");
+    ASSERT_TRUE(AVLTree_initWithAllocator(sizeof(int), compare_int, &missing) == NULL, "init rejects an allocator without alloc");
+    ASSERT_TRUE(BTree_initWithAllocator(sizeof(int), compare_int, &missing) == NULL, "BTree rejects an allocator without alloc");
+
+    LinkedList* fallback = LinkedList_initWithAllocator(sizeof(int), NULL);
+    ASSERT_TRUE(fallback != NULL, "A NULL allocator means malloc");
+    LinkedList_destroy(fallback);
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("        Testing Arena Module\n");
+    printf("========================================\n");
+
+    test_arena_basics();
+    test_containers_on_arena();
+    test_custom_allocator();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <dsa-lib/arraylist.h>
 
 // =============================================================================
@@ -75,6 +77,66 @@ int compare_int(const void* a, const void* b) {
     return 0;
 }
 
+// removeIf predicate selecting odd integers
+bool is_odd(const void* data) {
+    return (*(const int*)data) % 2 != 0;
+}
+
+// forEachCtx callback summing values until the sum exceeds a limit
+bool sum_until(void* data, void* ctx) {
+    int* sum = ctx;
+    *sum += *(int*)data;
+    return *sum <= 10;
+}
+
+// Comparison function for 64-bit integers
+int compare_int64(const void* a, const void* b) {
+    int64_t int_a = *(const int64_t*)a;
+    int64_t int_b = *(const int64_t*)b;
+    return (int_a > int_b) - (int_a < int_b);
+}
+
+// Checks that a list of ints is in non-decreasing order.
+bool is_sorted_int(ArrayList* list) {
+    for (size_t i = 1; i < ArrayList_size(list); i++)
+        if (*(int*)ArrayList_at(list, i - 1) > *(int*)ArrayList_at(list, i)) return false;
+    return true;
+}
+
+// Small deterministic generator so the workloads are reproducible.
+static unsigned int rng_state = 99;
+unsigned int next_random() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// parallelForEach callback doubling a value in place
+void double_int(void* data, void* ctx) {
+    (void)ctx;
+    *(int*)data *= 2;
+}
+
+// parallelReduce callbacks summing ints into a long long
+void sum_accumulate(void* partial, const void* element, void* ctx) {
+    (void)ctx;
+    *(long long*)partial += *(const int*)element;
+}
+
+void sum_combine(void* result, const void* partial, void* ctx) {
+    (void)ctx;
+    *(long long*)result += *(const long long*)partial;
+}
+
+// A struct sorted by key only, to check that whole elements move together.
+typedef struct {
+    int key;
+    int check;
+} KeyedRecord;
+
+int compare_keyed(const void* a, const void* b) {
+    return compare_int(&((const KeyedRecord*)a)->key, &((const KeyedRecord*)b)->key);
+}
+
 // =============================================================================
 // 3. Test Groups
 // =============================================================================
@@ -176,6 +238,511 @@ void test_struct_list() {
     ArrayList_destroy(list);
 }
 
+/**
+ * @brief Tests reserve, shrinkToFit, clear and the resizing policy.
+ */
+void test_capacity_management() {
+    printf("\n--- Testing Capacity Management ---\n");
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    ArrayListPolicy policy;
+
+    ASSERT_TRUE(ArrayList_getPolicy(list, &policy) == STATUS_OK, "getPolicy succeeds");
+    ASSERT_TRUE(policy.growthFactor == 2.0 && policy.shrinkOnDelete && policy.minCapacity == 8, "Default policy matches the documented values");
+
+    ASSERT_TRUE(ArrayList_reserve(list, 100) == STATUS_OK, "Reserve succeeds");
+    ASSERT_EQUAL_INT(100, ArrayList_capacity(list), "Reserve allocates exactly the requested capacity");
+    ArrayList_reserve(list, 10);
+    ASSERT_EQUAL_INT(100, ArrayList_capacity(list), "Reserve never shrinks");
+
+    for (int i = 0; i < 100; ++i) ArrayList_insert(list, &i);
+    ASSERT_EQUAL_INT(100, ArrayList_capacity(list), "Filling a reserved list does not reallocate");
+
+    ArrayList_clear(list);
+    ASSERT_EQUAL_INT(0, ArrayList_size(list), "Clear empties the list");
+    ASSERT_EQUAL_INT(100, ArrayList_capacity(list), "Clear keeps the capacity");
+
+    // With shrinking disabled, draining keeps the buffer.
+    policy.shrinkOnDelete = false;
+    policy.growthFactor = 1.5;
+    ASSERT_TRUE(ArrayList_setPolicy(list, &policy) == STATUS_OK, "setPolicy succeeds");
+    for (int i = 0; i < 100; ++i) ArrayList_insert(list, &i);
+    while (ArrayList_size(list) > 0) ArrayList_delete(list, ArrayList_size(list) - 1);
+    ASSERT_EQUAL_INT(100, ArrayList_capacity(list), "No shrinking when the policy disables it");
+
+    // Growth by 1.5 from a full list of 100.
+    for (int i = 0; i < 101; ++i) ArrayList_insert(list, &i);
+    ASSERT_EQUAL_INT(150, ArrayList_capacity(list), "Growth follows the policy's factor");
+    int val = 0;
+    ArrayList_get(list, 100, &val);
+    ASSERT_EQUAL_INT(100, val, "Elements survive the policy-driven growth");
+
+    // Shrinking re-enabled, never below the minimum.
+    policy.shrinkOnDelete = true;
+    policy.minCapacity = 32;
+    ArrayList_setPolicy(list, &policy);
+    while (ArrayList_size(list) > 0) ArrayList_delete(list, 0);
+    ASSERT_EQUAL_INT(32, ArrayList_capacity(list), "Shrinking stops at the policy's minimum capacity");
+
+    ASSERT_TRUE(ArrayList_shrinkToFit(list) == STATUS_OK, "shrinkToFit on an empty list succeeds");
+    ASSERT_EQUAL_INT(0, ArrayList_capacity(list), "shrinkToFit releases an empty list's buffer");
+    ArrayList_insert(list, &val);
+    ASSERT_EQUAL_INT(32, ArrayList_capacity(list), "First allocation uses the minimum capacity");
+    ArrayList_shrinkToFit(list);
+    ASSERT_EQUAL_INT(1, ArrayList_capacity(list), "shrinkToFit reduces capacity to size");
+
+    policy.growthFactor = 1.0;
+    ASSERT_TRUE(ArrayList_setPolicy(list, &policy) == STATUS_ERR_INVALID_ARGUMENT, "A growth factor of 1 is rejected");
+    ASSERT_TRUE(ArrayList_reserve(list, SIZE_MAX) == STATUS_ERR_OVERFLOW, "Reserve that overflows fails");
+    ASSERT_TRUE(ArrayList_reserve(NULL, 1) == STATUS_ERR_INVALID_ARGUMENT, "Reserve with NULL list fails");
+    ASSERT_TRUE(ArrayList_clear(NULL) == STATUS_ERR_INVALID_ARGUMENT, "Clear with NULL list fails");
+
+    ArrayList_destroy(list);
+}
+
+static size_t live_allocations = 0;
+
+static void* counting_alloc(void* ctx, size_t size) {
+    (void)ctx;
+    live_allocations++;
+    return malloc(size);
+}
+
+static void counting_free(void* ctx, void* ptr, size_t size) {
+    (void)ctx; (void)size;
+    if (ptr) live_allocations--;
+    free(ptr);
+}
+
+/**
+ * @brief Tests that small capacities are stored inside the list struct.
+ */
+void test_small_buffer() {
+    printf("\n--- Testing Small-Buffer Storage ---\n");
+    DsaAllocator counting = { counting_alloc, NULL, counting_free, NULL };
+    ArrayList* list = ArrayList_initWithAllocator(0, sizeof(int), &counting);
+    ASSERT_EQUAL_INT(1, live_allocations, "An empty list allocates only its struct");
+
+    for (int i = 0; i < 16; ++i) ArrayList_insert(list, &i);
+    ASSERT_EQUAL_INT(16, ArrayList_capacity(list), "Capacity grows as usual while the elements fit inline");
+    ASSERT_EQUAL_INT(1, live_allocations, "Sixteen ints fit without a separate buffer");
+
+    int val = 16;
+    ArrayList_insert(list, &val);
+    ASSERT_EQUAL_INT(2, live_allocations, "Outgrowing the inline storage allocates a buffer");
+    bool intact = true;
+    for (int i = 0; i < 17; ++i) {
+        ArrayList_get(list, i, &val);
+        if (val != i) intact = false;
+    }
+    ASSERT_TRUE(intact, "Elements are copied out of the inline storage");
+
+    while (ArrayList_size(list) > 4) ArrayList_delete(list, 0);
+    ASSERT_EQUAL_INT(1, live_allocations, "Shrinking back into the inline storage frees the buffer");
+    ArrayList_get(list, 0, &val);
+    ASSERT_EQUAL_INT(13, val, "Elements are copied back into the inline storage");
+    ArrayList_destroy(list);
+    ASSERT_EQUAL_INT(0, live_allocations, "destroy frees everything");
+
+    list = ArrayList_initWithAllocator(100, sizeof(int), &counting);
+    ASSERT_EQUAL_INT(2, live_allocations, "A larger initial capacity allocates a buffer up front");
+    ArrayList_destroy(list);
+
+    // Elements too large for the inline storage always use a buffer.
+    char big[100] = "big";
+    list = ArrayList_initWithAllocator(0, sizeof(big), &counting);
+    ArrayList_insert(list, big);
+    ASSERT_EQUAL_INT(2, live_allocations, "Large elements are allocated separately");
+    ArrayList_destroy(list);
+    ASSERT_EQUAL_INT(0, live_allocations, "Large-element list frees everything");
+}
+
+/**
+ * @brief Tests the bulk insert and removal operations.
+ */
+void test_bulk_operations() {
+    printf("\n--- Testing Bulk Operations ---\n");
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    int chunk[1000];
+    for (int i = 0; i < 1000; ++i) chunk[i] = i;
+
+    ASSERT_TRUE(ArrayList_insertMany(list, chunk, 1000) == STATUS_OK, "insertMany succeeds");
+    ASSERT_TRUE(ArrayList_insertMany(list, chunk, 0) == STATUS_OK, "insertMany of zero elements is a no-op");
+    ASSERT_EQUAL_INT(1000, ArrayList_size(list), "Size is correct after insertMany");
+    int val = 0;
+    ArrayList_get(list, 999, &val);
+    ASSERT_EQUAL_INT(999, val, "Last appended element is correct");
+
+    // [0..999] -> remove [100, 900) -> [0..99, 900..999]
+    ASSERT_TRUE(ArrayList_removeRange(list, 100, 900) == STATUS_OK, "removeRange succeeds");
+    ASSERT_EQUAL_INT(200, ArrayList_size(list), "Size is correct after removeRange");
+    ArrayList_get(list, 100, &val);
+    ASSERT_EQUAL_INT(900, val, "Tail is shifted down over the removed range");
+    ASSERT_TRUE(ArrayList_removeRange(list, 5, 5) == STATUS_OK, "Empty range is a no-op");
+    ASSERT_TRUE(ArrayList_removeRange(list, 5, 4) == STATUS_ERR_INVALID_ARGUMENT, "Reversed range fails");
+    ASSERT_TRUE(ArrayList_removeRange(list, 0, 201) == STATUS_ERR_INVALID_ARGUMENT, "Range past the end fails");
+
+    // Remove odd values, keeping order.
+    size_t removed = 0;
+    ASSERT_TRUE(ArrayList_removeIf(list, is_odd, &removed) == STATUS_OK, "removeIf succeeds");
+    ASSERT_EQUAL_INT(100, removed, "removeIf reports the number removed");
+    ASSERT_EQUAL_INT(100, ArrayList_size(list), "Size is correct after removeIf");
+    bool ordered = true;
+    for (size_t i = 0; i < ArrayList_size(list); ++i) {
+        ArrayList_get(list, i, &val);
+        int expected = i < 50 ? (int)(2 * i) : (int)(900 + 2 * (i - 50));
+        if (val != expected) ordered = false;
+    }
+    ASSERT_TRUE(ordered, "removeIf keeps the remaining elements in order");
+
+    // insertAt at the front, middle and end.
+    int front = -1, middle = -2, back = -3;
+    ArrayList_insertAt(list, 0, &front);
+    ArrayList_insertAt(list, 50, &middle);
+    ArrayList_insertAt(list, ArrayList_size(list), &back);
+    ArrayList_get(list, 0, &val);
+    ASSERT_EQUAL_INT(-1, val, "insertAt 0 places the element first");
+    ArrayList_get(list, 50, &val);
+    ASSERT_EQUAL_INT(-2, val, "insertAt in the middle places the element at that index");
+    ArrayList_get(list, 51, &val);
+    ASSERT_EQUAL_INT(98, val, "insertAt shifts the following elements right");
+    ArrayList_get(list, ArrayList_size(list) - 1, &val);
+    ASSERT_EQUAL_INT(-3, val, "insertAt size appends");
+    ASSERT_TRUE(ArrayList_insertAt(list, ArrayList_size(list) + 1, &val) == STATUS_ERR_INVALID_ARGUMENT, "insertAt past the end fails");
+    ASSERT_TRUE(ArrayList_insertMany(list, NULL, 1) == STATUS_ERR_INVALID_ARGUMENT, "insertMany with NULL elements fails");
+    ASSERT_TRUE(ArrayList_removeIf(list, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "removeIf with NULL predicate fails");
+
+    ArrayList_destroy(list);
+}
+
+/**
+ * @brief Tests borrowed (zero-copy) element access.
+ */
+void test_borrowed_access() {
+    printf("\n--- Testing Borrowed Access ---\n");
+    ArrayList* list = ArrayList_init(0, sizeof(Person));
+    ASSERT_TRUE(ArrayList_data(list) == NULL, "Data is NULL before the first allocation");
+
+    Person people[] = {{1, "Ada"}, {2, "Grace"}, {3, "Linus"}};
+    ArrayList_insertMany(list, people, 3);
+
+    Person* second = ArrayList_at(list, 1);
+    ASSERT_TRUE(second != NULL && second->id == 2, "ArrayList_at points at the element");
+    second->id = 20;
+    Person copy;
+    ArrayList_get(list, 1, &copy);
+    ASSERT_EQUAL_INT(20, copy.id, "Writes through ArrayList_at modify the list");
+
+    Person* base = ArrayList_data(list);
+    ASSERT_TRUE(base + 1 == second, "ArrayList_data is the contiguous base of the elements");
+    ASSERT_EQUAL_STRING("Linus", base[2].name, "Elements are laid out back to back");
+    ASSERT_TRUE(ArrayList_at(list, 3) == NULL, "ArrayList_at out of bounds returns NULL");
+    ASSERT_TRUE(ArrayList_at(NULL, 0) == NULL, "ArrayList_at on a NULL list returns NULL");
+
+    ArrayList* ints = ArrayList_init(0, sizeof(int));
+    for (int i = 1; i <= 10; ++i) ArrayList_insert(ints, &i);
+    int sum = 0;
+    ASSERT_TRUE(ArrayList_forEachCtx(ints, sum_until, &sum) == STATUS_OK, "forEachCtx succeeds");
+    ASSERT_EQUAL_INT(15, sum, "forEachCtx passes ctx and stops when the callback returns false");
+    ASSERT_TRUE(ArrayList_forEachCtx(ints, NULL, &sum) == STATUS_ERR_INVALID_ARGUMENT, "forEachCtx with NULL callback fails");
+    ArrayList_destroy(ints);
+
+    ArrayList_destroy(list);
+}
+
+/**
+ * @brief Tests sorting, binary search, sorted insertion and the integer scans.
+ */
+void test_sorting_and_search() {
+    printf("\n--- Testing Sorting and Searching ---\n");
+
+    // Random, sorted, reversed and duplicate-heavy inputs.
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    for (int i = 0; i < 5000; i++) {
+        int value = (int)(next_random() % 100000);
+        ArrayList_insert(list, &value);
+    }
+    ASSERT_TRUE(ArrayList_sort(list, compare_int) == STATUS_OK && is_sorted_int(list), "Random ints are sorted");
+    ASSERT_TRUE(ArrayList_sort(list, compare_int) == STATUS_OK && is_sorted_int(list), "Sorted input stays sorted");
+    for (size_t i = 0, j = ArrayList_size(list) - 1; i < j; i++, j--) {
+        int a, b;
+        ArrayList_get(list, i, &a);
+        ArrayList_get(list, j, &b);
+        ArrayList_set(list, i, &b);
+        ArrayList_set(list, j, &a);
+    }
+    ASSERT_TRUE(ArrayList_sort(list, compare_int) == STATUS_OK && is_sorted_int(list), "Reversed input is sorted");
+    for (size_t i = 0; i < ArrayList_size(list); i++) {
+        int value = (int)(next_random() % 3);
+        ArrayList_set(list, i, &value);
+    }
+    ArrayList_sort(list, compare_int);
+    ASSERT_TRUE(is_sorted_int(list), "Input with many duplicates is sorted");
+
+    // Binary search and bounds over the duplicates 0, 1, 2.
+    int key = 1;
+    size_t index = 0;
+    size_t first_one = ArrayList_lowerBound(list, &key, compare_int);
+    ASSERT_TRUE(ArrayList_binarySearch(list, &key, &index, compare_int) == STATUS_OK && index == first_one,
+        "binarySearch finds the first equal element");
+    ASSERT_TRUE(*(int*)ArrayList_at(list, first_one) == 1 && (first_one == 0 || *(int*)ArrayList_at(list, first_one - 1) == 0),
+        "lowerBound points at the first element not below the key");
+    key = 5;
+    ASSERT_TRUE(ArrayList_binarySearch(list, &key, &index, compare_int) == STATUS_ERR_KEY_NOT_FOUND, "binarySearch misses an absent key");
+    ASSERT_TRUE(ArrayList_lowerBound(list, &key, compare_int) == ArrayList_size(list), "lowerBound past the end is the size");
+    ArrayList_destroy(list);
+
+    // Sorted insertion keeps the list ordered.
+    list = ArrayList_init(0, sizeof(int));
+    for (int i = 0; i < 200; i++) {
+        int value = (int)(next_random() % 50);
+        ArrayList_insertSorted(list, &value, compare_int);
+    }
+    ASSERT_TRUE(ArrayList_size(list) == 200 && is_sorted_int(list), "insertSorted keeps the list ordered");
+    ArrayList_destroy(list);
+
+    // 8-byte and odd-sized elements.
+    ArrayList* wide = ArrayList_init(0, sizeof(int64_t));
+    for (int i = 0; i < 1000; i++) {
+        int64_t value = ((int64_t)next_random() << 20) - (int64_t)next_random();
+        ArrayList_insert(wide, &value);
+    }
+    ArrayList_sort(wide, compare_int64);
+    bool ordered = true;
+    for (size_t i = 1; i < ArrayList_size(wide); i++)
+        if (*(int64_t*)ArrayList_at(wide, i - 1) > *(int64_t*)ArrayList_at(wide, i)) ordered = false;
+    ASSERT_TRUE(ordered, "64-bit integers are sorted");
+
+    ArrayList* people = ArrayList_init(0, sizeof(Person));
+    for (int i = 0; i < 300; i++) {
+        Person p = {(int)(next_random() % 1000), ""};
+        snprintf(p.name, sizeof(p.name), "person %d", p.id);
+        ArrayList_insert(people, &p);
+    }
+    ArrayList_sort(people, compare_person_id);
+    ordered = true;
+    for (size_t i = 0; i < ArrayList_size(people); i++) {
+        Person* p = ArrayList_at(people, i);
+        char expected[50];
+        snprintf(expected, sizeof(expected), "person %d", p->id);
+        if (strcmp(p->name, expected) != 0) ordered = false;
+        if (i > 0 && ((Person*)ArrayList_at(people, i - 1))->id > p->id) ordered = false;
+    }
+    ASSERT_TRUE(ordered, "Structs are sorted and kept intact");
+    ArrayList_destroy(people);
+
+    // Integer scans, including matches in the scalar tail.
+    ArrayList* ints = ArrayList_init(0, sizeof(int32_t));
+    for (int32_t i = 0; i < 37; i++) {
+        int32_t value = i * 3;
+        ArrayList_insert(ints, &value);
+    }
+    bool found_all = true;
+    for (int32_t i = 0; i < 37; i++)
+        if (ArrayList_findInt32(ints, i * 3, &index) != STATUS_OK || index != (size_t)i) found_all = false;
+    ASSERT_TRUE(found_all, "findInt32 finds every element");
+    ASSERT_TRUE(ArrayList_findInt32(ints, 4, &index) == STATUS_ERR_KEY_NOT_FOUND, "findInt32 misses an absent key");
+    ASSERT_TRUE(ArrayList_findInt64(ints, 3, &index) == STATUS_ERR_INVALID_ARGUMENT, "findInt64 rejects 4-byte elements");
+
+    found_all = true;
+    for (size_t i = 0; i < ArrayList_size(wide); i++) {
+        int64_t value = *(int64_t*)ArrayList_at(wide, i);
+        if (ArrayList_findInt64(wide, value, &index) != STATUS_OK || *(int64_t*)ArrayList_at(wide, index) != value || index > i)
+            found_all = false;
+    }
+    ASSERT_TRUE(found_all, "findInt64 finds the first copy of every element");
+    ArrayList* halves = ArrayList_init(0, sizeof(int64_t));
+    int64_t high_and_low = ((int64_t)1 << 32) | 5;
+    ArrayList_insert(halves, &high_and_low);
+    ArrayList_insert(halves, &high_and_low);
+    ASSERT_TRUE(ArrayList_findInt64(halves, 5, &index) == STATUS_ERR_KEY_NOT_FOUND, "findInt64 compares all 64 bits");
+    ArrayList_destroy(halves);
+    ASSERT_TRUE(ArrayList_findInt32(wide, 1, &index) == STATUS_ERR_INVALID_ARGUMENT, "findInt32 rejects 8-byte elements");
+    ArrayList_destroy(ints);
+    ArrayList_destroy(wide);
+
+    ASSERT_TRUE(ArrayList_sort(NULL, compare_int) == STATUS_ERR_INVALID_ARGUMENT, "sort fails with NULL list");
+}
+
+/**
+ * @brief Tests the parallel forEach, reduce and sort on a thread pool.
+ */
+void test_parallel_algorithms() {
+    printf("\n--- Testing Parallel Algorithms ---\n");
+    ThreadPool* pool = ThreadPool_init(4);
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    const int count = 200000;
+    long long expected = 0;
+    for (int i = 0; i < count; i++) {
+        int value = (int)(next_random() % 1000000);
+        ArrayList_insert(list, &value);
+        expected += value;
+    }
+
+    long long sum = 0;
+    ASSERT_TRUE(ArrayList_parallelReduce(list, pool, &sum, sizeof(sum), sum_accumulate, sum_combine, NULL, 0) == STATUS_OK
+        && sum == expected, "parallelReduce sums every element");
+    sum = 0;
+    ArrayList_parallelReduce(list, pool, &sum, sizeof(sum), sum_accumulate, sum_combine, NULL, 7);
+    ASSERT_TRUE(sum == expected, "parallelReduce handles a grain that does not divide the size");
+
+    ASSERT_TRUE(ArrayList_parallelForEach(list, pool, double_int, NULL, 0) == STATUS_OK, "parallelForEach succeeds");
+    sum = 0;
+    ArrayList_parallelReduce(list, NULL, &sum, sizeof(sum), sum_accumulate, sum_combine, NULL, 0);
+    ASSERT_TRUE(sum == 2 * expected, "parallelForEach visits every element exactly once");
+
+    ASSERT_TRUE(ArrayList_parallelSort(list, pool, compare_int) == STATUS_OK && is_sorted_int(list), "parallelSort sorts random ints");
+    sum = 0;
+    ArrayList_parallelReduce(list, pool, &sum, sizeof(sum), sum_accumulate, sum_combine, NULL, 0);
+    ASSERT_TRUE(sum == 2 * expected && ArrayList_size(list) == (size_t)count, "parallelSort keeps every element");
+    ASSERT_TRUE(ArrayList_parallelSort(list, pool, compare_int) == STATUS_OK && is_sorted_int(list), "parallelSort keeps sorted input sorted");
+
+    ArrayList_clear(list);
+    for (int i = 0; i < 30001; i++) {
+        int value = (int)(next_random() % 4);
+        ArrayList_insert(list, &value);
+    }
+    ArrayList_parallelSort(list, NULL, compare_int);
+    ASSERT_TRUE(is_sorted_int(list), "parallelSort handles many duplicates and the default pool");
+
+    // Three threads give runs of uneven length and an odd number of merge rounds.
+    ThreadPool* three = ThreadPool_init(3);
+    ArrayList* records = ArrayList_init(0, sizeof(KeyedRecord));
+    for (int i = 0; i < 50000; i++) {
+        KeyedRecord record = { (int)(next_random() % 20000), 0 };
+        record.check = record.key * 31 + 7;
+        ArrayList_insert(records, &record);
+    }
+    ArrayList_parallelSort(records, three, compare_keyed);
+    bool ordered = true, intact = true;
+    for (size_t i = 0; i < ArrayList_size(records); i++) {
+        KeyedRecord* record = ArrayList_at(records, i);
+        if (record->check != record->key * 31 + 7) intact = false;
+        if (i > 0 && ((KeyedRecord*)ArrayList_at(records, i - 1))->key > record->key) ordered = false;
+    }
+    ASSERT_TRUE(ordered && intact, "parallelSort moves whole 8-byte records on an odd thread count");
+    ArrayList_destroy(records);
+    ThreadPool_destroy(three);
+
+    ArrayList* small = ArrayList_init(0, sizeof(int));
+    sum = 5;
+    ASSERT_TRUE(ArrayList_parallelReduce(small, pool, &sum, sizeof(sum), sum_accumulate, sum_combine, NULL, 0) == STATUS_OK
+        && sum == 5, "parallelReduce of an empty list leaves the identity");
+    ASSERT_TRUE(ArrayList_parallelSort(small, pool, compare_int) == STATUS_OK, "parallelSort of an empty list succeeds");
+    ASSERT_TRUE(ArrayList_parallelForEach(NULL, pool, double_int, NULL, 0) == STATUS_ERR_INVALID_ARGUMENT, "parallelForEach rejects a NULL list");
+    ASSERT_TRUE(ArrayList_parallelReduce(small, pool, &sum, 0, sum_accumulate, sum_combine, NULL, 0) == STATUS_ERR_INVALID_ARGUMENT, "parallelReduce rejects a zero result size");
+    ASSERT_TRUE(ArrayList_parallelSort(small, pool, NULL) == STATUS_ERR_INVALID_ARGUMENT, "parallelSort rejects a NULL comparator");
+    ArrayList_destroy(small);
+
+    ArrayList_destroy(list);
+    ThreadPool_destroy(pool);
+}
+
+/**
+ * @brief Tests saving, loading and mapping snapshots.
+ */
+void test_snapshots() {
+    printf("\n--- Testing Snapshots ---\n");
+    char path[] = "/tmp/dsa-arraylist-XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0, "Temporary snapshot file is created");
+
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    for (int i = 0; i < 10000; i++) ArrayList_insert(list, &i);
+    ArrayList* empty = ArrayList_init(0, sizeof(int));
+    ASSERT_TRUE(ArrayList_save(list, fd) == STATUS_OK, "save succeeds");
+    ASSERT_TRUE(ArrayList_save(empty, fd) == STATUS_OK, "save of an empty list succeeds");
+
+    lseek(fd, 0, SEEK_SET);
+    ArrayList* loaded = ArrayList_load(fd);
+    bool same = loaded && ArrayList_size(loaded) == 10000;
+    for (size_t i = 0; same && i < 10000; i++) same = *(int*)ArrayList_at(loaded, i) == (int)i;
+    ASSERT_TRUE(same, "load restores every element");
+    ArrayList* loaded_empty = ArrayList_load(fd);
+    ASSERT_TRUE(loaded_empty && ArrayList_size(loaded_empty) == 0, "A second snapshot in the same file loads empty");
+    ASSERT_TRUE(ArrayList_load(fd) == NULL, "load at end of file fails");
+    ArrayList_destroy(loaded_empty);
+    ArrayList_destroy(loaded);
+
+    ArrayList* mapped = ArrayList_mapFile(path, sizeof(int));
+    ASSERT_TRUE(mapped && ArrayList_size(mapped) == 10000 && *(int*)ArrayList_at(mapped, 9999) == 9999, "mapFile exposes the saved elements");
+    int value = -1;
+    ArrayList_set(mapped, 0, &value);
+    ASSERT_TRUE(*(int*)ArrayList_at(mapped, 0) == -1, "A mapped list can be modified in place");
+    for (int i = 0; i < 100; i++) ArrayList_insert(mapped, &i);
+    same = ArrayList_size(mapped) == 10100 && *(int*)ArrayList_at(mapped, 0) == -1
+        && *(int*)ArrayList_at(mapped, 9999) == 9999 && *(int*)ArrayList_at(mapped, 10099) == 99;
+    ASSERT_TRUE(same, "Growing a mapped list copies its elements out");
+    ArrayList_destroy(mapped);
+
+    lseek(fd, 0, SEEK_SET);
+    loaded = ArrayList_load(fd);
+    ASSERT_TRUE(loaded && *(int*)ArrayList_at(loaded, 0) == 0, "Changes to a mapped list never reach the file");
+    ArrayList_destroy(loaded);
+    ASSERT_TRUE(ArrayList_mapFile(path, sizeof(double)) == NULL, "mapFile rejects a different element size");
+
+    // Corrupt the magic number.
+    lseek(fd, 0, SEEK_SET);
+    ASSERT_TRUE(write(fd, "NOTASNAP", 8) == 8, "Snapshot header is overwritten");
+    lseek(fd, 0, SEEK_SET);
+    ASSERT_TRUE(ArrayList_load(fd) == NULL, "load rejects a bad magic number");
+    ASSERT_TRUE(ArrayList_mapFile(path, sizeof(int)) == NULL, "mapFile rejects a bad magic number");
+    ASSERT_TRUE(ArrayList_mapFile("/nonexistent/dsa-snapshot", sizeof(int)) == NULL, "mapFile fails for a missing file");
+    ASSERT_TRUE(ArrayList_save(NULL, fd) == STATUS_ERR_INVALID_ARGUMENT, "save rejects a NULL list");
+    ASSERT_TRUE(ArrayList_save(list, -1) == STATUS_ERR_INVALID_ARGUMENT, "save rejects a negative descriptor");
+
+    // An empty snapshot maps to an empty, usable list.
+    ftruncate(fd, 0);
+    lseek(fd, 0, SEEK_SET);
+    ArrayList_save(empty, fd);
+    mapped = ArrayList_mapFile(path, sizeof(int));
+    ASSERT_TRUE(mapped && ArrayList_size(mapped) == 0 && ArrayList_insert(mapped, &value) == STATUS_OK, "An empty snapshot maps to a usable list");
+    ArrayList_destroy(mapped);
+
+    ArrayList_destroy(empty);
+    ArrayList_destroy(list);
+    close(fd);
+    unlink(path);
+}
+
+// Trace hook that counts entries and exits of ArrayList operations.
+static int trace_enters = 0, trace_exits = 0;
+void count_trace(const DsaTraceEvent* event, void* ctx) {
+    if (ctx != &trace_enters || strcmp(event->container, "ArrayList") != 0) return;
+    if (event->phase == DSA_TRACE_ENTER) trace_enters++;
+    else trace_exits++;
+}
+
+/**
+ * @brief Tests the instrumentation counters and trace hooks.
+ */
+void test_stats() {
+    printf("\n--- Testing Stats (%s) ---\n", Dsa_statsEnabled() ? "enabled" : "disabled");
+    ArrayList* list = ArrayList_init(0, sizeof(int));
+    Dsa_setTraceHook(count_trace, &trace_enters);
+    for (int i = 0; i < 100; i++) ArrayList_insert(list, &i);
+    Dsa_setTraceHook(NULL, NULL);
+    int key = 99, front = -1;
+    size_t index;
+    ArrayList_search(list, &key, &index, compare_int);
+    ArrayList_insertAt(list, 0, &front);
+
+    DsaStats stats;
+    ASSERT_TRUE(ArrayList_getStats(list, &stats) == STATUS_OK, "getStats succeeds");
+    if (Dsa_statsEnabled()) {
+        // Capacity doubles from 8 up to 128; 8 and 16 ints are stored inline, then 32, 64, 128 are allocated.
+        ASSERT_EQUAL_INT(3, stats.reallocs, "reallocs counts every growth that moves the buffer");
+        ASSERT_EQUAL_INT(100, stats.comparisons, "Linear search counts one comparison per element visited");
+        ASSERT_TRUE(stats.bytesMoved >= 100 * sizeof(int), "insertAt counts the shifted bytes");
+        ASSERT_TRUE(trace_enters == 100 && trace_exits == 100, "The trace hook fires around every insert");
+    } else {
+        ASSERT_TRUE(stats.reallocs == 0 && stats.comparisons == 0 && stats.bytesMoved == 0, "Counters read 0 without DSA_STATS");
+        ASSERT_TRUE(trace_enters == 0 && trace_exits == 0, "The trace hook never fires without DSA_STATS");
+    }
+    ASSERT_TRUE(ArrayList_getStats(NULL, &stats) == STATUS_ERR_INVALID_ARGUMENT, "getStats rejects a NULL list");
+    ASSERT_TRUE(ArrayList_getStats(list, NULL) == STATUS_ERR_INVALID_ARGUMENT, "getStats rejects a NULL output");
+    ArrayList_destroy(list);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -220,6 +787,14 @@ int main() {
     test_int_list();
     test_string_list();
     test_struct_list();
+    test_capacity_management();
+    test_small_buffer();
+    test_bulk_operations();
+    test_borrowed_access();
+    test_sorting_and_search();
+    test_parallel_algorithms();
+    test_snapshots();
+    test_stats();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
@@ -1,8 +1,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <dsa-lib/avltree.h>    
 #include <dsa-lib/arraylist.h>
+#include <dsa-lib/heap.h>
 
 // =============================================================================
 // 1. Simple Assertion Framework
@@ -45,6 +48,13 @@ int compare_int(const void* a, const void* b) {
     return int_a - int_b;
 }
 
+// Comparison function that counts how often it is called.
+static size_t compare_calls = 0;
+int counting_compare_int(const void* a, const void* b) {
+    compare_calls++;
+    return compare_int(a, b);
+}
+
 // Helper to add an element to an ArrayList, used as a callback for traversals.
 static ArrayList* traversal_result;
 void add_to_list_callback(void* data) {
@@ -53,6 +63,19 @@ void add_to_list_callback(void* data) {
     }
 }
 
+// visitRange callback collecting up to `limit` keys into a buffer.
+typedef struct {
+    int keys[64];
+    int count;
+    int limit;
+} RangeCollector;
+
+bool collect_range(void* element, void* ctx) {
+    RangeCollector* collector = ctx;
+    collector->keys[collector->count++] = *(int*)element;
+    return collector->count < collector->limit;
+}
+
 // Helper function to verify the in-order traversal of the tree.
 void verify_inorder_traversal(AVLTree* tree, int expected[], int expected_size) {
     traversal_result = ArrayList_init(expected_size, sizeof(int));
@@ -135,6 +158,475 @@ void test_avl_rotations_and_operations() {
     AVLTree_destroy(tree);
 }
 
+/**
+ * @brief Tests an AVL tree whose nodes come from a pool.
+ */
+void test_pooled_tree() {
+    printf("\n--- Testing Pooled AVL Tree ---\n");
+    AVLTree* tree = AVLTree_initPooled(sizeof(int), compare_int, 8);
+    ASSERT_TRUE(tree != NULL, "Pooled AVL Tree initialization");
+
+    for (int i = 1; i <= 50; ++i) AVLTree_insert(tree, &i);
+    for (int i = 2; i <= 50; i += 2) AVLTree_delete(tree, &i);
+    for (int i = 100; i < 105; ++i) AVLTree_insert(tree, &i);
+
+    int expected[30];
+    int n = 0;
+    for (int i = 1; i <= 50; i += 2) expected[n++] = i;
+    for (int i = 100; i < 105; ++i) expected[n++] = i;
+    verify_inorder_traversal(tree, expected, n);
+
+    AVLTree_destroy(tree);
+}
+
+/**
+ * @brief Tests a large workload: ordering, comparator cost per level and balance after deletes.
+ */
+void test_large_workload() {
+    printf("\n--- Testing Large Insert/Delete Workload ---\n");
+    AVLTree* tree = AVLTree_init(sizeof(int), counting_compare_int);
+    const int n = 4096;
+
+    // 1237 is coprime with 4096, so this visits every key once in a scrambled order.
+    for (int i = 0; i < n; ++i) {
+        int key = (i * 1237) % n;
+        AVLTree_insert(tree, &key);
+    }
+
+    int* expected = malloc(n * sizeof(int));
+    for (int i = 0; i < n; ++i) expected[i] = i;
+    verify_inorder_traversal(tree, expected, n);
+
+    // Height of an AVL tree with 4096 nodes is at most 1.44 * log2(n) ~ 17.
+    size_t worst = 0;
+    for (int key = 0; key < n; ++key) {
+        compare_calls = 0;
+        AVLTree_search(tree, &key);
+        if (compare_calls > worst) worst = compare_calls;
+    }
+    ASSERT_TRUE(worst <= 18, "Search makes at most one comparison per level of a balanced tree");
+
+    compare_calls = 0;
+    int missing = n;
+    AVLTree_insert(tree, &missing);
+    ASSERT_TRUE(compare_calls <= 18, "Insert makes one comparison per level");
+    AVLTree_delete(tree, &missing);
+
+    // Delete every even key; many of them have two children.
+    for (int key = 0; key < n; key += 2)
+        AVLTree_delete(tree, &key);
+    for (int i = 0; i < n / 2; ++i) expected[i] = 2 * i + 1;
+    verify_inorder_traversal(tree, expected, n / 2);
+
+    worst = 0;
+    for (int key = 1; key < n; key += 2) {
+        compare_calls = 0;
+        if (!AVLTree_search(tree, &key)) worst = SIZE_MAX;
+        if (compare_calls > worst) worst = compare_calls;
+    }
+    ASSERT_TRUE(worst <= 17, "Tree stays balanced and complete after deleting half the keys");
+
+    traversal_result = ArrayList_init(0, sizeof(int));
+    AVLTree_traversePostorder(tree, add_to_list_callback);
+    ASSERT_EQUAL_INT((size_t)(n / 2), ArrayList_size(traversal_result), "Post-order traversal visits every node");
+    ArrayList_destroy(traversal_result);
+    traversal_result = NULL;
+
+    free(expected);
+    AVLTree_destroy(tree);
+}
+
+/**
+ * @brief Tests order statistics and range queries.
+ */
+void test_order_statistics() {
+    printf("\n--- Testing Order Statistics and Ranges ---\n");
+    AVLTree* tree = AVLTree_init(sizeof(int), compare_int);
+
+    // Keys 0, 10, 20, ..., 990 inserted out of order.
+    for (int i = 0; i < 100; ++i) {
+        int key = ((i * 37) % 100) * 10;
+        AVLTree_insert(tree, &key);
+    }
+    ASSERT_EQUAL_INT(100, AVLTree_size(tree), "Size is tracked by subtree counts");
+
+    int key = 255;
+    ASSERT_EQUAL_INT(260, *(int*)AVLTree_lowerBound(tree, &key), "lowerBound between keys finds the next key");
+    key = 250;
+    ASSERT_EQUAL_INT(250, *(int*)AVLTree_lowerBound(tree, &key), "lowerBound of a present key finds it");
+    ASSERT_EQUAL_INT(260, *(int*)AVLTree_upperBound(tree, &key), "upperBound of a present key finds the next key");
+    key = 990;
+    ASSERT_TRUE(AVLTree_upperBound(tree, &key) == NULL, "upperBound of the largest key is NULL");
+
+    key = 250;
+    ASSERT_EQUAL_INT(25, AVLTree_rank(tree, &key), "rank of a present key is its position");
+    key = 255;
+    ASSERT_EQUAL_INT(26, AVLTree_rank(tree, &key), "rank of an absent key counts smaller keys");
+    ASSERT_EQUAL_INT(0, *(int*)AVLTree_select(tree, 0), "select(0) is the minimum");
+    ASSERT_EQUAL_INT(730, *(int*)AVLTree_select(tree, 73), "select(k) is the k-th smallest");
+    ASSERT_TRUE(AVLTree_select(tree, 100) == NULL, "select past the end is NULL");
+
+    int lo = 95, hi = 300;
+    ASSERT_EQUAL_INT(21, AVLTree_countRange(tree, &lo, &hi), "countRange counts keys in [lo, hi]");
+    lo = 100;
+    ASSERT_EQUAL_INT(21, AVLTree_countRange(tree, &lo, &hi), "countRange includes both ends");
+    ASSERT_EQUAL_INT(0, AVLTree_countRange(tree, &hi, &lo), "countRange with lo > hi is 0");
+
+    RangeCollector collector = { .count = 0, .limit = 64 };
+    lo = 95; hi = 140;
+    AVLTree_visitRange(tree, &lo, &hi, collect_range, &collector);
+    ASSERT_TRUE(collector.count == 5 && collector.keys[0] == 100 && collector.keys[4] == 140, "visitRange visits exactly the keys in range, in order");
+
+    collector = (RangeCollector){ .count = 0, .limit = 3 };
+    AVLTree_visitRange(tree, &lo, NULL, collect_range, &collector);
+    ASSERT_TRUE(collector.count == 3 && collector.keys[2] == 120, "visitRange stops when the callback returns false");
+
+    // Sizes stay correct through deletes with rotations.
+    for (int k = 0; k < 1000; k += 20) AVLTree_delete(tree, &k);
+    ASSERT_EQUAL_INT(50, AVLTree_size(tree), "Size is correct after deletes");
+    bool consistent = true;
+    for (size_t i = 0; i < 50; ++i)
+        if (*(int*)AVLTree_select(tree, i) != (int)(20 * i + 10)) consistent = false;
+    ASSERT_TRUE(consistent, "select agrees with sorted order after deletes");
+
+    AVLTree_destroy(tree);
+}
+
+/**
+ * @brief Tests the in-order iterator and the early-stopping traversals.
+ */
+void test_iterator() {
+    printf("\n--- Testing Iterator and Ctx Traversals ---\n");
+    AVLTree* tree = AVLTree_init(sizeof(int), compare_int);
+    AVLTreeIterator it;
+
+    ASSERT_TRUE(AVLTreeIterator_begin(&it, tree) == NULL, "begin on an empty tree is NULL");
+    for (int i = 0; i < 200; ++i) {
+        int key = ((i * 67) % 200) * 5; // 0, 5, ..., 995
+        AVLTree_insert(tree, &key);
+    }
+
+    int expected = 0, visited = 0;
+    bool ordered = true;
+    for (int* e = AVLTreeIterator_begin(&it, tree); e; e = AVLTreeIterator_next(&it)) {
+        if (*e != expected) ordered = false;
+        expected += 5;
+        visited++;
+    }
+    ASSERT_TRUE(ordered && visited == 200, "Forward iteration visits every key in order");
+    ASSERT_TRUE(AVLTreeIterator_get(&it) == NULL && AVLTreeIterator_next(&it) == NULL, "Exhausted iterator stays exhausted");
+
+    expected = 995; visited = 0; ordered = true;
+    for (int* e = AVLTreeIterator_last(&it, tree); e; e = AVLTreeIterator_prev(&it)) {
+        if (*e != expected) ordered = false;
+        expected -= 5;
+        visited++;
+    }
+    ASSERT_TRUE(ordered && visited == 200, "Reverse iteration visits every key in order");
+
+    int key = 502;
+    ASSERT_EQUAL_INT(505, *(int*)AVLTreeIterator_seek(&it, tree, &key), "seek to an absent key lands on its lower bound");
+    ASSERT_EQUAL_INT(510, *(int*)AVLTreeIterator_next(&it), "next after seek continues in order");
+    ASSERT_EQUAL_INT(505, *(int*)AVLTreeIterator_prev(&it), "prev steps back");
+    ASSERT_EQUAL_INT(500, *(int*)AVLTreeIterator_prev(&it), "prev goes before the seek position");
+    key = 700;
+    ASSERT_EQUAL_INT(700, *(int*)AVLTreeIterator_seek(&it, tree, &key), "seek to a present key lands on it");
+    ASSERT_EQUAL_INT(700, *(int*)AVLTreeIterator_get(&it), "get returns the current element");
+    key = 996;
+    ASSERT_TRUE(AVLTreeIterator_seek(&it, tree, &key) == NULL, "seek past the largest key is NULL");
+
+    RangeCollector collector = { .count = 0, .limit = 4 };
+    AVLTree_traverseInorderCtx(tree, collect_range, &collector);
+    ASSERT_TRUE(collector.count == 4 && collector.keys[3] == 15, "Inorder ctx traversal stops when asked");
+    collector = (RangeCollector){ .count = 0, .limit = 64 };
+    AVLTree_traversePostorderCtx(tree, collect_range, &collector);
+    ASSERT_EQUAL_INT(64, collector.count, "Postorder ctx traversal stops at the limit");
+    ASSERT_TRUE(AVLTree_traversePreorderCtx(tree, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "Ctx traversal with NULL callback fails");
+
+    AVLTree_destroy(tree);
+}
+
+// Checks that every key in [0, limit) is in the tree iff predicate(key) holds, and the tree is balanced.
+bool tree_matches(AVLTree* tree, int limit, bool (*predicate)(int)) {
+    size_t expected = 0;
+    for (int k = 0; k < limit; ++k) {
+        bool present = AVLTree_search(tree, &k) != NULL;
+        if (present != predicate(k)) return false;
+        if (present) expected++;
+    }
+    if (AVLTree_size(tree) != expected) return false;
+
+    // A balanced tree of this size answers any search within 1.44 * log2(n) + 2 comparisons.
+    size_t bound = 2;
+    for (size_t n = expected; n > 1; n /= 2) bound += 2;
+    for (int k = 0; k < limit; ++k) {
+        compare_calls = 0;
+        AVLTree_search(tree, &k);
+        if (compare_calls > bound) return false;
+    }
+    return true;
+}
+
+bool multiple_of_2(int k) { return k % 2 == 0; }
+bool multiple_of_3(int k) { return k % 3 == 0; }
+bool union_2_3(int k) { return k % 2 == 0 || k % 3 == 0; }
+bool both_2_3(int k) { return k % 6 == 0; }
+bool only_2(int k) { return k % 2 == 0 && k % 3 != 0; }
+bool below_500(int k) { return k % 2 == 0 && k < 500; }
+bool from_500(int k) { return k % 2 == 0 && k >= 500; }
+
+// Builds a tree holding the multiples of `step` below `limit`.
+AVLTree* build_multiples(int step, int limit) {
+    int* keys = malloc((limit / step + 1) * sizeof(int));
+    int n = 0;
+    for (int k = 0; k < limit; k += step) keys[n++] = k;
+    AVLTree* tree = AVLTree_buildFromSorted(keys, n, sizeof(int), counting_compare_int);
+    free(keys);
+    return tree;
+}
+
+/**
+ * @brief Tests bulk building, split/join and the set operations.
+ */
+void test_bulk_and_set_operations() {
+    printf("\n--- Testing Bulk Build and Set Operations ---\n");
+    const int limit = 3000;
+
+    AVLTree* evens = build_multiples(2, limit);
+    ASSERT_TRUE(evens != NULL && tree_matches(evens, limit, multiple_of_2), "buildFromSorted creates a balanced tree");
+    int unsorted[] = {1, 3, 2};
+    ASSERT_TRUE(AVLTree_buildFromSorted(unsorted, 3, sizeof(int), compare_int) == NULL, "buildFromSorted rejects unsorted input");
+    int duplicated[] = {1, 2, 2};
+    ASSERT_TRUE(AVLTree_buildFromSorted(duplicated, 3, sizeof(int), compare_int) == NULL, "buildFromSorted rejects duplicates");
+
+    // Split at 500 and join back.
+    AVLTree* upper = NULL;
+    int pivot = 500;
+    ASSERT_TRUE(AVLTree_split(evens, &pivot, &upper) == STATUS_OK, "split succeeds");
+    ASSERT_TRUE(tree_matches(evens, limit, below_500), "Left part holds the keys before the pivot");
+    ASSERT_TRUE(tree_matches(upper, limit, from_500), "Right part holds the pivot and the keys after it");
+    ASSERT_TRUE(AVLTree_join(upper, evens) == STATUS_ERR_INVALID_ARGUMENT, "join with overlapping order fails");
+    ASSERT_TRUE(AVLTree_join(evens, upper) == STATUS_OK, "join succeeds");
+    ASSERT_TRUE(tree_matches(evens, limit, multiple_of_2) && AVLTree_size(upper) == 0, "join restores the original tree");
+    AVLTree_destroy(upper);
+
+    // Union, intersection and difference of the multiples of 2 and 3.
+    AVLTree* threes = build_multiples(3, limit);
+    ASSERT_TRUE(AVLTree_union(evens, threes) == STATUS_OK, "union succeeds");
+    ASSERT_TRUE(tree_matches(evens, limit, union_2_3), "union holds the keys of both trees");
+    ASSERT_EQUAL_INT(0, AVLTree_size(threes), "union consumes the source");
+    AVLTree_destroy(threes);
+    AVLTree_destroy(evens);
+
+    evens = build_multiples(2, limit);
+    threes = build_multiples(3, limit);
+    AVLTree_intersection(evens, threes);
+    ASSERT_TRUE(tree_matches(evens, limit, both_2_3), "intersection holds the common keys");
+    AVLTree_destroy(threes);
+    AVLTree_destroy(evens);
+
+    evens = build_multiples(2, limit);
+    threes = build_multiples(3, limit);
+    AVLTree_difference(evens, threes);
+    ASSERT_TRUE(tree_matches(evens, limit, only_2), "difference removes the keys of the source");
+
+    // The result is still a fully working tree.
+    int key = 6;
+    ASSERT_TRUE(AVLTree_insert(evens, &key) == STATUS_OK, "Insert into a set-operation result works");
+    ASSERT_EQUAL_INT(2, AVLTree_rank(evens, &key), "rank is correct after set operations");
+
+    AVLTree* pooled = AVLTree_initPooled(sizeof(int), counting_compare_int, 0);
+    ASSERT_TRUE(AVLTree_union(evens, pooled) == STATUS_ERR_INVALID_ARGUMENT, "Set operations reject pooled trees");
+    ASSERT_TRUE(AVLTree_union(evens, evens) == STATUS_ERR_INVALID_ARGUMENT, "Set operations reject the same tree twice");
+    AVLTree* other_cmp = AVLTree_init(sizeof(int), compare_int);
+    ASSERT_TRUE(AVLTree_difference(evens, other_cmp) == STATUS_ERR_INVALID_ARGUMENT, "Set operations reject a different comparator");
+
+    AVLTree_destroy(other_cmp);
+    AVLTree_destroy(pooled);
+    AVLTree_destroy(threes);
+    AVLTree_destroy(evens);
+}
+
+bool not_multiple_of_3(int k) { return k % 3 != 0; }
+bool is_odd(int k) { return k % 2 != 0; }
+bool odd_not_multiple_of_3(int k) { return k % 2 != 0 && k % 3 != 0; }
+
+/**
+ * @brief Tests batch deletion and lazy (tombstone) deletion.
+ */
+void test_batch_and_lazy_delete() {
+    printf("\n--- Testing Batch and Lazy Deletion ---\n");
+    const int limit = 3000;
+
+    // Delete the multiples of 3, given in descending order, plus keys that are absent or repeated.
+    AVLTree* tree = build_multiples(1, limit);
+    int* keys = malloc((limit + 2) * sizeof(int));
+    size_t n = 0;
+    for (int k = limit - 3; k >= 0; k -= 3) keys[n++] = k;
+    keys[n++] = limit + 7;
+    keys[n++] = 0;
+    size_t deleted = 0;
+    ASSERT_TRUE(AVLTree_deleteMany(tree, keys, n, &deleted) == STATUS_OK, "deleteMany succeeds");
+    ASSERT_EQUAL_INT((size_t)(limit / 3), deleted, "deleteMany counts each present key once");
+    ASSERT_TRUE(tree_matches(tree, limit, not_multiple_of_3), "deleteMany leaves a balanced tree of the other keys");
+
+    // A batch that is a small share of the tree is split out rather than merged against the whole tree.
+    int few[] = { 7, 1, limit - 1, 8 };
+    ASSERT_TRUE(AVLTree_deleteMany(tree, few, 4, &deleted) == STATUS_OK && deleted == 4, "deleteMany of a small batch succeeds");
+    int key = 7;
+    ASSERT_TRUE(AVLTree_search(tree, &key) == NULL && AVLTree_size(tree) == (size_t)limit * 2 / 3 - 4, "A small batch removes exactly its keys");
+    for (size_t i = 0; i < 4; ++i) AVLTree_insert(tree, &few[i]);
+
+    // Sorted keys are used in place; deleting them all empties the tree.
+    n = 0;
+    for (int k = 0; k < limit; ++k) keys[n++] = k;
+    ASSERT_TRUE(AVLTree_deleteMany(tree, keys, n, NULL) == STATUS_OK && AVLTree_size(tree) == 0, "deleteMany of every key empties the tree");
+    ASSERT_TRUE(AVLTree_deleteMany(tree, keys, n, &deleted) == STATUS_OK && deleted == 0, "deleteMany on an empty tree deletes nothing");
+    ASSERT_TRUE(AVLTree_deleteMany(tree, NULL, 0, NULL) == STATUS_OK, "deleteMany of no keys is a no-op");
+    ASSERT_TRUE(AVLTree_deleteMany(tree, NULL, 1, NULL) == STATUS_ERR_INVALID_ARGUMENT, "deleteMany with NULL keys fails");
+    ASSERT_TRUE(AVLTree_deleteMany(NULL, keys, 1, NULL) == STATUS_ERR_INVALID_ARGUMENT, "deleteMany on a NULL tree fails");
+    AVLTree_destroy(tree);
+
+    // Lazy mode: tombstones are invisible to lookups, order statistics and iteration.
+    tree = build_multiples(1, limit);
+    ASSERT_TRUE(AVLTree_setLazyDelete(tree, 0.9) == STATUS_OK, "setLazyDelete succeeds");
+    bool ok = true;
+    for (int k = 0; k < limit; k += 2) ok = ok && AVLTree_delete(tree, &k) == STATUS_OK;
+    key = 10;
+    ASSERT_TRUE(ok && AVLTree_size(tree) == (size_t)limit / 2, "Lazy deletes shrink the size");
+    ASSERT_TRUE(AVLTree_search(tree, &key) == NULL, "A tombstoned key is not found");
+    ASSERT_TRUE(AVLTree_delete(tree, &key) == STATUS_ERR_KEY_NOT_FOUND, "A tombstoned key cannot be deleted twice");
+    ASSERT_EQUAL_INT(5, AVLTree_rank(tree, &key), "rank skips tombstones");
+    ASSERT_EQUAL_INT(11, *(int*)AVLTree_select(tree, 5), "select skips tombstones");
+    ASSERT_EQUAL_INT(11, *(int*)AVLTree_lowerBound(tree, &key), "lowerBound skips tombstones");
+    ASSERT_EQUAL_INT(11, *(int*)AVLTree_upperBound(tree, &key), "upperBound skips tombstones");
+    int lo = 10, hi = 20;
+    ASSERT_EQUAL_INT(5, AVLTree_countRange(tree, &lo, &hi), "countRange skips tombstones");
+
+    AVLTreeIterator it;
+    int expected = 1;
+    for (void* e = AVLTreeIterator_begin(&it, tree); e; e = AVLTreeIterator_next(&it), expected += 2)
+        if (*(int*)e != expected) ok = false;
+    ASSERT_TRUE(ok && expected == limit + 1, "Iteration skips tombstones");
+    ASSERT_EQUAL_INT(limit - 1, *(int*)AVLTreeIterator_last(&it, tree), "Reverse iteration starts at the last live element");
+    ASSERT_EQUAL_INT(limit - 3, *(int*)AVLTreeIterator_prev(&it), "prev skips tombstones");
+    ASSERT_EQUAL_INT(11, *(int*)AVLTreeIterator_seek(&it, tree, &key), "seek skips tombstones");
+    RangeCollector collector = { .count = 0, .limit = 64 };
+    AVLTree_visitRange(tree, &lo, &hi, collect_range, &collector);
+    ASSERT_TRUE(collector.count == 5 && collector.keys[0] == 11, "visitRange skips tombstones");
+
+    ASSERT_TRUE(AVLTree_insert(tree, &key) == STATUS_OK && AVLTree_search(tree, &key) != NULL, "Inserting a tombstoned key revives it");
+    ASSERT_TRUE(AVLTree_insert(tree, &key) == STATUS_ERR_DUPLICATE_KEY, "A revived key is a duplicate again");
+    AVLTree_delete(tree, &key);
+
+    // Half the nodes are tombstones, under the 90% threshold; compacting on demand frees them.
+    ASSERT_TRUE(AVLTree_compact(tree) == STATUS_OK, "compact succeeds");
+    ASSERT_TRUE(tree_matches(tree, limit, is_odd), "compact leaves a balanced tree of the live keys");
+    AVLTree_destroy(tree);
+
+    // Crossing the ratio compacts automatically; the tree stays correct throughout.
+    tree = build_multiples(1, limit);
+    AVLTree_setLazyDelete(tree, 0.25);
+    for (int k = 0; k < limit; ++k)
+        if (k % 2 == 0 || k % 3 == 0) AVLTree_delete(tree, &k);
+    AVLTree_compact(tree);
+    ASSERT_TRUE(tree_matches(tree, limit, odd_not_multiple_of_3), "Lazy deletes with automatic compaction leave the right keys");
+    ASSERT_TRUE(AVLTree_setLazyDelete(tree, 1.0) == STATUS_ERR_INVALID_ARGUMENT, "A tombstone ratio of 1 is rejected");
+    ASSERT_TRUE(AVLTree_setLazyDelete(tree, -0.5) == STATUS_ERR_INVALID_ARGUMENT, "A negative tombstone ratio is rejected");
+    key = 5;
+    AVLTree_delete(tree, &key);
+    ASSERT_TRUE(AVLTree_setLazyDelete(tree, 0.0) == STATUS_OK && AVLTree_search(tree, &key) == NULL, "Disabling lazy mode compacts");
+    ASSERT_TRUE(AVLTree_delete(tree, &(int){7}) == STATUS_OK && AVLTree_size(tree) == 998, "Deletes are eager again");
+    AVLTree_destroy(tree);
+    free(keys);
+}
+
+/**
+ * @brief Tests saving and loading tree snapshots.
+ */
+void test_snapshots() {
+    printf("\n--- Testing Snapshots ---\n");
+    char path[] = "/tmp/dsa-avltree-XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0, "Temporary snapshot file is created");
+
+    AVLTree* tree = AVLTree_init(sizeof(int), compare_int);
+    // Enough elements to span several write buffers.
+    for (int i = 0; i < 40000; i++) {
+        int key = (i * 7919) % 40000;
+        AVLTree_insert(tree, &key);
+    }
+    ASSERT_TRUE(AVLTree_save(tree, fd) == STATUS_OK, "save succeeds");
+
+    lseek(fd, 0, SEEK_SET);
+    AVLTree* loaded = AVLTree_load(fd, compare_int);
+    bool same = loaded && AVLTree_size(loaded) == 40000;
+    AVLTreeIterator it;
+    int expected = 0;
+    for (void* e = AVLTreeIterator_begin(&it, loaded); same && e; e = AVLTreeIterator_next(&it))
+        same = *(int*)e == expected++;
+    ASSERT_TRUE(same && expected == 40000, "load restores every element in order");
+    int key = 12345;
+    ASSERT_TRUE(AVLTree_rank(loaded, &key) == 12345, "A loaded tree answers order statistics");
+    ASSERT_TRUE(AVLTree_insert(loaded, &key) == STATUS_ERR_DUPLICATE_KEY, "A loaded tree keeps its keys unique");
+    AVLTree_destroy(loaded);
+
+    ArrayList* sorted = ArrayList_mapFile(path, sizeof(int));
+    ASSERT_TRUE(sorted && ArrayList_size(sorted) == 40000 && *(int*)ArrayList_at(sorted, 39999) == 39999,
+        "A tree snapshot maps as a sorted ArrayList");
+    ArrayList_destroy(sorted);
+
+    ftruncate(fd, 0);
+    lseek(fd, 0, SEEK_SET);
+    Heap* heap = Heap_init(0, sizeof(int), compare_int);
+    Heap_push(heap, &key);
+    Heap_save(heap, fd);
+    lseek(fd, 0, SEEK_SET);
+    ASSERT_TRUE(AVLTree_load(fd, compare_int) == NULL, "load rejects a heap snapshot");
+    Heap_destroy(heap);
+
+    AVLTree* empty = AVLTree_init(sizeof(int), compare_int);
+    ftruncate(fd, 0);
+    lseek(fd, 0, SEEK_SET);
+    AVLTree_save(empty, fd);
+    lseek(fd, 0, SEEK_SET);
+    loaded = AVLTree_load(fd, compare_int);
+    ASSERT_TRUE(loaded && AVLTree_size(loaded) == 0, "An empty tree round-trips");
+    AVLTree_destroy(loaded);
+    AVLTree_destroy(empty);
+    ASSERT_TRUE(AVLTree_save(NULL, fd) == STATUS_ERR_INVALID_ARGUMENT, "save rejects a NULL tree");
+
+    AVLTree_destroy(tree);
+    close(fd);
+    unlink(path);
+}
+
+/**
+ * @brief Tests the instrumentation counters.
+ */
+void test_stats() {
+    printf("\n--- Testing Stats ---\n");
+    AVLTree* tree = AVLTree_init(sizeof(int), compare_int);
+    // Ascending keys force a rotation on most insertions.
+    for (int i = 0; i < 1023; i++) AVLTree_insert(tree, &i);
+    int key = 5;
+    AVLTree_delete(tree, &key);
+
+    DsaStats stats;
+    ASSERT_TRUE(AVLTree_getStats(tree, &stats) == STATUS_OK, "getStats succeeds");
+    if (Dsa_statsEnabled()) {
+        ASSERT_EQUAL_INT(1023, stats.nodeAllocs, "nodeAllocs counts every insertion");
+        ASSERT_EQUAL_INT(1, stats.nodeFrees, "nodeFrees counts the deletion");
+        ASSERT_EQUAL_INT(10, stats.maxHeight, "1023 ascending keys build a perfect tree of 10 levels");
+        ASSERT_TRUE(stats.rotations >= 1000, "Ascending insertions rotate");
+        ASSERT_TRUE(stats.comparisons > 1023, "Descents count comparisons");
+    } else {
+        ASSERT_TRUE(stats.nodeAllocs == 0 && stats.rotations == 0, "Counters read 0 without DSA_STATS");
+    }
+    ASSERT_TRUE(AVLTree_getStats(NULL, &stats) == STATUS_ERR_INVALID_ARGUMENT, "getStats rejects a NULL tree");
+    AVLTree_destroy(tree);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -170,6 +662,14 @@ int main() {
     printf("========================================\n");
 
     test_avl_rotations_and_operations();
+    test_pooled_tree();
+    test_large_workload();
+    test_order_statistics();
+    test_iterator();
+    test_bulk_and_set_operations();
+    test_batch_and_lazy_delete();
+    test_snapshots();
+    test_stats();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
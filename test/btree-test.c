@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <dsa-lib/btree.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+// Comparison function for integers.
+int compare_int(const void* a, const void* b) {
+    int int_a = *(const int*)a;
+    int int_b = *(const int*)b;
+    return (int_a > int_b) - (int_a < int_b);
+}
+
+// A record large enough that each node holds only the minimum number of elements.
+typedef struct {
+    int id;
+    char payload[196];
+} Record;
+
+int compare_record(const void* a, const void* b) {
+    return compare_int(&((const Record*)a)->id, &((const Record*)b)->id);
+}
+
+// Small deterministic generator so the workloads are reproducible.
+static unsigned int rng_state = 12345;
+unsigned int next_random() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// Checks that iteration yields exactly the keys marked in `present`, in order.
+bool matches_reference(const BTree* tree, const bool* present, int limit) {
+    BTreeIterator it;
+    int* element = BTreeIterator_begin(&it, tree);
+    size_t seen = 0;
+    for (int k = 0; k < limit; ++k) {
+        if (!present[k]) continue;
+        if (!element || *element != k) return false;
+        element = BTreeIterator_next(&it);
+        seen++;
+    }
+    return element == NULL && seen == BTree_size(tree);
+}
+
+// visitRange callback collecting up to `limit` keys into a buffer.
+typedef struct {
+    int keys[64];
+    int count;
+    int limit;
+} RangeCollector;
+
+bool collect_range(void* element, void* ctx) {
+    RangeCollector* collector = ctx;
+    collector->keys[collector->count++] = *(int*)element;
+    return collector->count < collector->limit;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests basic insertion, search and deletion.
+ */
+void test_basic_operations() {
+    printf("\n--- Testing Basic Operations ---\n");
+    BTree* tree = BTree_init(sizeof(int), compare_int);
+    ASSERT_TRUE(tree != NULL, "BTree_init succeeds");
+    ASSERT_EQUAL_INT(0, BTree_size(tree), "New tree is empty");
+
+    int keys[] = {50, 20, 80, 10, 30, 70, 90};
+    for (int i = 0; i < 7; ++i) BTree_insert(tree, &keys[i]);
+    ASSERT_EQUAL_INT(7, BTree_size(tree), "Size is 7 after insertions");
+
+    int key = 30;
+    int* found = BTree_search(tree, &key);
+    ASSERT_TRUE(found != NULL && *found == 30, "Search finds an existing key");
+    key = 35;
+    ASSERT_TRUE(BTree_search(tree, &key) == NULL, "Search misses an absent key");
+
+    key = 20;
+    ASSERT_TRUE(BTree_insert(tree, &key) == STATUS_ERR_DUPLICATE_KEY, "Inserting a duplicate fails");
+    ASSERT_TRUE(BTree_delete(tree, &key) == STATUS_OK, "Deleting an existing key succeeds");
+    ASSERT_TRUE(BTree_search(tree, &key) == NULL, "Deleted key is gone");
+    ASSERT_TRUE(BTree_delete(tree, &key) == STATUS_ERR_KEY_NOT_FOUND, "Deleting it again fails");
+    ASSERT_EQUAL_INT(6, BTree_size(tree), "Size is 6 after deletion");
+
+    BTree_destroy(tree);
+}
+
+/**
+ * @brief Tests a large random workload against a reference set, exercising
+ * splits, borrows, merges and root changes.
+ */
+void test_large_workload() {
+    printf("\n--- Testing Large Workload ---\n");
+    enum { LIMIT = 20000 };
+    static bool present[LIMIT];
+    memset(present, 0, sizeof(present));
+    BTree* tree = BTree_init(sizeof(int), compare_int);
+
+    bool statuses_ok = true;
+    for (int i = 0; i < 3 * LIMIT; ++i) {
+        int key = (int)(next_random() % LIMIT);
+        STATUS expected = present[key] ? STATUS_ERR_DUPLICATE_KEY : STATUS_OK;
+        if (BTree_insert(tree, &key) != expected) statuses_ok = false;
+        present[key] = true;
+    }
+    ASSERT_TRUE(statuses_ok, "Random insertions report the expected statuses");
+    ASSERT_TRUE(matches_reference(tree, present, LIMIT), "Iteration matches the reference after insertions");
+
+    statuses_ok = true;
+    for (int i = 0; i < 2 * LIMIT; ++i) {
+        int key = (int)(next_random() % LIMIT);
+        STATUS expected = present[key] ? STATUS_OK : STATUS_ERR_KEY_NOT_FOUND;
+        if (BTree_delete(tree, &key) != expected) statuses_ok = false;
+        present[key] = false;
+    }
+    ASSERT_TRUE(statuses_ok, "Random deletions report the expected statuses");
+    ASSERT_TRUE(matches_reference(tree, present, LIMIT), "Iteration matches the reference after deletions");
+
+    bool searches_ok = true;
+    for (int key = 0; key < LIMIT; ++key) {
+        int* found = BTree_search(tree, &key);
+        if ((found != NULL) != present[key] || (found && *found != key)) searches_ok = false;
+    }
+    ASSERT_TRUE(searches_ok, "Every search agrees with the reference");
+
+    // Delete in ascending order, which repeatedly drains the leftmost leaves.
+    statuses_ok = true;
+    for (int key = 0; key < LIMIT; ++key) {
+        if (present[key] && BTree_delete(tree, &key) != STATUS_OK) statuses_ok = false;
+    }
+    ASSERT_TRUE(statuses_ok && BTree_size(tree) == 0, "Deleting everything empties the tree");
+    int key = 7;
+    ASSERT_TRUE(BTree_insert(tree, &key) == STATUS_OK && *(int*)BTree_search(tree, &key) == 7, "An emptied tree is reusable");
+
+    BTree_destroy(tree);
+}
+
+/**
+ * @brief Tests large elements, where nodes hold the minimum number of elements.
+ */
+void test_large_elements() {
+    printf("\n--- Testing Large Elements ---\n");
+    BTree* tree = BTree_init(sizeof(Record), compare_record);
+    Record record;
+    memset(&record, 0, sizeof(record));
+
+    bool ok = true;
+    for (int i = 0; i < 500; ++i) {
+        record.id = (i * 37) % 500;
+        snprintf(record.payload, sizeof(record.payload), "record %d", record.id);
+        if (BTree_insert(tree, &record) != STATUS_OK) ok = false;
+    }
+    ASSERT_TRUE(ok, "500 records are inserted");
+    for (int i = 0; i < 500; i += 2) {
+        record.id = i;
+        if (BTree_delete(tree, &record) != STATUS_OK) ok = false;
+    }
+    ASSERT_TRUE(ok && BTree_size(tree) == 250, "Even records are deleted");
+
+    record.id = 123;
+    Record* found = BTree_search(tree, &record);
+    ASSERT_TRUE(found && strcmp(found->payload, "record 123") == 0, "A record's payload survives splits and merges");
+
+    BTreeIterator it;
+    int expected = 1;
+    for (Record* r = BTreeIterator_begin(&it, tree); r; r = BTreeIterator_next(&it), expected += 2) {
+        if (r->id != expected) ok = false;
+    }
+    ASSERT_TRUE(ok && expected == 501, "Records iterate in order");
+
+    BTree_destroy(tree);
+}
+
+/**
+ * @brief Tests lower bounds, range visits and iterator seeks.
+ */
+void test_ranges() {
+    printf("\n--- Testing Ranges ---\n");
+    BTree* tree = BTree_init(sizeof(int), compare_int);
+    for (int key = 0; key < 1000; key += 10) BTree_insert(tree, &key);
+
+    int key = 455;
+    int* bound = BTree_lowerBound(tree, &key);
+    ASSERT_TRUE(bound && *bound == 460, "lowerBound finds the next larger key");
+    key = 460;
+    bound = BTree_lowerBound(tree, &key);
+    ASSERT_TRUE(bound && *bound == 460, "lowerBound finds an equal key");
+    key = 991;
+    ASSERT_TRUE(BTree_lowerBound(tree, &key) == NULL, "lowerBound past the end is NULL");
+
+    RangeCollector collector = {.count = 0, .limit = 64};
+    int lo = 95, hi = 150;
+    BTree_visitRange(tree, &lo, &hi, collect_range, &collector);
+    ASSERT_EQUAL_INT(6, collector.count, "visitRange visits the keys in [95, 150]");
+    ASSERT_TRUE(collector.keys[0] == 100 && collector.keys[5] == 150, "visitRange is ordered and inclusive");
+
+    collector.count = 0;
+    collector.limit = 3;
+    BTree_visitRange(tree, NULL, NULL, collect_range, &collector);
+    ASSERT_TRUE(collector.count == 3 && collector.keys[2] == 20, "visitRange stops when the callback returns false");
+
+    collector.count = 0;
+    collector.limit = 64;
+    BTree_visitRange(tree, &hi, &lo, collect_range, &collector);
+    ASSERT_EQUAL_INT(0, collector.count, "An inverted range visits nothing");
+
+    // A scan crossing many leaves.
+    BTreeIterator it;
+    int count = 0;
+    key = 200;
+    for (int* e = BTreeIterator_seek(&it, tree, &key); e && *e < 800; e = BTreeIterator_next(&it)) count++;
+    ASSERT_EQUAL_INT(60, count, "Iterator scans across leaves from a seek position");
+
+    BTree_destroy(tree);
+}
+
+/**
+ * @brief Tests edge cases and invalid arguments.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    ASSERT_TRUE(BTree_init(0, compare_int) == NULL, "init fails with dataSize 0");
+    ASSERT_TRUE(BTree_init(sizeof(int), NULL) == NULL, "init fails with NULL comparator");
+
+    int key = 1;
+    ASSERT_TRUE(BTree_insert(NULL, &key) == STATUS_ERR_INVALID_ARGUMENT, "insert fails with NULL tree");
+    ASSERT_TRUE(BTree_delete(NULL, &key) == STATUS_ERR_INVALID_ARGUMENT, "delete fails with NULL tree");
+    ASSERT_TRUE(BTree_search(NULL, &key) == NULL, "search on NULL tree returns NULL");
+    ASSERT_EQUAL_INT(0, BTree_size(NULL), "size of NULL tree is 0");
+
+    BTree* tree = BTree_init(sizeof(int), compare_int);
+    BTreeIterator it;
+    ASSERT_TRUE(BTreeIterator_begin(&it, tree) == NULL, "Iterator over an empty tree is exhausted");
+    ASSERT_TRUE(BTree_delete(tree, &key) == STATUS_ERR_KEY_NOT_FOUND, "delete from an empty tree fails");
+    ASSERT_TRUE(BTree_visitRange(tree, NULL, NULL, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "visitRange fails with NULL callback");
+    BTree_destroy(tree);
+    BTree_destroy(NULL);
+    ASSERT_TRUE(true, "destroy handles NULL");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("        Testing B+ Tree Module\n");
+    printf("========================================\n");
+
+    test_basic_operations();
+    test_large_workload();
+    test_large_elements();
+    test_ranges();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
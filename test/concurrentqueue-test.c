@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <dsa-lib/concurrentqueue.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+
+// =============================================================================
+// 2. Thread Workers for Testing
+// =============================================================================
+
+#define SPSC_ITEMS 200000
+#define MPMC_THREADS 4
+#define MPMC_ITEMS_PER_PRODUCER 50000
+
+typedef struct {
+    int producer;
+    int seq;
+} Item;
+
+static SPSCQueue* spsc;
+static MPMCQueue* mpmc;
+static bool spsc_order_correct = true;
+static long long mpmc_consumed_sum[MPMC_THREADS];
+static int mpmc_consumed_count[MPMC_THREADS];
+
+void* spsc_producer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < SPSC_ITEMS; ++i) {
+        while (SPSCQueue_enqueue(spsc, &i) == STATUS_ERR_FULL)
+            ;
+    }
+    return NULL;
+}
+
+void* spsc_consumer(void* arg) {
+    (void)arg;
+    for (int expected = 0; expected < SPSC_ITEMS; ++expected) {
+        int val;
+        while (SPSCQueue_dequeue(spsc, &val) == STATUS_ERR_EMPTY)
+            ;
+        if (val != expected) spsc_order_correct = false;
+    }
+    return NULL;
+}
+
+void* mpmc_producer(void* arg) {
+    int id = *(int*)arg;
+    for (int i = 0; i < MPMC_ITEMS_PER_PRODUCER; ++i) {
+        Item item = {id, i};
+        while (MPMCQueue_enqueue(mpmc, &item) == STATUS_ERR_FULL)
+            ;
+    }
+    return NULL;
+}
+
+void* mpmc_consumer(void* arg) {
+    int id = *(int*)arg;
+    for (int i = 0; i < MPMC_ITEMS_PER_PRODUCER; ++i) {
+        Item item;
+        while (MPMCQueue_dequeue(mpmc, &item) == STATUS_ERR_EMPTY)
+            ;
+        mpmc_consumed_sum[id] += item.seq;
+        mpmc_consumed_count[id]++;
+    }
+    return NULL;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests single-threaded SPSC semantics: FIFO order, full and empty.
+ */
+void test_spsc_basic() {
+    printf("\n--- Testing SPSCQueue Basics ---\n");
+    SPSCQueue* q = SPSCQueue_init(3, sizeof(int));
+    ASSERT_TRUE(q != NULL, "SPSC queue initialization");
+    ASSERT_EQUAL_INT(4, SPSCQueue_capacity(q), "Capacity is rounded up to a power of two");
+
+    int val;
+    ASSERT_TRUE(SPSCQueue_dequeue(q, &val) == STATUS_ERR_EMPTY, "Dequeue from empty queue reports EMPTY");
+    for (int i = 0; i < 4; ++i) SPSCQueue_enqueue(q, &i);
+    ASSERT_EQUAL_INT(4, SPSCQueue_size(q), "Size is 4 after filling");
+    ASSERT_TRUE(SPSCQueue_enqueue(q, &val) == STATUS_ERR_FULL, "Enqueue into full queue reports FULL");
+
+    SPSCQueue_dequeue(q, &val);
+    ASSERT_EQUAL_INT(0, val, "First dequeued value is 0");
+    int wrapped = 4;
+    ASSERT_TRUE(SPSCQueue_enqueue(q, &wrapped) == STATUS_OK, "Enqueue succeeds after a slot is freed");
+
+    bool order_correct = true;
+    for (int expected = 1; expected <= 4; ++expected) {
+        SPSCQueue_dequeue(q, &val);
+        if (val != expected) order_correct = false;
+    }
+    ASSERT_TRUE(order_correct, "Elements dequeue in FIFO order across the wrap");
+
+    SPSCQueue_destroy(q);
+}
+
+/**
+ * @brief Tests one producer and one consumer running concurrently.
+ */
+void test_spsc_threads() {
+    printf("\n--- Testing SPSCQueue Across Threads ---\n");
+    spsc = SPSCQueue_init(1024, sizeof(int));
+    pthread_t producer, consumer;
+    pthread_create(&consumer, NULL, spsc_consumer, NULL);
+    pthread_create(&producer, NULL, spsc_producer, NULL);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    ASSERT_TRUE(spsc_order_correct, "Consumer observes every element in order");
+    ASSERT_EQUAL_INT(0, SPSCQueue_size(spsc), "Queue is empty after the run");
+    SPSCQueue_destroy(spsc);
+    spsc = NULL;
+}
+
+/**
+ * @brief Tests single-threaded MPMC semantics: FIFO order, full and empty.
+ */
+void test_mpmc_basic() {
+    printf("\n--- Testing MPMCQueue Basics ---\n");
+    MPMCQueue* q = MPMCQueue_init(1, sizeof(int));
+    ASSERT_TRUE(q != NULL, "MPMC queue initialization");
+    ASSERT_EQUAL_INT(2, MPMCQueue_capacity(q), "Capacity is at least 2");
+
+    int val;
+    ASSERT_TRUE(MPMCQueue_dequeue(q, &val) == STATUS_ERR_EMPTY, "Dequeue from empty queue reports EMPTY");
+    int a = 7, b = 8;
+    MPMCQueue_enqueue(q, &a);
+    MPMCQueue_enqueue(q, &b);
+    ASSERT_TRUE(MPMCQueue_enqueue(q, &a) == STATUS_ERR_FULL, "Enqueue into full queue reports FULL");
+    ASSERT_EQUAL_INT(2, MPMCQueue_size(q), "Size is 2 after filling");
+
+    MPMCQueue_dequeue(q, &val);
+    ASSERT_EQUAL_INT(7, val, "First dequeued value is 7");
+    MPMCQueue_dequeue(q, &val);
+    ASSERT_EQUAL_INT(8, val, "Second dequeued value is 8");
+    ASSERT_EQUAL_INT(0, MPMCQueue_size(q), "Queue is empty again");
+
+    MPMCQueue_destroy(q);
+}
+
+/**
+ * @brief Tests several producers and consumers running concurrently.
+ */
+void test_mpmc_threads() {
+    printf("\n--- Testing MPMCQueue Across Threads ---\n");
+    mpmc = MPMCQueue_init(256, sizeof(Item));
+    pthread_t producers[MPMC_THREADS], consumers[MPMC_THREADS];
+    int ids[MPMC_THREADS];
+    for (int i = 0; i < MPMC_THREADS; ++i) {
+        ids[i] = i;
+        pthread_create(&consumers[i], NULL, mpmc_consumer, &ids[i]);
+        pthread_create(&producers[i], NULL, mpmc_producer, &ids[i]);
+    }
+    for (int i = 0; i < MPMC_THREADS; ++i) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    long long total = 0, expected = 0;
+    int count = 0;
+    for (int i = 0; i < MPMC_THREADS; ++i) {
+        total += mpmc_consumed_sum[i];
+        count += mpmc_consumed_count[i];
+    }
+    for (int i = 0; i < MPMC_ITEMS_PER_PRODUCER; ++i) expected += i;
+    expected *= MPMC_THREADS;
+
+    ASSERT_EQUAL_INT(MPMC_THREADS * MPMC_ITEMS_PER_PRODUCER, count, "Every produced element is consumed once");
+    ASSERT_TRUE(total == expected, "Consumed payloads match produced payloads");
+    MPMCQueue_destroy(mpmc);
+    mpmc = NULL;
+}
+
+/**
+ * @brief Tests edge cases and invalid inputs.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    int val = 1;
+
+    ASSERT_TRUE(SPSCQueue_init(0, sizeof(int)) == NULL, "SPSC init with capacity 0 fails");
+    ASSERT_TRUE(SPSCQueue_init(4, 0) == NULL, "SPSC init with dataSize 0 fails");
+    ASSERT_TRUE(MPMCQueue_init(0, sizeof(int)) == NULL, "MPMC init with capacity 0 fails");
+    ASSERT_TRUE(MPMCQueue_init(4, 0) == NULL, "MPMC init with dataSize 0 fails");
+    ASSERT_TRUE(SPSCQueue_enqueue(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "SPSC enqueue with NULL queue fails");
+    ASSERT_TRUE(SPSCQueue_dequeue(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "SPSC dequeue with NULL queue fails");
+    ASSERT_TRUE(MPMCQueue_enqueue(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "MPMC enqueue with NULL queue fails");
+    ASSERT_TRUE(MPMCQueue_dequeue(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "MPMC dequeue with NULL queue fails");
+    ASSERT_EQUAL_INT(0, SPSCQueue_size(NULL), "SPSC size on NULL queue is 0");
+    ASSERT_EQUAL_INT(0, MPMCQueue_size(NULL), "MPMC size on NULL queue is 0");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("    Testing ConcurrentQueue Module\n");
+    printf("========================================\n");
+
+    test_spsc_basic();
+    test_spsc_threads();
+    test_mpmc_basic();
+    test_mpmc_threads();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <dsa-lib/concurrentskiplist.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+// A map entry: ordered by key, with a value derived from it so torn or stale reads show up.
+typedef struct {
+    int key;
+    int value;
+} Entry;
+
+int compare_entry(const void* a, const void* b) {
+    int x = ((const Entry*)a)->key, y = ((const Entry*)b)->key;
+    return (x > y) - (x < y);
+}
+
+Entry make_entry(int key) {
+    Entry entry = { key, key * 3 + 1 };
+    return entry;
+}
+
+// forEach callback checking ascending order and counting entries.
+typedef struct {
+    int last;
+    int count;
+    bool ordered;
+} Walk;
+
+bool walk_entry(const void* element, void* ctx) {
+    Walk* walk = ctx;
+    const Entry* entry = element;
+    if (walk->count > 0 && entry->key <= walk->last) walk->ordered = false;
+    if (entry->value != entry->key * 3 + 1) walk->ordered = false;
+    walk->last = entry->key;
+    walk->count++;
+    return true;
+}
+
+bool stop_after_three(const void* element, void* ctx) {
+    (void)element;
+    return ++*(int*)ctx < 3;
+}
+
+// Small deterministic generator so the workloads are reproducible.
+unsigned int next_random(unsigned int* state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+#define THREADS 4
+#define KEYS_PER_THREAD 20000
+
+typedef struct {
+    ConcurrentSkipList* list;
+    int id;
+    atomic_int* errors;
+    atomic_bool* stop;
+} Worker;
+
+// Inserts its own range of keys, deletes the odd ones, and checks every step.
+void* writer_main(void* arg) {
+    Worker* w = arg;
+    int base = w->id * KEYS_PER_THREAD;
+    for (int i = 0; i < KEYS_PER_THREAD; i++) {
+        Entry entry = make_entry(base + i);
+        if (ConcurrentSkipList_insert(w->list, &entry) != STATUS_OK) atomic_fetch_add(w->errors, 1);
+    }
+    for (int i = 1; i < KEYS_PER_THREAD; i += 2) {
+        Entry key = { base + i, 0 };
+        if (ConcurrentSkipList_delete(w->list, &key) != STATUS_OK) atomic_fetch_add(w->errors, 1);
+    }
+    return NULL;
+}
+
+// Looks up random keys while the writers run; any entry found must be intact.
+void* reader_main(void* arg) {
+    Worker* w = arg;
+    unsigned int state = (unsigned int)w->id;
+    while (!atomic_load(w->stop)) {
+        Entry key = { (int)(next_random(&state) % (THREADS * KEYS_PER_THREAD)), 0 }, found;
+        if (ConcurrentSkipList_search(w->list, &key, &found) == STATUS_OK
+            && (found.key != key.key || found.value != key.key * 3 + 1))
+            atomic_fetch_add(w->errors, 1);
+        if (ConcurrentSkipList_lowerBound(w->list, &key, &found) == STATUS_OK
+            && (found.key < key.key || found.value != found.key * 3 + 1))
+            atomic_fetch_add(w->errors, 1);
+    }
+    return NULL;
+}
+
+// Every thread fights over the same small key range.
+void* contender_main(void* arg) {
+    Worker* w = arg;
+    unsigned int state = (unsigned int)w->id * 7 + 1;
+    for (int i = 0; i < 50000; i++) {
+        Entry entry = make_entry((int)(next_random(&state) % 64));
+        STATUS status = (next_random(&state) & 1)
+            ? ConcurrentSkipList_insert(w->list, &entry)
+            : ConcurrentSkipList_delete(w->list, &entry);
+        if (status != STATUS_OK && status != STATUS_ERR_DUPLICATE_KEY && status != STATUS_ERR_KEY_NOT_FOUND)
+            atomic_fetch_add(w->errors, 1);
+    }
+    return NULL;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests single-threaded insert, delete, search, lowerBound and forEach.
+ */
+void test_basic_operations() {
+    printf("\n--- Testing Basic Operations ---\n");
+    ConcurrentSkipList* list = ConcurrentSkipList_init(sizeof(Entry), compare_entry);
+    ASSERT_TRUE(list != NULL, "List initializes");
+
+    bool ok = true;
+    for (int i = 0; i < 1000; i++) {
+        Entry entry = make_entry((i * 617) % 1000 * 2);
+        if (ConcurrentSkipList_insert(list, &entry) != STATUS_OK) ok = false;
+    }
+    ASSERT_TRUE(ok, "Inserts of distinct keys succeed");
+    ASSERT_EQUAL_INT(1000, ConcurrentSkipList_size(list), "size counts every element");
+
+    Entry entry = make_entry(500), found;
+    ASSERT_EQUAL_INT(STATUS_ERR_DUPLICATE_KEY, ConcurrentSkipList_insert(list, &entry), "Duplicate insert fails");
+    ASSERT_TRUE(ConcurrentSkipList_search(list, &entry, &found) == STATUS_OK && found.value == 1501, "search copies the element out");
+    Entry odd = { 501, 0 };
+    ASSERT_EQUAL_INT(STATUS_ERR_KEY_NOT_FOUND, ConcurrentSkipList_search(list, &odd, NULL), "search misses an absent key");
+    ASSERT_TRUE(ConcurrentSkipList_lowerBound(list, &odd, &found) == STATUS_OK && found.key == 502, "lowerBound finds the next key");
+    Entry beyond = { 5000, 0 };
+    ASSERT_EQUAL_INT(STATUS_ERR_KEY_NOT_FOUND, ConcurrentSkipList_lowerBound(list, &beyond, &found), "lowerBound past the end fails");
+
+    for (int i = 0; i < 2000; i += 4) {
+        Entry key = { i, 0 };
+        if (ConcurrentSkipList_delete(list, &key) != STATUS_OK) ok = false;
+    }
+    ASSERT_TRUE(ok, "Deletes of present keys succeed");
+    ASSERT_EQUAL_INT(STATUS_ERR_KEY_NOT_FOUND, ConcurrentSkipList_delete(list, &entry), "Deleting twice fails");
+    ASSERT_EQUAL_INT(500, ConcurrentSkipList_size(list), "size drops with each delete");
+
+    Walk walk = { 0, 0, true };
+    ConcurrentSkipList_forEach(list, walk_entry, &walk);
+    ASSERT_TRUE(walk.ordered && walk.count == 500, "forEach visits the survivors in ascending order");
+    int visited = 0;
+    ConcurrentSkipList_forEach(list, stop_after_three, &visited);
+    ASSERT_EQUAL_INT(3, visited, "forEach stops when the callback returns false");
+
+    ASSERT_TRUE(ConcurrentSkipList_insert(list, &entry) == STATUS_OK, "A deleted key can be inserted again");
+    ConcurrentSkipList_destroy(list);
+}
+
+/**
+ * @brief Tests writers and readers running at the same time.
+ */
+void test_concurrent_access() {
+    printf("\n--- Testing Concurrent Access ---\n");
+    ConcurrentSkipList* list = ConcurrentSkipList_init(sizeof(Entry), compare_entry);
+    atomic_int errors = 0;
+    atomic_bool stop = false;
+    pthread_t writers[THREADS], readers[THREADS];
+    Worker writerArgs[THREADS], readerArgs[THREADS];
+
+    for (int i = 0; i < THREADS; i++) {
+        readerArgs[i] = (Worker){ list, i + 1, &errors, &stop };
+        pthread_create(&readers[i], NULL, reader_main, &readerArgs[i]);
+    }
+    for (int i = 0; i < THREADS; i++) {
+        writerArgs[i] = (Worker){ list, i, &errors, &stop };
+        pthread_create(&writers[i], NULL, writer_main, &writerArgs[i]);
+    }
+    for (int i = 0; i < THREADS; i++) pthread_join(writers[i], NULL);
+    atomic_store(&stop, true);
+    for (int i = 0; i < THREADS; i++) pthread_join(readers[i], NULL);
+
+    ASSERT_EQUAL_INT(0, atomic_load(&errors), "Every operation succeeds and every read is intact");
+    ASSERT_EQUAL_INT(THREADS * KEYS_PER_THREAD / 2, ConcurrentSkipList_size(list), "size is exact once quiescent");
+    Walk walk = { 0, 0, true };
+    ConcurrentSkipList_forEach(list, walk_entry, &walk);
+    ASSERT_TRUE(walk.ordered && walk.count == THREADS * KEYS_PER_THREAD / 2, "The survivors are intact and ordered");
+
+    bool evens = true;
+    for (int k = 0; k < THREADS * KEYS_PER_THREAD; k++) {
+        Entry key = { k, 0 };
+        if ((ConcurrentSkipList_search(list, &key, NULL) == STATUS_OK) != (k % 2 == 0)) evens = false;
+    }
+    ASSERT_TRUE(evens, "Exactly the even keys remain");
+    ConcurrentSkipList_destroy(list);
+
+    list = ConcurrentSkipList_init(sizeof(Entry), compare_entry);
+    pthread_t contenders[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        writerArgs[i] = (Worker){ list, i, &errors, &stop };
+        pthread_create(&contenders[i], NULL, contender_main, &writerArgs[i]);
+    }
+    for (int i = 0; i < THREADS; i++) pthread_join(contenders[i], NULL);
+    walk = (Walk){ 0, 0, true };
+    ConcurrentSkipList_forEach(list, walk_entry, &walk);
+    ASSERT_EQUAL_INT(0, atomic_load(&errors), "Contended inserts and deletes only report expected statuses");
+    ASSERT_TRUE(walk.ordered && (size_t)walk.count == ConcurrentSkipList_size(list), "A contended list stays consistent with its size");
+    ConcurrentSkipList_destroy(list);
+}
+
+/**
+ * @brief Tests edge cases and invalid inputs.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    ASSERT_TRUE(ConcurrentSkipList_init(0, compare_entry) == NULL, "init fails with zero data size");
+    ASSERT_TRUE(ConcurrentSkipList_init(sizeof(Entry), NULL) == NULL, "init fails with NULL comparator");
+
+    ConcurrentSkipList* list = ConcurrentSkipList_init(sizeof(Entry), compare_entry);
+    Entry entry = make_entry(1), found;
+    ASSERT_EQUAL_INT(STATUS_ERR_KEY_NOT_FOUND, ConcurrentSkipList_delete(list, &entry), "delete on an empty list fails");
+    ASSERT_EQUAL_INT(STATUS_ERR_KEY_NOT_FOUND, ConcurrentSkipList_lowerBound(list, &entry, &found), "lowerBound on an empty list fails");
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, ConcurrentSkipList_insert(NULL, &entry), "insert rejects a NULL list");
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, ConcurrentSkipList_insert(list, NULL), "insert rejects a NULL element");
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, ConcurrentSkipList_search(list, NULL, NULL), "search rejects a NULL key");
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, ConcurrentSkipList_lowerBound(list, &entry, NULL), "lowerBound needs an output");
+    ASSERT_EQUAL_INT(STATUS_ERR_INVALID_ARGUMENT, ConcurrentSkipList_forEach(list, NULL, NULL), "forEach rejects a NULL callback");
+    ASSERT_EQUAL_INT(0, ConcurrentSkipList_size(NULL), "size of NULL is 0");
+    ConcurrentSkipList_destroy(list);
+    ConcurrentSkipList_destroy(NULL);
+    ASSERT_TRUE(true, "destroy handles NULL");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("    Testing ConcurrentSkipList Module\n");
+    printf("========================================\n");
+
+    test_basic_operations();
+    test_concurrent_access();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
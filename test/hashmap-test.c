@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <dsa-lib/hashmap.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+// Identity hash for integers; the map mixes the bits itself.
+size_t hash_int(const void* key) {
+    return (size_t)*(const int*)key;
+}
+
+bool equals_int(const void* a, const void* b) {
+    return *(const int*)a == *(const int*)b;
+}
+
+// A hash that sends every key to the same home slot, forcing one long cluster.
+size_t hash_constant(const void* key) {
+    (void)key;
+    return 42;
+}
+
+// Keys that are C strings stored by pointer.
+size_t hash_string(const void* key) {
+    const char* s = *(const char* const*)key;
+    return HashMap_hashBytes(s, strlen(s));
+}
+
+bool equals_string(const void* a, const void* b) {
+    return strcmp(*(const char* const*)a, *(const char* const*)b) == 0;
+}
+
+// A composite key compared byte for byte by the default equality.
+typedef struct {
+    short x;
+    short y;
+} Point;
+
+// Small deterministic generator so the workloads are reproducible.
+static unsigned int rng_state = 2024;
+unsigned int next_random() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// forEach callback summing the values of an int -> long map.
+bool sum_values(const void* key, void* value, void* ctx) {
+    (void)key;
+    *(long*)ctx += *(long*)value;
+    return true;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests insertion, lookup, replacement and removal.
+ */
+void test_basic_operations() {
+    printf("\n--- Testing Basic Operations ---\n");
+    HashMap* map = HashMap_init(sizeof(int), sizeof(long), hash_int, equals_int);
+    ASSERT_TRUE(map != NULL, "HashMap_init succeeds");
+    ASSERT_EQUAL_INT(0, HashMap_capacity(map), "No table is allocated before the first insertion");
+
+    for (int key = 0; key < 100; ++key) {
+        long value = key * 10L;
+        HashMap_insert(map, &key, &value);
+    }
+    ASSERT_EQUAL_INT(100, HashMap_size(map), "Size is 100 after insertions");
+
+    int key = 42;
+    long* value = HashMap_get(map, &key);
+    ASSERT_TRUE(value && *value == 420, "get finds the value of a key");
+    key = 100;
+    ASSERT_TRUE(HashMap_get(map, &key) == NULL && !HashMap_contains(map, &key), "get misses an absent key");
+
+    key = 7;
+    long replacement = -1;
+    ASSERT_TRUE(HashMap_insert(map, &key, &replacement) == STATUS_ERR_DUPLICATE_KEY, "insert rejects a duplicate key");
+    ASSERT_EQUAL_INT(70, *(long*)HashMap_get(map, &key), "A rejected insert leaves the value unchanged");
+    ASSERT_TRUE(HashMap_put(map, &key, &replacement) == STATUS_OK, "put replaces an existing value");
+    ASSERT_EQUAL_INT(-1, *(long*)HashMap_get(map, &key), "The replaced value is visible");
+    ASSERT_EQUAL_INT(100, HashMap_size(map), "put on an existing key does not change the size");
+
+    long removed = 0;
+    ASSERT_TRUE(HashMap_remove(map, &key, &removed) == STATUS_OK && removed == -1, "remove returns the removed value");
+    ASSERT_TRUE(!HashMap_contains(map, &key), "Removed key is gone");
+    ASSERT_TRUE(HashMap_remove(map, &key, NULL) == STATUS_ERR_KEY_NOT_FOUND, "Removing it again fails");
+
+    long sum = 0;
+    HashMap_forEach(map, sum_values, &sum);
+    ASSERT_TRUE(sum == 49500 - 70, "forEach visits every value once");
+
+    HashMap_clear(map);
+    ASSERT_TRUE(HashMap_size(map) == 0 && HashMap_capacity(map) > 0, "clear empties the map and keeps its table");
+    key = 1;
+    ASSERT_TRUE(!HashMap_contains(map, &key), "A cleared map is empty");
+
+    HashMap_destroy(map);
+}
+
+/**
+ * @brief Tests a random workload against a reference, including backward-shift removal.
+ */
+void test_large_workload() {
+    printf("\n--- Testing Large Workload ---\n");
+    enum { LIMIT = 50000 };
+    static int reference[LIMIT];
+    for (int i = 0; i < LIMIT; ++i) reference[i] = -1;
+    HashMap* map = HashMap_init(sizeof(int), sizeof(int), hash_int, equals_int);
+
+    bool ok = true;
+    for (int i = 0; i < 4 * LIMIT; ++i) {
+        int key = (int)(next_random() % LIMIT);
+        if (next_random() % 3 == 0) {
+            STATUS expected = reference[key] >= 0 ? STATUS_OK : STATUS_ERR_KEY_NOT_FOUND;
+            if (HashMap_remove(map, &key, NULL) != expected) ok = false;
+            reference[key] = -1;
+        } else {
+            if (HashMap_put(map, &key, &i) != STATUS_OK) ok = false;
+            reference[key] = i;
+        }
+    }
+    ASSERT_TRUE(ok, "Random puts and removes report the expected statuses");
+
+    size_t expected_size = 0;
+    for (int key = 0; key < LIMIT; ++key) {
+        int* value = HashMap_get(map, &key);
+        if (reference[key] >= 0) {
+            expected_size++;
+            if (!value || *value != reference[key]) ok = false;
+        } else if (value) {
+            ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "Every lookup agrees with the reference");
+    ASSERT_TRUE(HashMap_size(map) == expected_size, "Size agrees with the reference");
+    ASSERT_TRUE(HashMap_size(map) <= HashMap_capacity(map) - HashMap_capacity(map) / 8, "Load stays at or below 7/8");
+
+    HashMap_destroy(map);
+}
+
+/**
+ * @brief Tests that every key still resolves when all keys collide.
+ */
+void test_degenerate_hash() {
+    printf("\n--- Testing Degenerate Hash ---\n");
+    HashMap* map = HashMap_init(sizeof(int), 0, hash_constant, equals_int);
+
+    bool ok = true;
+    for (int key = 0; key < 500; ++key)
+        if (HashMap_insert(map, &key, NULL) != STATUS_OK) ok = false;
+    for (int key = 0; key < 500; key += 2)
+        if (HashMap_remove(map, &key, NULL) != STATUS_OK) ok = false;
+    ASSERT_TRUE(ok, "Colliding keys are inserted and removed");
+
+    for (int key = 0; key < 500; ++key)
+        if (HashMap_contains(map, &key) != (key % 2 == 1)) ok = false;
+    ASSERT_TRUE(ok && HashMap_size(map) == 250, "Colliding keys resolve after removals");
+
+    HashMap_destroy(map);
+}
+
+/**
+ * @brief Tests hash sets, default hashing and equality, and pointer keys.
+ */
+void test_sets_and_key_types() {
+    printf("\n--- Testing Sets and Key Types ---\n");
+    HashMap* set = HashMap_init(sizeof(Point), 0, NULL, NULL);
+    Point p = {3, -4};
+    ASSERT_TRUE(HashMap_insert(set, &p, NULL) == STATUS_OK, "A set accepts a key without a value");
+    Point same = {3, -4};
+    Point* stored = HashMap_get(set, &same);
+    ASSERT_TRUE(stored && stored->x == 3 && stored->y == -4, "A set's get returns the stored key");
+    Point other = {-4, 3};
+    ASSERT_TRUE(!HashMap_contains(set, &other), "Default equality tells distinct keys apart");
+    HashMap_destroy(set);
+
+    HashMap* words = HashMap_init(sizeof(const char*), sizeof(int), hash_string, equals_string);
+    const char* names[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 4; ++i) HashMap_insert(words, &names[i], &i);
+    char buffer[16];
+    strcpy(buffer, "gamma");
+    const char* lookup = buffer;
+    int* index = HashMap_get(words, &lookup);
+    ASSERT_TRUE(index && *index == 2, "String keys are found by content");
+    HashMap_destroy(words);
+}
+
+/**
+ * @brief Tests that reserve sizes the table up front.
+ */
+void test_reserve() {
+    printf("\n--- Testing Reserve ---\n");
+    HashMap* map = HashMap_init(sizeof(int), sizeof(int), hash_int, NULL);
+    ASSERT_TRUE(HashMap_reserve(map, 1000) == STATUS_OK, "reserve succeeds");
+    size_t capacity = HashMap_capacity(map);
+    ASSERT_TRUE(capacity >= 1000 + 1000 / 7, "reserve leaves room under the load limit");
+
+    bool ok = true;
+    for (int key = 0; key < 1000; ++key)
+        if (HashMap_insert(map, &key, &key) != STATUS_OK) ok = false;
+    ASSERT_TRUE(ok && HashMap_capacity(map) == capacity, "Reserved insertions do not rehash");
+
+    ASSERT_TRUE(HashMap_reserve(map, 10) == STATUS_OK && HashMap_capacity(map) == capacity, "A smaller reserve is a no-op");
+    HashMap_destroy(map);
+}
+
+/**
+ * @brief Tests the instrumentation counters.
+ */
+void test_stats() {
+    printf("\n--- Testing Stats ---\n");
+    HashMap* map = HashMap_init(sizeof(int), sizeof(int), hash_int, equals_int);
+    for (int i = 0; i < 1000; i++) HashMap_insert(map, &i, &i);
+    for (int i = 0; i < 1000; i++) HashMap_get(map, &i);
+
+    DsaStats stats;
+    ASSERT_TRUE(HashMap_getStats(map, &stats) == STATUS_OK, "getStats succeeds");
+    if (Dsa_statsEnabled()) {
+        ASSERT_TRUE(stats.reallocs >= 6, "Growing to 1000 entries rehashes repeatedly");
+        ASSERT_TRUE(stats.comparisons >= 1000, "Every successful lookup compares its key");
+        ASSERT_TRUE(stats.probes >= 2000 && stats.maxProbe >= 1, "Lookups and insertions count their probes");
+    } else {
+        ASSERT_TRUE(stats.reallocs == 0 && stats.probes == 0, "Counters read 0 without DSA_STATS");
+    }
+    ASSERT_TRUE(HashMap_getStats(NULL, &stats) == STATUS_ERR_INVALID_ARGUMENT, "getStats rejects a NULL map");
+    HashMap_destroy(map);
+}
+
+/**
+ * @brief Tests edge cases and invalid arguments.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    ASSERT_TRUE(HashMap_init(0, sizeof(int), NULL, NULL) == NULL, "init fails with keySize 0");
+
+    int key = 1;
+    ASSERT_TRUE(HashMap_insert(NULL, &key, &key) == STATUS_ERR_INVALID_ARGUMENT, "insert fails with NULL map");
+    ASSERT_TRUE(HashMap_get(NULL, &key) == NULL, "get on NULL map returns NULL");
+    ASSERT_EQUAL_INT(0, HashMap_size(NULL), "size of NULL map is 0");
+
+    HashMap* map = HashMap_init(sizeof(int), sizeof(int), NULL, NULL);
+    ASSERT_TRUE(HashMap_insert(map, &key, NULL) == STATUS_ERR_INVALID_ARGUMENT, "A map requires a value");
+    ASSERT_TRUE(HashMap_get(map, &key) == NULL, "get on an empty map returns NULL");
+    ASSERT_TRUE(HashMap_remove(map, &key, NULL) == STATUS_ERR_KEY_NOT_FOUND, "remove from an empty map fails");
+    ASSERT_TRUE(HashMap_forEach(map, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "forEach fails with NULL callback");
+    HashMap_destroy(map);
+    HashMap_destroy(NULL);
+    ASSERT_TRUE(true, "destroy handles NULL");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("        Testing HashMap Module\n");
+    printf("========================================\n");
+
+    test_basic_operations();
+    test_large_workload();
+    test_degenerate_hash();
+    test_sets_and_key_types();
+    test_reserve();
+    test_stats();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <dsa-lib/heap.h>
 
 // =============================================================================
@@ -129,6 +131,239 @@ void test_max_heap() {
     Heap_destroy(h);
 }
 
+/**
+ * @brief Tests interleaved push/pop on a larger heap against a sorted reference.
+ */
+void test_interleaved_push_pop() {
+    printf("\n--- Testing Interleaved Push/Pop ---\n");
+    Heap* h = Heap_init(0, sizeof(int), compare_int_min);
+
+    // Push 1000 pseudo-random values, popping one after every third push.
+    unsigned int seed = 12345;
+    int last_popped = -1;
+    bool order_correct = true;
+    size_t pops = 0;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int val = (int)((seed >> 16) % 10000);
+        Heap_push(h, &val);
+        if (i % 3 == 2) {
+            int popped;
+            Heap_pop(h, &popped);
+            pops++;
+            // Each pop must return the minimum currently in the heap.
+            int peeked;
+            if (Heap_peek(h, &peeked) == STATUS_OK && peeked < popped) order_correct = false;
+        }
+    }
+    ASSERT_EQUAL_INT(1000 - pops, Heap_size(h), "Size matches pushes minus pops");
+
+    while (Heap_size(h) > 0) {
+        int popped;
+        Heap_pop(h, &popped);
+        if (popped < last_popped) order_correct = false;
+        last_popped = popped;
+    }
+    ASSERT_TRUE(order_correct, "Pops always return elements in heap order");
+
+    Heap_destroy(h);
+}
+
+/**
+ * @brief Tests bulk construction and batched push/pop.
+ */
+void test_bulk_operations() {
+    printf("\n--- Testing Bulk Construction and Batches ---\n");
+    int values[] = {42, 7, 19, 3, 88, 61, 5, 24, 11, 70};
+    Heap* h = Heap_initFromArray(values, 10, sizeof(int), compare_int_min);
+    ASSERT_TRUE(h != NULL, "Heap_initFromArray succeeds");
+    ASSERT_EQUAL_INT(10, Heap_size(h), "Bulk-built heap holds every element");
+    ASSERT_EQUAL_INT(3, *(const int*)Heap_top(h), "Heap_top borrows the root without copying");
+
+    int top[3];
+    ASSERT_TRUE(Heap_popMany(h, top, 3) == STATUS_OK, "popMany of 3 succeeds");
+    ASSERT_TRUE(top[0] == 3 && top[1] == 5 && top[2] == 7, "popMany returns the 3 smallest in order");
+    ASSERT_EQUAL_INT(7, Heap_size(h), "Size is 7 after popping 3");
+
+    // A small batch is sifted in, a large batch triggers a rebuild.
+    int small_batch[] = {1, 100};
+    Heap_pushMany(h, small_batch, 2);
+    int large_batch[20];
+    for (int i = 0; i < 20; ++i) large_batch[i] = 200 - i;
+    Heap_pushMany(h, large_batch, 20);
+    ASSERT_EQUAL_INT(29, Heap_size(h), "Size is 29 after two batches");
+
+    int all[29];
+    ASSERT_TRUE(Heap_popMany(h, all, 30) == STATUS_ERR_UNDERFLOW, "popMany beyond size fails");
+    ASSERT_EQUAL_INT(29, Heap_size(h), "Failed popMany removes nothing");
+    Heap_popMany(h, all, 29);
+    ASSERT_TRUE(Heap_top(h) == NULL, "Heap_top on an empty heap returns NULL");
+    bool order_correct = true;
+    for (int i = 1; i < 29; ++i)
+        if (all[i - 1] > all[i]) order_correct = false;
+    ASSERT_TRUE(order_correct && all[0] == 1 && all[28] == 200, "Draining returns all elements in order");
+    Heap_destroy(h);
+
+    Heap* empty = Heap_initFromArray(NULL, 0, sizeof(int), compare_int_min);
+    ASSERT_TRUE(empty != NULL && Heap_size(empty) == 0, "Heap_initFromArray with no elements yields an empty heap");
+    Heap_destroy(empty);
+    ASSERT_TRUE(Heap_initFromArray(NULL, 3, sizeof(int), compare_int_min) == NULL, "Heap_initFromArray with NULL data fails");
+}
+
+/**
+ * @brief Tests top-K selection with a bounded heap.
+ */
+void test_bounded() {
+    printf("\n--- Testing Bounded Heaps ---\n");
+    const int k = 10;
+    Heap* h = Heap_initBounded(k, sizeof(int), compare_int_min);
+    ASSERT_TRUE(h != NULL && Heap_bound(h) == (size_t)k, "Heap_initBounded succeeds");
+
+    // Keep the 10 largest of a scrambled stream of 0..999.
+    int accepted = 0;
+    for (int i = 0; i < 1000; ++i) {
+        int val = (i * 389) % 1000;
+        if (Heap_offer(h, &val) == STATUS_OK) accepted++;
+    }
+    ASSERT_EQUAL_INT((size_t)k, Heap_size(h), "A bounded heap never grows past its bound");
+    ASSERT_TRUE(accepted < 100, "Most of the stream is rejected");
+    int low = 5;
+    ASSERT_TRUE(Heap_offer(h, &low) == STATUS_ERR_FULL && Heap_size(h) == (size_t)k, "Offering a small element to a full heap is rejected");
+    ASSERT_TRUE(Heap_push(h, &low) == STATUS_ERR_FULL, "Push onto a full bounded heap fails");
+    ASSERT_TRUE(Heap_pushMany(h, &low, 1) == STATUS_ERR_FULL, "pushMany onto a full bounded heap fails");
+
+    int top[10];
+    ASSERT_TRUE(Heap_drainSorted(h, top) == STATUS_OK && Heap_size(h) == 0, "drainSorted empties the heap");
+    bool order_correct = true;
+    for (int i = 0; i < k; ++i)
+        if (top[i] != 990 + i) order_correct = false;
+    ASSERT_TRUE(order_correct, "drainSorted returns the top K in pop order");
+
+    // The drained heap refills without reallocating.
+    for (int i = 0; i < 3; ++i) Heap_offer(h, &i);
+    ASSERT_TRUE(Heap_drainSorted(h, top) == STATUS_OK && top[0] == 0 && top[2] == 2, "A drained heap can be refilled");
+    ASSERT_TRUE(Heap_drainSorted(h, NULL) == STATUS_OK, "drainSorted of an empty heap needs no output");
+    Heap_destroy(h);
+
+    h = Heap_init(0, sizeof(int), compare_int_min);
+    for (int i = 0; i < 50; ++i) Heap_offer(h, &i);
+    ASSERT_TRUE(Heap_size(h) == 50 && Heap_bound(h) == 0, "An unbounded heap accepts every offer");
+    Heap_destroy(h);
+    ASSERT_TRUE(Heap_initBounded(0, sizeof(int), compare_int_min) == NULL, "Init with bound 0 fails");
+    ASSERT_TRUE(Heap_offer(NULL, &low) == STATUS_ERR_INVALID_ARGUMENT, "Offer to a NULL heap fails");
+}
+
+/**
+ * @brief Tests 4-ary and 8-ary heaps, including partially filled last levels.
+ */
+void test_arity() {
+    printf("\n--- Testing d-ary Heaps ---\n");
+    size_t arities[] = {2, 4, 8};
+    for (size_t a = 0; a < 3; ++a) {
+        char msg[100];
+        Heap* h = Heap_initWithArity(0, sizeof(int), compare_int_min, arities[a]);
+        sprintf(msg, "%zu-ary heap initialization", arities[a]);
+        ASSERT_TRUE(h != NULL && Heap_arity(h) == arities[a], msg);
+
+        unsigned int seed = 99;
+        for (int i = 0; i < 517; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int val = (int)((seed >> 16) % 1000);
+            Heap_push(h, &val);
+        }
+
+        int prev = -1, popped;
+        bool order_correct = true;
+        while (Heap_size(h) > 0) {
+            Heap_pop(h, &popped);
+            if (popped < prev) order_correct = false;
+            prev = popped;
+        }
+        sprintf(msg, "%zu-ary heap pops in order", arities[a]);
+        ASSERT_TRUE(order_correct, msg);
+        Heap_destroy(h);
+    }
+
+    int values[] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 10};
+    Heap* built = Heap_initFromArrayWithArity(values, 11, sizeof(int), compare_int_min, 4);
+    int out[11];
+    Heap_popMany(built, out, 11);
+    ASSERT_TRUE(out[0] == 0 && out[5] == 5 && out[10] == 10, "4-ary bulk-built heap pops in order");
+    Heap_destroy(built);
+
+    ASSERT_TRUE(Heap_initWithArity(1, sizeof(int), compare_int_min, 3) == NULL, "Init with arity 3 fails");
+    ASSERT_TRUE(Heap_initWithArity(1, sizeof(int), compare_int_min, 16) == NULL, "Init with arity 16 fails");
+}
+
+/**
+ * @brief Tests saving, loading and mapping heap snapshots.
+ */
+void test_snapshots() {
+    printf("\n--- Testing Snapshots ---\n");
+    char path[] = "/tmp/dsa-heap-XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0, "Temporary snapshot file is created");
+
+    Heap* heap = Heap_initWithArity(0, sizeof(int), compare_int_min, 4);
+    unsigned int seed = 7;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int val = (int)((seed >> 16) % 5000);
+        Heap_push(heap, &val);
+    }
+    ASSERT_TRUE(Heap_save(heap, fd) == STATUS_OK, "save succeeds");
+
+    lseek(fd, 0, SEEK_SET);
+    Heap* loaded = Heap_load(fd, compare_int_min);
+    ASSERT_TRUE(loaded && Heap_size(loaded) == 1000 && Heap_arity(loaded) == 4, "load restores the size and arity");
+    Heap* mapped = Heap_mapFile(path, sizeof(int), compare_int_min);
+    ASSERT_TRUE(mapped && Heap_size(mapped) == 1000 && Heap_arity(mapped) == 4, "mapFile restores the size and arity");
+
+    int extra = -1;
+    Heap_push(mapped, &extra);
+    int expected, a = 0, b = 0;
+    bool same = true;
+    Heap_pop(mapped, &a);
+    ASSERT_TRUE(a == -1, "A mapped heap accepts pushes");
+    while (Heap_size(heap) > 0) {
+        Heap_pop(heap, &expected);
+        Heap_pop(loaded, &a);
+        Heap_pop(mapped, &b);
+        if (a != expected || b != expected) same = false;
+    }
+    ASSERT_TRUE(same && Heap_size(loaded) == 0 && Heap_size(mapped) == 0, "Loaded and mapped heaps pop in the original order");
+    Heap_destroy(mapped);
+    Heap_destroy(loaded);
+
+    lseek(fd, 0, SEEK_SET);
+    ASSERT_TRUE(Heap_load(fd, NULL) == NULL, "load rejects a NULL comparator");
+    ASSERT_TRUE(Heap_mapFile(path, sizeof(short), compare_int_min) == NULL, "mapFile rejects a different element size");
+
+    Heap_destroy(heap);
+    close(fd);
+    unlink(path);
+}
+
+/**
+ * @brief Tests the instrumentation counters.
+ */
+void test_stats() {
+    printf("\n--- Testing Stats ---\n");
+    Heap* heap = Heap_init(0, sizeof(int), compare_int_min);
+    for (int i = 100; i > 0; --i) Heap_push(heap, &i);
+
+    DsaStats stats;
+    ASSERT_TRUE(Heap_getStats(heap, &stats) == STATUS_OK, "getStats succeeds");
+    if (Dsa_statsEnabled()) {
+        ASSERT_TRUE(stats.comparisons > 0 && stats.bytesMoved > 0, "Descending pushes count comparisons and sift moves");
+        ASSERT_EQUAL_INT(3, stats.reallocs, "The storage's growths past its inline capacity count as the heap's");
+    } else {
+        ASSERT_TRUE(stats.comparisons == 0 && stats.reallocs == 0, "Counters read 0 without DSA_STATS");
+    }
+    ASSERT_TRUE(Heap_getStats(NULL, &stats) == STATUS_ERR_INVALID_ARGUMENT, "getStats rejects a NULL heap");
+    Heap_destroy(heap);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -165,6 +400,12 @@ int main() {
 
     test_min_heap();
     test_max_heap();
+    test_interleaved_push_pop();
+    test_bulk_operations();
+    test_bounded();
+    test_arity();
+    test_snapshots();
+    test_stats();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
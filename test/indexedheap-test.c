@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <dsa-lib/indexedheap.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+typedef struct {
+    int vertex;
+    int distance;
+} Entry;
+
+// Comparison function for a MIN-HEAP of entries by distance.
+int compare_entry_distance(const void* a, const void* b) {
+    const Entry* e_a = (const Entry*)a;
+    const Entry* e_b = (const Entry*)b;
+    return e_a->distance - e_b->distance;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests push/pop ordering and handle reporting.
+ */
+void test_push_pop() {
+    printf("\n--- Testing Push/Pop with Handles ---\n");
+    IndexedHeap* h = IndexedHeap_init(2, sizeof(Entry), compare_entry_distance);
+    ASSERT_TRUE(h != NULL, "Indexed heap initialization");
+
+    int distances[] = {50, 20, 70, 10, 40};
+    size_t handles[5];
+    for (int i = 0; i < 5; ++i) {
+        Entry e = {i, distances[i]};
+        IndexedHeap_push(h, &e, &handles[i]);
+    }
+    ASSERT_EQUAL_INT(5, IndexedHeap_size(h), "Size is 5 after 5 pushes");
+
+    Entry top;
+    size_t top_handle;
+    IndexedHeap_peek(h, &top, &top_handle);
+    ASSERT_EQUAL_INT(10, top.distance, "Peek returns the minimum distance");
+    ASSERT_TRUE(top_handle == handles[3], "Peek reports the handle of the minimum");
+
+    IndexedHeap_pop(h, &top, &top_handle);
+    ASSERT_TRUE(!IndexedHeap_contains(h, top_handle), "Popped handle is released");
+
+    Entry got;
+    ASSERT_TRUE(IndexedHeap_get(h, handles[0], &got) == STATUS_OK && got.vertex == 0, "Get by handle returns the element");
+
+    IndexedHeap_destroy(h);
+}
+
+/**
+ * @brief Tests decreaseKey, increaseKey, update and remove.
+ */
+void test_key_updates() {
+    printf("\n--- Testing Key Updates and Removal ---\n");
+    IndexedHeap* h = IndexedHeap_init(0, sizeof(Entry), compare_entry_distance);
+
+    size_t handles[8];
+    for (int i = 0; i < 8; ++i) {
+        Entry e = {i, 100 + i * 10};
+        IndexedHeap_push(h, &e, &handles[i]);
+    }
+
+    // Vertex 7 found a shorter path; it must become the root.
+    Entry shorter = {7, 5};
+    ASSERT_TRUE(IndexedHeap_decreaseKey(h, handles[7], &shorter) == STATUS_OK, "decreaseKey succeeds");
+    Entry top;
+    IndexedHeap_peek(h, &top, NULL);
+    ASSERT_EQUAL_INT(7, top.vertex, "Decreased element moves to the root");
+
+    Entry longer = {7, 500};
+    ASSERT_TRUE(IndexedHeap_decreaseKey(h, handles[7], &longer) == STATUS_ERR_INVALID_ARGUMENT, "decreaseKey rejects a larger key");
+    ASSERT_TRUE(IndexedHeap_increaseKey(h, handles[7], &longer) == STATUS_OK, "increaseKey succeeds");
+    IndexedHeap_peek(h, &top, NULL);
+    ASSERT_EQUAL_INT(0, top.vertex, "Increased element leaves the root");
+
+    Entry middle = {2, 135};
+    IndexedHeap_update(h, handles[2], &middle);
+    Entry removed;
+    ASSERT_TRUE(IndexedHeap_remove(h, handles[4], &removed) == STATUS_OK, "Remove by handle succeeds");
+    ASSERT_EQUAL_INT(4, removed.vertex, "Remove returns the removed element");
+    ASSERT_TRUE(IndexedHeap_remove(h, handles[4], NULL) == STATUS_ERR_KEY_NOT_FOUND, "Removing a released handle fails");
+
+    // Remaining distances: 100, 110, 130, 135, 150, 160, 500 in that order.
+    int expected[] = {100, 110, 130, 135, 150, 160, 500};
+    bool order_correct = true;
+    for (int i = 0; i < 7; ++i) {
+        IndexedHeap_pop(h, &top, NULL);
+        if (top.distance != expected[i]) order_correct = false;
+    }
+    ASSERT_TRUE(order_correct, "Pops follow the updated keys");
+    ASSERT_EQUAL_INT(0, IndexedHeap_size(h), "Heap is empty after popping everything");
+
+    // Released handles are recycled.
+    size_t reused;
+    Entry e = {9, 1};
+    IndexedHeap_push(h, &e, &reused);
+    ASSERT_TRUE(reused < 8, "A released handle is reused by the next push");
+
+    IndexedHeap_destroy(h);
+}
+
+/**
+ * @brief Tests edge cases and invalid inputs.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    IndexedHeap* h = IndexedHeap_init(1, sizeof(Entry), compare_entry_distance);
+    Entry e = {0, 0};
+
+    ASSERT_TRUE(IndexedHeap_init(1, 0, compare_entry_distance) == NULL, "Init with dataSize 0 fails");
+    ASSERT_TRUE(IndexedHeap_init(1, sizeof(Entry), NULL) == NULL, "Init with NULL compare function fails");
+    ASSERT_TRUE(IndexedHeap_push(NULL, &e, NULL) == STATUS_ERR_INVALID_ARGUMENT, "Push with NULL heap fails");
+    ASSERT_TRUE(IndexedHeap_push(h, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "Push with NULL element fails");
+    ASSERT_TRUE(IndexedHeap_pop(h, &e, NULL) == STATUS_ERR_UNDERFLOW, "Pop from empty heap fails");
+    ASSERT_TRUE(IndexedHeap_peek(h, &e, NULL) == STATUS_ERR_EMPTY, "Peek from empty heap fails");
+    ASSERT_TRUE(IndexedHeap_get(h, 42, &e) == STATUS_ERR_KEY_NOT_FOUND, "Get with unknown handle fails");
+    ASSERT_TRUE(IndexedHeap_update(h, 42, &e) == STATUS_ERR_KEY_NOT_FOUND, "Update with unknown handle fails");
+    ASSERT_TRUE(!IndexedHeap_contains(NULL, 0), "contains on NULL heap returns false");
+    ASSERT_EQUAL_INT(0, IndexedHeap_size(NULL), "Size of NULL heap is 0");
+
+    IndexedHeap_destroy(h);
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("      Testing IndexedHeap Module\n");
+    printf("========================================\n");
+
+    test_push_pop();
+    test_key_updates();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -167,6 +167,122 @@ void test_struct_list() {
     LinkedList_destroy(list);
 }
 
+/**
+ * @brief Tests a LinkedList whose nodes come from a pool.
+ */
+void test_pooled_list() {
+    printf("\n--- Testing Pooled LinkedList ---\n");
+    LinkedList* list = LinkedList_initPooled(sizeof(int), 4);
+    ASSERT_TRUE(list != NULL, "Pooled list initialization");
+
+    // Enough inserts to span several chunks, with deletes to exercise reuse.
+    for (int i = 0; i < 20; ++i) LinkedList_insert(list, &i);
+    LinkedList_delete(list, 1);  // Removes 19
+    LinkedList_delete(list, 10); // Removes 9
+    int val = 100;
+    LinkedList_insert(list, &val);
+    ASSERT_EQUAL_INT(19, LinkedList_size(list), "Size is correct after inserts and deletes");
+
+    int retrieved_val;
+    LinkedList_get(list, 1, &retrieved_val);
+    ASSERT_EQUAL_INT(100, retrieved_val, "Head is the most recent insert");
+    LinkedList_get(list, 19, &retrieved_val);
+    ASSERT_EQUAL_INT(0, retrieved_val, "Tail is the first insert");
+
+    LinkedList_destroy(list);
+}
+
+// forEachCtx callback summing values until the sum exceeds a limit
+bool sum_until(void* data, void* ctx) {
+    int* sum = ctx;
+    *sum += *(int*)data;
+    return *sum <= 10;
+}
+
+/**
+ * @brief Tests O(1) operations at both ends, splicing and node cursors.
+ */
+void test_deque_and_cursors() {
+    printf("\n--- Testing Ends, Splicing and Cursors ---\n");
+    LinkedList* list = LinkedList_init(sizeof(int));
+    int val;
+
+    // [0 1 2 3 4] built from the back, then -1 at the front.
+    for (int i = 0; i < 5; ++i) LinkedList_pushBack(list, &i);
+    val = -1;
+    LinkedList_pushFront(list, &val);
+    LinkedList_get(list, 6, &val);
+    ASSERT_EQUAL_INT(4, val, "pushBack appends at the tail");
+    LinkedList_get(list, 5, &val);
+    ASSERT_EQUAL_INT(3, val, "Get near the tail walks backwards correctly");
+
+    ASSERT_TRUE(LinkedList_popBack(list, &val) == STATUS_OK && val == 4, "popBack returns the last element");
+    ASSERT_TRUE(LinkedList_popFront(list, &val) == STATUS_OK && val == -1, "popFront returns the first element");
+    ASSERT_EQUAL_INT(4, LinkedList_size(list), "Size is correct after pops");
+
+    // Cursors: insert around and remove the node holding 2.
+    LinkedListNode* node = LinkedList_nodeAt(list, 3);
+    ASSERT_EQUAL_INT(2, *(int*)LinkedList_nodeData(node), "nodeAt returns the right node");
+    val = 10;
+    LinkedList_insertBefore(list, node, &val);
+    val = 20;
+    LinkedList_insertAfter(list, node, &val);
+    ASSERT_EQUAL_INT(10, *(int*)LinkedList_nodeData(LinkedList_prev(node)), "insertBefore links before the cursor");
+    ASSERT_EQUAL_INT(20, *(int*)LinkedList_nodeData(LinkedList_next(node)), "insertAfter links after the cursor");
+    LinkedList_removeNode(list, node, &val);
+    ASSERT_EQUAL_INT(2, val, "removeNode copies out the removed element");
+
+    // Expected now: [0 1 10 20 3]
+    int expected[] = {0, 1, 10, 20, 3};
+    int ok = 1, i = 0;
+    for (LinkedListNode* n = LinkedList_first(list); n; n = LinkedList_next(n))
+        ok &= (*(int*)LinkedList_nodeData(n) == expected[i++]);
+    ASSERT_TRUE(ok && i == 5, "Forward cursor walk sees every element in order");
+    ok = 1;
+    for (LinkedListNode* n = LinkedList_last(list); n; n = LinkedList_prev(n))
+        ok &= (*(int*)LinkedList_nodeData(n) == expected[--i]);
+    ASSERT_TRUE(ok && i == 0, "Backward cursor walk sees every element in reverse");
+
+    // Splice [100 101] before the element 10, then concat [200].
+    LinkedList* other = LinkedList_init(sizeof(int));
+    val = 100; LinkedList_pushBack(other, &val);
+    val = 101; LinkedList_pushBack(other, &val);
+    ASSERT_TRUE(LinkedList_splice(list, LinkedList_nodeAt(list, 3), other) == STATUS_OK, "Splice succeeds");
+    ASSERT_EQUAL_INT(0, LinkedList_size(other), "Spliced source is left empty");
+    val = 200; LinkedList_pushBack(other, &val);
+    ASSERT_TRUE(LinkedList_concat(list, other) == STATUS_OK, "Concat succeeds");
+    ASSERT_EQUAL_INT(8, LinkedList_size(list), "Size is correct after splice and concat");
+    LinkedList_get(list, 3, &val);
+    ASSERT_EQUAL_INT(100, val, "Spliced nodes sit before the position");
+    LinkedList_get(list, 5, &val);
+    ASSERT_EQUAL_INT(10, val, "Position node follows the spliced nodes");
+    LinkedList_popBack(list, &val);
+    ASSERT_EQUAL_INT(200, val, "Concatenated node is the new tail");
+
+    // Splicing is rejected across pooled lists and mismatched types.
+    LinkedList* pooled = LinkedList_initPooled(sizeof(int), 0);
+    LinkedList* wide = LinkedList_init(sizeof(double));
+    ASSERT_TRUE(LinkedList_concat(list, pooled) == STATUS_ERR_INVALID_ARGUMENT, "Concat with a pooled list fails");
+    ASSERT_TRUE(LinkedList_concat(list, wide) == STATUS_ERR_INVALID_ARGUMENT, "Concat with a different dataSize fails");
+    ASSERT_TRUE(LinkedList_concat(list, list) == STATUS_ERR_INVALID_ARGUMENT, "Concat with itself fails");
+
+    // [0 1 100 101 10 20 3]: 0+1+100 passes the limit after three elements.
+    int sum = 0;
+    LinkedList_forEachCtx(list, sum_until, &sum);
+    ASSERT_EQUAL_INT(101, sum, "forEachCtx passes ctx and stops when the callback returns false");
+
+    // Drain from both ends.
+    while (LinkedList_popFront(list, NULL) == STATUS_OK && LinkedList_popBack(list, NULL) == STATUS_OK) {}
+    ASSERT_EQUAL_INT(0, LinkedList_size(list), "List is empty after draining");
+    ASSERT_TRUE(LinkedList_first(list) == NULL && LinkedList_last(list) == NULL, "Empty list has no cursors");
+    ASSERT_TRUE(LinkedList_popBack(list, NULL) == STATUS_ERR_UNDERFLOW, "popBack on empty list fails");
+
+    LinkedList_destroy(wide);
+    LinkedList_destroy(pooled);
+    LinkedList_destroy(other);
+    LinkedList_destroy(list);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -214,6 +330,8 @@ int main() {
     test_int_list();
     test_string_list();
     test_struct_list();
+    test_pooled_list();
+    test_deque_and_cursors();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <dsa-lib/pool.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+
+// =============================================================================
+// 2. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests allocation, alignment, reuse and chunk growth.
+ */
+void test_alloc_free() {
+    printf("\n--- Testing Pool Allocation ---\n");
+    Pool* pool = Pool_init(12, 4);
+    ASSERT_TRUE(pool != NULL, "Pool initialization");
+    ASSERT_TRUE(Pool_blockSize(pool) >= 12, "Block size is at least the requested size");
+    ASSERT_TRUE(Pool_blockSize(pool) % _Alignof(max_align_t) == 0, "Block size keeps blocks aligned");
+
+    // Allocate more blocks than fit in one chunk.
+    void* blocks[10];
+    bool all_aligned = true, all_distinct = true;
+    for (int i = 0; i < 10; ++i) {
+        blocks[i] = Pool_alloc(pool);
+        if ((uintptr_t)blocks[i] % _Alignof(max_align_t) != 0) all_aligned = false;
+        memset(blocks[i], i, 12);
+        for (int j = 0; j < i; ++j)
+            if (blocks[j] == blocks[i]) all_distinct = false;
+    }
+    ASSERT_TRUE(all_aligned, "Every block is maximally aligned");
+    ASSERT_TRUE(all_distinct, "Blocks across chunks are distinct");
+
+    bool contents_intact = true;
+    for (int i = 0; i < 10; ++i)
+        if (((unsigned char*)blocks[i])[11] != (unsigned char)i) contents_intact = false;
+    ASSERT_TRUE(contents_intact, "Writing one block does not clobber another");
+
+    Pool_free(pool, blocks[3]);
+    ASSERT_TRUE(Pool_alloc(pool) == blocks[3], "A freed block is reused first");
+
+    Pool_destroy(pool);
+}
+
+/**
+ * @brief Tests edge cases and invalid inputs.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    ASSERT_TRUE(Pool_init(0, 16) == NULL, "Init with blockSize 0 fails");
+    ASSERT_TRUE(Pool_alloc(NULL) == NULL, "Alloc from NULL pool returns NULL");
+    ASSERT_EQUAL_INT(0, Pool_blockSize(NULL), "Block size of NULL pool is 0");
+
+    Pool* pool = Pool_init(1, 0);
+    ASSERT_TRUE(pool != NULL, "Init with default chunk size succeeds");
+    ASSERT_TRUE(Pool_blockSize(pool) >= sizeof(void*), "Tiny blocks still fit a free-list link");
+    Pool_free(pool, NULL);
+    Pool_destroy(pool);
+    Pool_destroy(NULL);
+    ASSERT_TRUE(true, "Free of NULL block and destroy of NULL pool are no-ops");
+}
+
+
+// =============================================================================
+// 3. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("          Testing Pool Module\n");
+    printf("========================================\n");
+
+    test_alloc_free();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -142,6 +142,43 @@ void test_struct_queue() {
     Queue_destroy(q);
 }
 
+/**
+ * @brief Tests ring-buffer growth while the contents are wrapped around.
+ */
+void test_ring_growth() {
+    printf("\n--- Testing Ring Buffer Growth ---\n");
+    Queue* q = Queue_initWithCapacity(3, sizeof(int));
+    ASSERT_TRUE(q != NULL, "Queue initialization with capacity");
+    ASSERT_EQUAL_INT(4, Queue_capacity(q), "Capacity is rounded up to a power of two");
+
+    // Advance the head so that the next enqueues wrap around the buffer.
+    int next_in = 0, next_out = 0, val;
+    for (int i = 0; i < 3; ++i) Queue_enqueue(q, &(int){next_in++});
+    for (int i = 0; i < 2; ++i) {
+        Queue_dequeueInto(q, &val);
+        next_out++;
+    }
+    for (int i = 0; i < 3; ++i) Queue_enqueue(q, &(int){next_in++});
+    ASSERT_EQUAL_INT(4, Queue_size(q), "Queue is full and wrapped");
+
+    // Growing a wrapped ring must keep FIFO order intact.
+    for (int i = 0; i < 100; ++i) Queue_enqueue(q, &(int){next_in++});
+    ASSERT_EQUAL_INT(104, Queue_size(q), "Size is correct after growth");
+    ASSERT_EQUAL_INT(next_out, *(int*)Queue_front(q), "Queue_front borrows the front element after growth");
+    ASSERT_TRUE(Queue_capacity(q) >= 104, "Capacity doubled to fit all elements");
+
+    bool order_correct = true;
+    while (!Queue_isEmpty(q)) {
+        Queue_dequeueInto(q, &val);
+        if (val != next_out++) order_correct = false;
+    }
+    ASSERT_TRUE(order_correct, "Elements dequeue in FIFO order after wrapped growth");
+    ASSERT_TRUE(Queue_dequeueInto(q, &val) == STATUS_ERR_UNDERFLOW, "DequeueInto from empty queue fails");
+    ASSERT_TRUE(Queue_front(q) == NULL, "Queue_front on an empty queue returns NULL");
+
+    Queue_destroy(q);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -156,6 +193,8 @@ void test_edge_cases() {
     ASSERT_TRUE(Queue_dequeue(NULL) == STATUS_ERR_INVALID_ARGUMENT, "Dequeue with NULL queue fails");
     ASSERT_TRUE(Queue_peek(q, NULL) == STATUS_ERR_INVALID_ARGUMENT, "Peek with NULL output pointer fails");
     ASSERT_TRUE(Queue_peek(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "Peek with NULL queue fails");
+    ASSERT_TRUE(Queue_dequeueInto(q, NULL) == STATUS_ERR_INVALID_ARGUMENT, "DequeueInto with NULL output pointer fails");
+    ASSERT_TRUE(Queue_init(0) == NULL, "Init with dataSize 0 fails");
 
     // Empty checks
     ASSERT_TRUE(Queue_isEmpty(q), "Queue is initially empty");
@@ -180,6 +219,7 @@ int main() {
     test_int_queue();
     test_string_queue();
     test_struct_queue();
+    test_ring_growth();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
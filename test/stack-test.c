@@ -141,6 +141,49 @@ void test_struct_stack() {
     Stack_destroy(s);
 }
 
+/**
+ * @brief Tests popInto and the bulk push/pop operations.
+ */
+void test_bulk_operations() {
+    printf("\n--- Testing Bulk Operations ---\n");
+    Stack* s = Stack_init(sizeof(int), 6);
+    int input[] = {1, 2, 3, 4, 5};
+    int out[5] = {0};
+    int val = 0;
+
+    ASSERT_TRUE(Stack_pushMany(s, input, 5) == STATUS_OK, "pushMany succeeds when everything fits");
+    ASSERT_EQUAL_INT(5, Stack_size(s), "Size is correct after pushMany");
+    Stack_peek(s, &val);
+    ASSERT_EQUAL_INT(5, val, "Last array element is on top");
+    ASSERT_TRUE(Stack_pushMany(s, input, 2) == STATUS_ERR_OVERFLOW, "pushMany past the bound fails");
+    ASSERT_EQUAL_INT(5, Stack_size(s), "Failed pushMany pushes nothing");
+
+    int* top = Stack_top(s);
+    ASSERT_TRUE(top != NULL && *top == 5, "Stack_top borrows the top element");
+    *top = 50;
+    ASSERT_TRUE(Stack_popInto(s, &val) == STATUS_OK && val == 50, "popInto returns the element modified in place");
+    ASSERT_TRUE(Stack_popMany(s, out, 5) == STATUS_ERR_UNDERFLOW, "popMany of more than size fails");
+    ASSERT_EQUAL_INT(4, Stack_size(s), "Failed popMany pops nothing");
+    ASSERT_TRUE(Stack_popMany(s, out, 3) == STATUS_OK, "popMany succeeds");
+    ASSERT_TRUE(out[0] == 4 && out[1] == 3 && out[2] == 2, "popMany returns elements in pop order");
+    Stack_peek(s, &val);
+    ASSERT_EQUAL_INT(1, val, "Remaining element is the first pushed");
+
+    // Reuse after draining: the preallocated buffer is never shrunk.
+    Stack_popInto(s, NULL);
+    for (int i = 0; i < 6; ++i) Stack_push(s, &i);
+    ASSERT_TRUE(Stack_isFull(s), "Stack fills back up to its bound");
+    Stack_popInto(s, &val);
+    ASSERT_EQUAL_INT(5, val, "Top is correct after refilling");
+
+    ASSERT_TRUE(Stack_top(NULL) == NULL, "Stack_top on a NULL stack returns NULL");
+    ASSERT_TRUE(Stack_popInto(NULL, &val) == STATUS_ERR_INVALID_ARGUMENT, "popInto with NULL stack fails");
+    ASSERT_TRUE(Stack_pushMany(s, NULL, 1) == STATUS_ERR_INVALID_ARGUMENT, "pushMany with NULL elements fails");
+    ASSERT_TRUE(Stack_init(sizeof(int), SIZE_MAX) == NULL, "Init with an overflowing bound fails");
+
+    Stack_destroy(s);
+}
+
 /**
  * @brief Tests edge cases and invalid inputs.
  */
@@ -186,6 +229,7 @@ int main() {
     test_int_stack();
     test_string_stack();
     test_struct_stack();
+    test_bulk_operations();
     test_edge_cases();
 
     printf("\n----------------------------------------\n");
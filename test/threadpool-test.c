@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <dsa-lib/threadpool.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+#define RANGE 100000
+
+// Per-index visit counters, plus a record of the largest subrange seen.
+typedef struct {
+    atomic_int visits[RANGE];
+    atomic_size_t largest;
+    ThreadPool* pool;
+} Coverage;
+
+static Coverage coverage;
+
+void count_visits(size_t begin, size_t end, void* ctx) {
+    Coverage* c = ctx;
+    for (size_t i = begin; i < end; i++)
+        atomic_fetch_add(&c->visits[i], 1);
+    size_t length = end - begin, seen = atomic_load(&c->largest);
+    while (length > seen && !atomic_compare_exchange_weak(&c->largest, &seen, length)) {}
+}
+
+bool every_index_once(size_t count) {
+    for (size_t i = 0; i < count; i++)
+        if (atomic_load(&coverage.visits[i]) != 1) return false;
+    return true;
+}
+
+void reset_coverage() {
+    for (size_t i = 0; i < RANGE; i++) atomic_store(&coverage.visits[i], 0);
+    atomic_store(&coverage.largest, 0);
+}
+
+// Work whose cost grows with the index, so a static split would be unbalanced.
+void uneven_work(size_t begin, size_t end, void* ctx) {
+    atomic_long* total = ctx;
+    for (size_t i = begin; i < end; i++) {
+        long acc = 0;
+        for (size_t k = 0; k < i; k++) acc += (long)(k & 1);
+        atomic_fetch_add(total, acc);
+    }
+}
+
+// A body that runs a nested loop on the same pool.
+void nested_body(size_t begin, size_t end, void* ctx) {
+    Coverage* c = ctx;
+    for (size_t i = begin; i < end; i++)
+        ThreadPool_parallelFor(c->pool, 10, 3, count_visits, c);
+}
+
+// Several threads submitting loops to one pool at the same time.
+void* submit_loop(void* arg) {
+    ThreadPool* pool = arg;
+    for (int round = 0; round < 20; round++) {
+        atomic_long total = 0;
+        ThreadPool_parallelFor(pool, 200, 0, uneven_work, &total);
+    }
+    return NULL;
+}
+
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests that loops cover their range exactly once in subranges of at most a grain.
+ */
+void test_parallel_for() {
+    printf("\n--- Testing parallelFor ---\n");
+    ThreadPool* pool = ThreadPool_init(4);
+    ASSERT_TRUE(pool != NULL, "Pool initializes");
+    ASSERT_EQUAL_INT(4, ThreadPool_threadCount(pool), "threadCount includes the caller");
+
+    reset_coverage();
+    ASSERT_TRUE(ThreadPool_parallelFor(pool, RANGE, 64, count_visits, &coverage) == STATUS_OK, "parallelFor succeeds");
+    ASSERT_TRUE(every_index_once(RANGE), "Every index is visited exactly once");
+    ASSERT_TRUE(atomic_load(&coverage.largest) <= 64, "No subrange exceeds the grain");
+
+    reset_coverage();
+    ThreadPool_parallelFor(pool, 12345, 0, count_visits, &coverage);
+    ASSERT_TRUE(every_index_once(12345), "An automatic grain covers the range");
+
+    reset_coverage();
+    ThreadPool_parallelFor(pool, 3, 1, count_visits, &coverage);
+    ASSERT_TRUE(every_index_once(3), "A range shorter than the thread count is covered");
+
+    bool repeated = true;
+    for (int round = 0; round < 200; round++) {
+        reset_coverage();
+        ThreadPool_parallelFor(pool, 1000, 1, count_visits, &coverage);
+        if (!every_index_once(1000)) repeated = false;
+    }
+    ASSERT_TRUE(repeated, "Back-to-back loops each cover their range");
+
+    atomic_long total = 0;
+    ThreadPool_parallelFor(pool, 2000, 1, uneven_work, &total);
+    ASSERT_TRUE(atomic_load(&total) == 1000L * 999, "Uneven work balances and completes");
+
+    ThreadPool_destroy(pool);
+}
+
+/**
+ * @brief Tests nested loops, concurrent submitters and single-threaded pools.
+ */
+void test_nesting_and_concurrency() {
+    printf("\n--- Testing Nesting and Concurrency ---\n");
+    ThreadPool* pool = ThreadPool_init(3);
+
+    reset_coverage();
+    coverage.pool = pool;
+    ThreadPool_parallelFor(pool, 50, 1, nested_body, &coverage);
+    bool nested = true;
+    for (size_t i = 0; i < 10; i++)
+        if (atomic_load(&coverage.visits[i]) != 50) nested = false;
+    ASSERT_TRUE(nested, "A nested loop runs on the calling thread without deadlock");
+
+    pthread_t submitters[4];
+    for (int i = 0; i < 4; i++) pthread_create(&submitters[i], NULL, submit_loop, pool);
+    for (int i = 0; i < 4; i++) pthread_join(submitters[i], NULL);
+    ASSERT_TRUE(true, "Loops submitted from several threads are serialized");
+    ThreadPool_destroy(pool);
+
+    ThreadPool* single = ThreadPool_init(1);
+    reset_coverage();
+    ThreadPool_parallelFor(single, 1000, 10, count_visits, &coverage);
+    ASSERT_TRUE(every_index_once(1000), "A single-threaded pool runs the loop itself");
+    ThreadPool_destroy(single);
+
+    ThreadPool* shared = ThreadPool_default();
+    ASSERT_TRUE(shared != NULL && shared == ThreadPool_default(), "The default pool is created once");
+    ASSERT_TRUE(ThreadPool_threadCount(shared) >= 1, "The default pool has a thread per CPU");
+}
+
+/**
+ * @brief Tests edge cases and invalid inputs.
+ */
+void test_edge_cases() {
+    printf("\n--- Testing Edge Cases ---\n");
+    ThreadPool* pool = ThreadPool_init(2);
+    ASSERT_TRUE(ThreadPool_parallelFor(NULL, 10, 1, count_visits, &coverage) == STATUS_ERR_INVALID_ARGUMENT, "parallelFor rejects a NULL pool");
+    ASSERT_TRUE(ThreadPool_parallelFor(pool, 10, 1, NULL, NULL) == STATUS_ERR_INVALID_ARGUMENT, "parallelFor rejects a NULL body");
+    reset_coverage();
+    ASSERT_TRUE(ThreadPool_parallelFor(pool, 0, 1, count_visits, &coverage) == STATUS_OK
+        && atomic_load(&coverage.largest) == 0, "An empty range never calls the body");
+    ASSERT_EQUAL_INT(0, ThreadPool_threadCount(NULL), "threadCount of NULL is 0");
+    ThreadPool_destroy(pool);
+    ThreadPool_destroy(NULL);
+    ASSERT_TRUE(true, "destroy handles NULL");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("        Testing ThreadPool Module\n");
+    printf("========================================\n");
+
+    test_parallel_for();
+    test_nesting_and_concurrency();
+    test_edge_cases();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <dsa-lib/typed.h>
+
+// =============================================================================
+// 1. Simple Assertion Framework
+// =============================================================================
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s\n", message); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_INT(expected, actual, message) \
+    do { \
+        if ((expected) == (actual)) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: %d, Got: %d)\n", message, (int)(expected), (int)(actual)); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+#define ASSERT_EQUAL_STRING(expected, actual, message) \
+    do { \
+        if (strcmp((expected), (actual)) == 0) { \
+            printf("[PASS] %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("[FAIL] %s (Expected: \"%s\", Got: \"%s\")\n", message, expected, actual); \
+            tests_failed++; \
+        } \
+    } while (0)
+
+
+// =============================================================================
+// 2. Custom Data Type and Helpers for Testing
+// =============================================================================
+
+typedef struct {
+    double time;
+    int id;
+} Event;
+
+static inline bool event_less(const Event* a, const Event* b) {
+    return a->time < b->time;
+}
+
+#define INT_GREATER(a, b) (*(a) > *(b))
+
+static inline int int_cmp(const int* a, const int* b) {
+    return (*a > *b) - (*a < *b);
+}
+
+typedef const char* cstr;
+
+ARRAYLIST_DEFINE(int)
+ARRAYLIST_DEFINE_NAMED(Str, cstr)
+HEAP_DEFINE(Event, event_less)
+HEAP_DEFINE_NAMED(MaxInt, int, INT_GREATER)
+AVLTREE_DEFINE(int, double, int_cmp)
+
+static double visited_sum = 0;
+static int visited_last = -1;
+static bool visited_ordered = true;
+
+// forEach callback checking key order and summing values
+void visit_pair(const int* key, double* value) {
+    if (*key <= visited_last) visited_ordered = false;
+    visited_last = *key;
+    visited_sum += *value;
+}
+
+// forEachCtx callback counting pairs until the limit in ctx is reached
+bool count_pairs(const int* key, double* value, void* ctx) {
+    (void)key; (void)value;
+    int* remaining = ctx;
+    return --*remaining > 0;
+}
+
+// Checks the AVL balance and ordering invariants; returns the height or -1.
+int check_avl(const AVLTreeNode_int_double* node, const int* lo, const int* hi) {
+    if (!node) return 0;
+    if ((lo && node->key <= *lo) || (hi && node->key >= *hi)) return -1;
+    int l = check_avl(node->left, lo, &node->key);
+    int r = check_avl(node->right, &node->key, hi);
+    if (l < 0 || r < 0 || l - r > 1 || r - l > 1) return -1;
+    int h = 1 + (l > r ? l : r);
+    return h == node->height ? h : -1;
+}
+
+// =============================================================================
+// 3. Test Groups
+// =============================================================================
+
+/**
+ * @brief Tests a generated ArrayList of int and of a typedef'd pointer type.
+ */
+void test_typed_arraylist() {
+    printf("\n--- Testing ARRAYLIST_DEFINE ---\n");
+    ArrayList_int list;
+    ArrayList_int_init(&list);
+
+    for (int i = 0; i < 100; ++i) ArrayList_int_insert(&list, i * 3);
+    ASSERT_EQUAL_INT(100, ArrayList_int_size(&list), "Size is correct after inserts");
+    ASSERT_EQUAL_INT(297, *ArrayList_int_at(&list, 99), "at returns the last element");
+    ASSERT_TRUE(ArrayList_int_at(&list, 100) == NULL, "at out of bounds returns NULL");
+
+    ArrayList_int_delete(&list, 0);
+    int val = 0;
+    ArrayList_int_get(&list, 0, &val);
+    ASSERT_EQUAL_INT(3, val, "delete shifts later elements left");
+    ArrayList_int_set(&list, 0, -7);
+    ASSERT_EQUAL_INT(-7, list.data[0], "set overwrites in place");
+    ASSERT_TRUE(ArrayList_int_get(&list, 99, &val) == STATUS_ERR_INVALID_ARGUMENT, "get out of bounds fails");
+
+    ArrayList_int_clear(&list);
+    ASSERT_EQUAL_INT(0, ArrayList_int_size(&list), "clear empties the list");
+    ASSERT_TRUE(list.capacity >= 100, "clear keeps the capacity");
+    ASSERT_TRUE(ArrayList_int_delete(&list, 0) == STATUS_ERR_UNDERFLOW, "delete on an empty list fails");
+    ArrayList_int_destroy(&list);
+
+    ArrayList_Str names;
+    ArrayList_Str_init(&names);
+    ArrayList_Str_reserve(&names, 2);
+    ASSERT_EQUAL_INT(2, names.capacity, "reserve allocates exactly");
+    ArrayList_Str_insert(&names, "alpha");
+    ArrayList_Str_insert(&names, "beta");
+    ArrayList_Str_insert(&names, "gamma");
+    ASSERT_EQUAL_STRING("gamma", *ArrayList_Str_at(&names, 2), "NAMED variant works for pointer types");
+    ArrayList_Str_destroy(&names);
+}
+
+/**
+ * @brief Tests generated heaps with a function and a macro comparator.
+ */
+void test_typed_heap() {
+    printf("\n--- Testing HEAP_DEFINE ---\n");
+    Heap_Event events;
+    Heap_Event_init(&events);
+    ASSERT_TRUE(Heap_Event_top(&events) == NULL, "top on an empty heap is NULL");
+
+    // Push times in a scrambled but deterministic order.
+    for (int i = 0; i < 200; ++i) {
+        Event e = { (double)((i * 37) % 200), i };
+        Heap_Event_push(&events, e);
+    }
+    ASSERT_EQUAL_INT(200, Heap_Event_size(&events), "Size is correct after pushes");
+    ASSERT_TRUE(Heap_Event_top(&events)->time == 0.0, "top is the earliest event");
+
+    bool ordered = true;
+    Event prev = { -1.0, 0 }, e;
+    while (Heap_Event_pop(&events, &e) == STATUS_OK) {
+        if (e.time < prev.time) ordered = false;
+        prev = e;
+    }
+    ASSERT_TRUE(ordered && prev.time == 199.0, "Events pop in time order");
+    ASSERT_TRUE(Heap_Event_pop(&events, NULL) == STATUS_ERR_UNDERFLOW, "pop on an empty heap fails");
+    Heap_Event_destroy(&events);
+
+    Heap_MaxInt max;
+    Heap_MaxInt_init(&max);
+    int values[] = {5, 1, 9, 3, 7};
+    for (int i = 0; i < 5; ++i) Heap_MaxInt_push(&max, values[i]);
+    int top = 0;
+    Heap_MaxInt_pop(&max, &top);
+    ASSERT_EQUAL_INT(9, top, "Macro comparator builds a max-heap");
+    ASSERT_EQUAL_INT(7, *Heap_MaxInt_top(&max), "Next largest is on top after pop");
+    Heap_MaxInt_destroy(&max);
+}
+
+/**
+ * @brief Tests a generated AVL map, including balance after many deletes.
+ */
+void test_typed_avltree() {
+    printf("\n--- Testing AVLTREE_DEFINE ---\n");
+    AVLTree_int_double tree;
+    AVLTree_int_double_init(&tree);
+
+    for (int i = 0; i < 500; ++i)
+        AVLTree_int_double_insert(&tree, (i * 7) % 500, i * 0.5);
+    ASSERT_EQUAL_INT(500, AVLTree_int_double_size(&tree), "Size is correct after inserts");
+    ASSERT_TRUE(AVLTree_int_double_insert(&tree, 7, 1.0) == STATUS_ERR_DUPLICATE_KEY, "Duplicate key is rejected");
+    ASSERT_TRUE(check_avl(tree.root, NULL, NULL) > 0, "Tree is ordered and balanced after inserts");
+
+    double* value = AVLTree_int_double_search(&tree, &(int){14});
+    ASSERT_TRUE(value != NULL && *value == 1.0, "search returns the stored value");
+    *value = 42.0;
+    ASSERT_TRUE(*AVLTree_int_double_search(&tree, &(int){14}) == 42.0, "Values can be updated through search");
+
+    for (int k = 0; k < 500; k += 2)
+        AVLTree_int_double_delete(&tree, &k);
+    ASSERT_EQUAL_INT(250, AVLTree_int_double_size(&tree), "Size is correct after deletes");
+    ASSERT_TRUE(check_avl(tree.root, NULL, NULL) > 0, "Tree is ordered and balanced after deletes");
+    ASSERT_TRUE(AVLTree_int_double_search(&tree, &(int){14}) == NULL, "Deleted key is gone");
+    ASSERT_TRUE(AVLTree_int_double_delete(&tree, &(int){14}) == STATUS_ERR_KEY_NOT_FOUND, "Deleting a missing key fails");
+
+    AVLTree_int_double_forEach(&tree, visit_pair);
+    int remaining = 5;
+    AVLTree_int_double_forEachCtx(&tree, count_pairs, &remaining);
+    ASSERT_EQUAL_INT(0, remaining, "forEachCtx stops when the callback returns false");
+    ASSERT_TRUE(visited_ordered && visited_last == 499, "forEach visits keys in order");
+
+    AVLTree_int_double_destroy(&tree);
+    ASSERT_TRUE(tree.root == NULL && AVLTree_int_double_size(&tree) == 0, "destroy leaves an empty tree");
+}
+
+
+// =============================================================================
+// 4. Main Test Runner
+// =============================================================================
+
+int main() {
+    printf("========================================\n");
+    printf("     Testing Typed Container Macros\n");
+    printf("========================================\n");
+
+    test_typed_arraylist();
+    test_typed_heap();
+    test_typed_avltree();
+
+    printf("\n----------------------------------------\n");
+    printf("Test Summary:\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}